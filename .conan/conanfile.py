@@ -6,10 +6,12 @@ class EnjinCPPSDK(ConanFile):
     generators = "cmake"
     options = {
         "with_default_http_client": [True, False],
+        "with_http2_client": [True, False],
         "with_default_ws_client": [True, False],
     }
     default_options = {
         "with_default_http_client": False,
+        "with_http2_client": False,
         "with_default_ws_client": False,
     }
 
@@ -24,6 +26,11 @@ class EnjinCPPSDK(ConanFile):
         if self.options.with_default_http_client:
             self.requires("cpp-httplib/0.8.5")
             self.options["cpp-httplib"].with_openssl = True
+            self.requires("zlib/1.2.11")
+
+        if self.options.with_http2_client:
+            self.requires("libnghttp2/1.43.0")
+            self.requires("openssl/1.1.1k")
 
         if self.options.with_default_ws_client:
             self.requires("ixwebsocket/11.0.4")
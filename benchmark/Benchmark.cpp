@@ -0,0 +1,165 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace enjin::sdk::benchmark {
+
+namespace {
+
+constexpr int WarmUpRuns = 20;
+constexpr int Samples = 15;
+constexpr std::chrono::milliseconds MinSampleDuration(20);
+
+/// Keeps the results of operations observable so that the compiler cannot drop them.
+volatile std::size_t sink = 0;
+
+}
+
+void run(const std::string& name, std::size_t bytes, const std::function<std::size_t()>& operation) {
+    using Clock = std::chrono::steady_clock;
+
+    for (int i = 0; i < WarmUpRuns; i++) {
+        sink = sink + operation();
+    }
+
+    // Sizes samples by the warm-up so that quick operations are not dominated by the resolution of the clock
+    int runs_per_sample = 1;
+    while (true) {
+        const auto start = Clock::now();
+        for (int i = 0; i < runs_per_sample; i++) {
+            sink = sink + operation();
+        }
+
+        if (Clock::now() - start >= MinSampleDuration) {
+            break;
+        }
+
+        runs_per_sample *= 2;
+    }
+
+    std::vector<double> durations;
+    durations.reserve(Samples);
+    for (int sample = 0; sample < Samples; sample++) {
+        const auto start = Clock::now();
+        for (int i = 0; i < runs_per_sample; i++) {
+            sink = sink + operation();
+        }
+
+        const std::chrono::duration<double, std::micro> duration = Clock::now() - start;
+        durations.push_back(duration.count() / runs_per_sample);
+    }
+
+    std::nth_element(durations.begin(), durations.begin() + Samples / 2, durations.end());
+    const double median = durations[Samples / 2];
+    const double throughput = static_cast<double>(bytes) / median;
+
+    std::printf("%-84s %12.2f us %10.1f MB/s\n", name.c_str(), median, throughput);
+}
+
+std::string create_asset_page(std::size_t count) {
+    std::string page = R"({"data":{"result":{"items":[)";
+
+    for (std::size_t i = 0; i < count; i++) {
+        const std::string id = std::to_string(0x7000000000000000 + i * 0x1000);
+        const std::string index = std::to_string(i);
+
+        if (i > 0) {
+            page += ',';
+        }
+
+        page += R"({"id":")" + id + R"(","name":"Asset )" + index + R"(","stateData":{"nonFungible":)"
+                + (i % 2 == 0 ? "true" : "false")
+                + R"(,"blockHeight":)" + std::to_string(12000000 + i)
+                + R"(,"creator":"0x1f2e3d4c5b6a79880f1e2d3c4b5a69788f9e0d1c","firstBlock":)"
+                + std::to_string(11000000 + i)
+                + R"(,"reserve":"1000000000000000000","supplyModel":"FIXED","circulatingSupply":"1000",)"
+                + R"("mintableSupply":"0","totalSupply":"1000"},"configData":{"meltFeeRatio":250,)"
+                + R"("meltFeeMaxRatio":5000,"meltValue":"1000000000000000","metadataURI":)"
+                + R"("https://metadata.example.com/assets/)" + id + R"(.json","transferable":"PERMANENT",)"
+                + R"("transferFeeSettings":{"type":"PER_TRANSFER","assetId":"0","value":"10000000000000000"}},)"
+                + R"("variantMode":"NONE","variants":[)";
+
+        for (int variant = 0; variant < 2; variant++) {
+            if (variant > 0) {
+                page += ',';
+            }
+
+            page += R"({"id":)" + std::to_string(i * 2 + variant) + R"(,"assetId":")" + id
+                    + R"(","variantMetadata":{"name":"Variant )" + std::to_string(variant)
+                    + R"(","image":"https://cdn.example.com/images/)" + id + R"(.png"},"usageCount":)"
+                    + std::to_string(variant * 7)
+                    + R"(,"createdAt":"2021-05-01T12:00:00+00:00","updatedAt":"2021-05-02T12:00:00+00:00"})";
+        }
+
+        page += R"(],"createdAt":"2021-05-01T12:00:00+00:00","updatedAt":"2021-05-02T12:00:00+00:00"})";
+    }
+
+    const std::string total = std::to_string(count);
+    page += R"(],"cursor":{"total":)" + total + R"(,"perPage":)" + total + R"(,"currentPage":1,"hasPages":false,)"
+            + R"("from":1,"to":)" + total + R"(,"lastPage":1,"hasMorePages":false}}}})";
+
+    return page;
+}
+
+std::string create_transaction_page(std::size_t count) {
+    std::string page = R"({"data":{"result":{"items":[)";
+
+    for (std::size_t i = 0; i < count; i++) {
+        const std::string id = std::to_string(i + 1);
+        const std::string hash = "0x" + std::string(60, 'a') + std::to_string(1000 + i);
+
+        if (i > 0) {
+            page += ',';
+        }
+
+        page += R"({"id":)" + id + R"(,"transactionId":")" + hash + R"(","title":"Send Asset )" + id
+                + R"(","contract":"0x8ee5a63b4b8a9f7e8b9c2d3e4f5a6b7c8d9e0f1a","type":"SEND","value":"1",)"
+                + R"("retryState":"NONE","state":"EXECUTED","accepted":true,"projectWallet":false,)"
+                + R"("blockchainData":{"encodedData":"0x)" + std::string(136, 'b')
+                + R"(","signedTransaction":"0x)" + std::string(200, 'c')
+                + R"(","signedBackupTransaction":null,"signedCancelTransaction":null,"receipt":{"blockHash":")"
+                + hash + R"(","blockNumber":)" + std::to_string(12000000 + i)
+                + R"(,"cumulativeGasUsed":210000,"gasUsed":52000,)"
+                + R"("from":"0x1f2e3d4c5b6a79880f1e2d3c4b5a69788f9e0d1c",)"
+                + R"("to":"0x8ee5a63b4b8a9f7e8b9c2d3e4f5a6b7c8d9e0f1a","transactionHash":")" + hash
+                + R"(","transactionIndex":3,"status":true,"logs":[{"blockNumber":)" + std::to_string(12000000 + i)
+                + R"(,"address":"0x8ee5a63b4b8a9f7e8b9c2d3e4f5a6b7c8d9e0f1a","transactionHash":")" + hash
+                + R"(","data":["0x01"],"topics":["0x)" + std::string(64, 'd')
+                + R"json("],"event":{"name":"Transfer","signature":"Transfer(address,address,uint256,uint256)",)json"
+                + R"("encodedSignature":"0x)" + std::string(64, 'e') + R"("}}]},"error":null,"nonce":")"
+                + id + R"("},"project":{"uuid":"5c3b4d2e-1a2b-4c3d-8e9f-0a1b2c3d4e5f","name":"Project",)"
+                + R"("description":"A project","image":"https://cdn.example.com/project.png",)"
+                + R"("createdAt":"2021-05-01T12:00:00+00:00","updatedAt":"2021-05-02T12:00:00+00:00"},)"
+                + R"("asset":{"id":"7000000000000)" + id + R"(","name":"Asset )" + id
+                + R"(","createdAt":"2021-05-01T12:00:00+00:00","updatedAt":"2021-05-02T12:00:00+00:00"},)"
+                + R"("wallet":{"ethAddress":"0x1f2e3d4c5b6a79880f1e2d3c4b5a69788f9e0d1c","enjAllowance":100.5,)"
+                + R"("enjBalance":2000.25,"ethBalance":1.5},)"
+                + R"("createdAt":"2021-05-01T12:00:00+00:00","updatedAt":"2021-05-02T12:00:00+00:00"})";
+    }
+
+    const std::string total = std::to_string(count);
+    page += R"(],"cursor":{"total":)" + total + R"(,"perPage":)" + total + R"(,"currentPage":1,"hasPages":false,)"
+            + R"("from":1,"to":)" + total + R"(,"lastPage":1,"hasMorePages":false}}}})";
+
+    return page;
+}
+
+}
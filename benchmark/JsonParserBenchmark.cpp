@@ -0,0 +1,179 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.hpp"
+
+#include "enjinsdk/GraphqlResponse.hpp"
+#include "enjinsdk/models/Asset.hpp"
+#include "JsonParser.hpp"
+#include "rapidjson/document.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if ENJINSDK_BENCHMARK_SIMDJSON
+
+#include "JsonParseLimiter.hpp"
+#include "simdjson.h"
+
+#endif
+
+using namespace enjin::sdk::benchmark;
+using namespace enjin::sdk::json;
+using namespace enjin::sdk::models;
+using namespace enjin::sdk::graphql;
+
+namespace {
+
+/// Names the SIMD instruction set RapidJSON was built to parse with, as set by the ENJINSDK_JSON_SIMD option.
+const char* get_rapidjson_simd() {
+#if defined(RAPIDJSON_SSE42)
+    return "SSE4.2";
+#elif defined(RAPIDJSON_SSE2)
+    return "SSE2";
+#elif defined(RAPIDJSON_NEON)
+    return "NEON";
+#else
+    return "none";
+#endif
+}
+
+#if ENJINSDK_BENCHMARK_SIMDJSON
+
+/// Replays a simdjson element into a rapidjson document through the parse limits, as a simdjson backend feeding the
+/// SDK's document model would have to.
+bool write_element(JsonParseLimiter<rapidjson::Document>& handler, simdjson::dom::element element) {
+    switch (element.type()) {
+        case simdjson::dom::element_type::ARRAY: {
+            const simdjson::dom::array array = element.get_array().value_unsafe();
+            rapidjson::SizeType count = 0;
+            if (!handler.StartArray()) {
+                return false;
+            }
+
+            for (simdjson::dom::element child: array) {
+                if (!write_element(handler, child)) {
+                    return false;
+                }
+
+                count++;
+            }
+
+            return handler.EndArray(count);
+        }
+        case simdjson::dom::element_type::OBJECT: {
+            const simdjson::dom::object object = element.get_object().value_unsafe();
+            rapidjson::SizeType count = 0;
+            if (!handler.StartObject()) {
+                return false;
+            }
+
+            for (simdjson::dom::key_value_pair field: object) {
+                if (!handler.Key(field.key.data(), static_cast<rapidjson::SizeType>(field.key.size()), true)
+                    || !write_element(handler, field.value)) {
+                    return false;
+                }
+
+                count++;
+            }
+
+            return handler.EndObject(count);
+        }
+        case simdjson::dom::element_type::INT64:
+            return handler.Int64(element.get_int64().value_unsafe());
+        case simdjson::dom::element_type::UINT64:
+            return handler.Uint64(element.get_uint64().value_unsafe());
+        case simdjson::dom::element_type::DOUBLE:
+            return handler.Double(element.get_double().value_unsafe());
+        case simdjson::dom::element_type::STRING: {
+            std::string_view value = element.get_string().value_unsafe();
+            return handler.String(value.data(), static_cast<rapidjson::SizeType>(value.size()), true);
+        }
+        case simdjson::dom::element_type::BOOL:
+            return handler.Bool(element.get_bool().value_unsafe());
+        case simdjson::dom::element_type::NULL_VALUE:
+        default:
+            return handler.Null();
+    }
+}
+
+void run_simdjson_benchmarks(const std::string& label, const std::string& page) {
+    simdjson::dom::parser parser;
+    const simdjson::padded_string padded(page);
+
+    run("simdjson DOM " + label, page.size(), [&parser, &padded]() {
+        return static_cast<std::size_t>(parser.parse(padded).error() == simdjson::SUCCESS);
+    });
+
+    run("simdjson DOM replayed into rapidjson::Document " + label, page.size(), [&parser, &padded]() {
+        const auto result = parser.parse(padded);
+        if (result.error() != simdjson::SUCCESS) {
+            return std::size_t(0);
+        }
+
+        const simdjson::dom::element root = result.value_unsafe();
+        bool is_written = false;
+        auto generator = [root, &is_written](rapidjson::Document& handler) {
+            JsonParseLimiter<rapidjson::Document> limiter(handler);
+
+            is_written = write_element(limiter, root);
+            return is_written;
+        };
+
+        rapidjson::Document document;
+        document.Populate(generator);
+        return static_cast<std::size_t>(is_written);
+    });
+}
+
+#endif
+
+}
+
+namespace enjin::sdk::benchmark {
+
+void run_json_parser_benchmarks() {
+    // Numbers are only comparable between runs against the same RapidJSON release and instruction set
+    std::printf("RapidJSON %s, SIMD: %s\n", RAPIDJSON_VERSION_STRING, get_rapidjson_simd());
+
+    for (std::size_t count: {10, 100}) {
+        const std::string page = create_asset_page(count);
+        const std::string label = "(" + std::to_string(count) + " assets)";
+
+        run("parse_document " + label, page.size(), [&page]() {
+            rapidjson::Document document;
+            return static_cast<std::size_t>(parse_document(document, page));
+        });
+
+        // The copy stands in for the response body a GraphqlResponse takes ownership of
+        run("parse_document_in_situ, including a copy of the text " + label, page.size(), [&page]() {
+            std::string raw(page);
+            rapidjson::Document document;
+            return static_cast<std::size_t>(parse_document_in_situ(document, raw));
+        });
+
+#if ENJINSDK_BENCHMARK_SIMDJSON
+        run_simdjson_benchmarks(label, page);
+#endif
+
+        run("GraphqlResponse<std::vector<Asset>> " + label, page.size(), [&page]() {
+            std::string raw(page);
+            GraphqlResponse<std::vector<Asset>> response(std::move(raw));
+            return response.get_result().has_value() ? response.get_result()->size() : 0;
+        });
+    }
+}
+
+}
@@ -0,0 +1,181 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.hpp"
+
+#include "enjinsdk/GraphqlResponse.hpp"
+#include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "enjinsdk/internal/AbstractGraphqlResponse.hpp"
+#include "enjinsdk/models/ModelArena.hpp"
+#include "enjinsdk/models/PaginationCursor.hpp"
+#include "enjinsdk/models/Transaction.hpp"
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace enjin::sdk::benchmark;
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::json;
+using namespace enjin::sdk::models;
+
+namespace {
+
+/// Reads a field of every nested model of a transaction, returning a value derived from them.
+std::size_t read_nested_models(const Transaction& transaction) {
+    std::size_t read = 0;
+
+    read += transaction.get_blockchain_data().has_value()
+            && transaction.get_blockchain_data()->get_receipt().has_value();
+    read += transaction.get_project().has_value() && transaction.get_project()->get_name().has_value();
+    read += transaction.get_asset().has_value() && transaction.get_asset()->get_id().has_value();
+    read += transaction.get_wallet().has_value() && transaction.get_wallet()->get_eth_address().has_value();
+
+    return read;
+}
+
+/// Reads the transactions of a list response as GraphqlResponse does, except that the response is not shared with
+/// them, so that their nested models are decoded while the response is read.
+class EagerTransactionList final : public AbstractGraphqlResponse {
+public:
+    explicit EagerTransactionList(const std::string& raw) {
+        PagedModelArenaScope scope;
+
+        process_list(
+                raw,
+                [this, &scope](const JsonView& item) {
+                    scope.begin_item();
+
+                    Transaction transaction;
+                    transaction.deserialize(item);
+                    transactions.push_back(std::move(transaction));
+                },
+                [](const JsonView&) {
+                });
+    }
+
+    [[nodiscard]] const std::optional<PaginationCursor>& get_cursor() const override {
+        return cursor;
+    }
+
+    [[nodiscard]] const std::vector<Transaction>& get_transactions() const {
+        return transactions;
+    }
+
+    [[nodiscard]] bool is_empty() const noexcept override {
+        return transactions.empty();
+    }
+
+    [[nodiscard]] bool is_paginated() const noexcept override {
+        return false;
+    }
+
+private:
+    std::optional<PaginationCursor> cursor;
+    std::vector<Transaction> transactions;
+};
+
+/// Gets the items of the list result in a parsed response.
+JsonView get_items(const JsonValue& response) {
+    JsonView data;
+    JsonView result;
+    JsonView items;
+    const bool has_items = JsonView(response).try_get_object_field("data", data)
+                           && data.try_get_object_field("result", result)
+                           && result.try_get_object_field("items", items);
+
+    return has_items ? items : JsonView();
+}
+
+}
+
+namespace enjin::sdk::benchmark {
+
+void run_model_decoding_benchmarks() {
+    for (std::size_t count: {10, 100}) {
+        const std::string page = create_transaction_page(count);
+        const std::string label = "(" + std::to_string(count) + " transactions)";
+
+        // Parsed once up front, so that only the decoding of the models is timed. Views of a parsed document do not
+        // carry their source, so the nested models are decoded eagerly here, while the models of a response keep
+        // them undecoded until they are read
+        JsonValue response;
+        response.try_parse_as_object(page);
+        const JsonView items = get_items(response);
+
+        run("Transaction::deserialize(), eager " + label, page.size(), [&items]() {
+            std::size_t decoded = 0;
+
+            for (const JsonView item: items.get_array_elements()) {
+                Transaction transaction;
+                transaction.deserialize(item);
+                decoded += transaction.get_id().has_value();
+            }
+
+            return decoded;
+        });
+
+        run("Transaction::deserialize(), eager, reading nested models " + label, page.size(), [&items]() {
+            std::size_t read = 0;
+
+            for (const JsonView item: items.get_array_elements()) {
+                Transaction transaction;
+                transaction.deserialize(item);
+                read += read_nested_models(transaction);
+            }
+
+            return read;
+        });
+
+        run("Response read eagerly " + label, page.size(), [&page]() {
+            EagerTransactionList response(page);
+            return response.get_transactions().size();
+        });
+
+        run("Response read eagerly, reading nested models " + label, page.size(), [&page]() {
+            EagerTransactionList response(page);
+            std::size_t read = 0;
+
+            for (const Transaction& transaction: response.get_transactions()) {
+                read += read_nested_models(transaction);
+            }
+
+            return read;
+        });
+
+        run("GraphqlResponse<std::vector<Transaction>>, lazy " + label, page.size(), [&page]() {
+            std::string raw(page);
+            GraphqlResponse<std::vector<Transaction>> response(std::move(raw));
+            return response.get_result().has_value() ? response.get_result()->size() : 0;
+        });
+
+        run("GraphqlResponse<std::vector<Transaction>>, lazy, reading nested models " + label, page.size(), [&page]() {
+            std::string raw(page);
+            GraphqlResponse<std::vector<Transaction>> response(std::move(raw));
+            std::size_t read = 0;
+
+            if (response.get_result().has_value()) {
+                for (const Transaction& transaction: response.get_result().value()) {
+                    read += read_nested_models(transaction);
+                }
+            }
+
+            return read;
+        });
+    }
+}
+
+}
@@ -0,0 +1,51 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_BENCHMARK_HPP
+#define ENJINSDK_BENCHMARK_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace enjin::sdk::benchmark {
+
+/// \brief Times an operation and prints the median duration of one run along with the throughput over its input.
+/// \param name The name to print for the operation.
+/// \param bytes The size of the input the operation processes in each run.
+/// \param operation The operation, returning a value derived from its output so that it cannot be optimized away.
+void run(const std::string& name, std::size_t bytes, const std::function<std::size_t()>& operation);
+
+/// \brief Creates the JSON body of a GetAssets response holding one page of assets, with the state data, config data
+/// and variants an asset list would request.
+/// \param count The number of assets on the page.
+/// \return The JSON body.
+std::string create_asset_page(std::size_t count);
+
+/// \brief Creates the JSON body of a GetTransactions response holding one page of transactions, with the blockchain
+/// data, project, asset and wallet a transaction list would request.
+/// \param count The number of transactions on the page.
+/// \return The JSON body.
+std::string create_transaction_page(std::size_t count);
+
+/// \brief Runs the benchmarks comparing JSON parsers on asset pages.
+void run_json_parser_benchmarks();
+
+/// \brief Runs the benchmarks of decoding models with nested models from transaction pages.
+void run_model_decoding_benchmarks();
+
+}
+
+#endif //ENJINSDK_BENCHMARK_HPP
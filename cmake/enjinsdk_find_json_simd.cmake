@@ -0,0 +1,80 @@
+#[=[
+Finds the SIMD instruction set RapidJSON may use for skipping whitespace while parsing. The checks run on the build
+machine, so binaries built with this must run on CPUs supporting the same instruction set. Sets
+ENJINSDK_JSON_SIMD_DEFINITION to the RapidJSON macro for the instruction set, and ENJINSDK_JSON_SIMD_OPTIONS to the
+compiler options it needs, or leaves both empty if no instruction set is available.
+#]=]
+include(CheckCXXSourceRuns)
+include(CMakePushCheckState)
+
+set(ENJINSDK_JSON_SIMD_DEFINITION "")
+set(ENJINSDK_JSON_SIMD_OPTIONS "")
+
+if (CMAKE_CROSSCOMPILING)
+    message(WARNING "Enjin: ENJINSDK_JSON_SIMD is ignored when cross-compiling, as the CPU must be checked")
+    return()
+endif ()
+
+if (MSVC)
+    set(ENJINSDK_SSE42_OPTIONS "")
+    set(ENJINSDK_SSE2_OPTIONS "")
+else ()
+    set(ENJINSDK_SSE42_OPTIONS "-msse4.2")
+    set(ENJINSDK_SSE2_OPTIONS "-msse2")
+endif ()
+
+cmake_push_check_state(RESET)
+set(CMAKE_REQUIRED_QUIET ON)
+set(CMAKE_REQUIRED_FLAGS "${ENJINSDK_SSE42_OPTIONS}")
+check_cxx_source_runs([[
+#include <nmmintrin.h>
+int main() {
+    alignas(16) const char whitespace[16] = {0x20, 0x0A, 0x0D, 0x09};
+    alignas(16) const char text[16] = {0x20, 0x09, 0x7B, 0x7D};
+    const __m128i w = _mm_load_si128(reinterpret_cast<const __m128i*>(whitespace));
+    const __m128i s = _mm_load_si128(reinterpret_cast<const __m128i*>(text));
+    const int index = _mm_cmpistri(w, s, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT
+                                         | _SIDD_NEGATIVE_POLARITY);
+    return index == 2 ? 0 : 1;
+}
+]] ENJINSDK_HAS_SSE42)
+
+set(CMAKE_REQUIRED_FLAGS "${ENJINSDK_SSE2_OPTIONS}")
+check_cxx_source_runs([[
+#include <emmintrin.h>
+int main() {
+    alignas(16) const char text[16] = {0x20, 0x20, 0x7B, 0x7D};
+    const __m128i s = _mm_load_si128(reinterpret_cast<const __m128i*>(text));
+    const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(s, _mm_set1_epi8(0x20)));
+    return mask == 0x3 ? 0 : 1;
+}
+]] ENJINSDK_HAS_SSE2)
+
+set(CMAKE_REQUIRED_FLAGS "")
+check_cxx_source_runs([[
+#include <arm_neon.h>
+int main() {
+    const uint8_t text[16] = {0x20, 0x20, 0x7B, 0x7D};
+    const uint8x16_t s = vld1q_u8(text);
+    const uint8x16_t spaces = vceqq_u8(s, vdupq_n_u8(0x20));
+    return vgetq_lane_u8(spaces, 1) == 0xFF && vgetq_lane_u8(spaces, 2) == 0 ? 0 : 1;
+}
+]] ENJINSDK_HAS_NEON)
+cmake_pop_check_state()
+
+if (ENJINSDK_HAS_SSE42)
+    set(ENJINSDK_JSON_SIMD_DEFINITION "RAPIDJSON_SSE42")
+    set(ENJINSDK_JSON_SIMD_OPTIONS "${ENJINSDK_SSE42_OPTIONS}")
+elseif (ENJINSDK_HAS_SSE2)
+    set(ENJINSDK_JSON_SIMD_DEFINITION "RAPIDJSON_SSE2")
+    set(ENJINSDK_JSON_SIMD_OPTIONS "${ENJINSDK_SSE2_OPTIONS}")
+elseif (ENJINSDK_HAS_NEON)
+    set(ENJINSDK_JSON_SIMD_DEFINITION "RAPIDJSON_NEON")
+endif ()
+
+if ("${ENJINSDK_JSON_SIMD_DEFINITION}" STREQUAL "")
+    message(WARNING "Enjin: ENJINSDK_JSON_SIMD is on, but the CPU supports none of SSE4.2, SSE2 or NEON")
+endif ()
+
+unset(ENJINSDK_SSE42_OPTIONS)
+unset(ENJINSDK_SSE2_OPTIONS)
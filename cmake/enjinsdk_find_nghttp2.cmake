@@ -0,0 +1,10 @@
+find_path(NGHTTP2_INCLUDE_DIRS "nghttp2/nghttp2.h")
+find_library(NGHTTP2_LIBRARIES nghttp2)
+
+if (${NGHTTP2_INCLUDE_DIRS} STREQUAL "NGHTTP2_INCLUDE_DIRS-NOTFOUND"
+        OR ${NGHTTP2_LIBRARIES} STREQUAL "NGHTTP2_LIBRARIES-NOTFOUND")
+    message(STATUS "Enjin: Did not find nghttp2")
+else ()
+    set(ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL 1)
+    message(STATUS "Enjin: Found nghttp2")
+endif ()
@@ -0,0 +1,3 @@
+find_package(ZLIB
+        QUIET
+        REQUIRED)
@@ -10,6 +10,18 @@ macro(set_include_http_client_impl_macro)
     endif ()
 endmacro()
 
+macro(set_include_http2_client_impl_macro)
+    target_compile_definitions(${PROJECT_NAME}
+            PUBLIC
+            ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL=${ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL})
+
+    if (${ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL})
+        message(STATUS "Enjin: HTTP/2 client available for platform clients")
+    else ()
+        message(STATUS "Enjin: HTTP/2 client not available for platform clients")
+    endif ()
+endmacro()
+
 macro(set_include_websocket_client_impl_macro)
     target_compile_definitions(${PROJECT_NAME}
             PUBLIC
@@ -22,6 +34,25 @@ macro(set_include_websocket_client_impl_macro)
     endif ()
 endmacro()
 
+macro(set_include_epoll_tls_macro)
+    target_compile_definitions(${PROJECT_NAME}
+            PUBLIC
+            ENJINSDK_INCLUDE_EPOLL_TLS=${ENJINSDK_INCLUDE_EPOLL_TLS})
+
+    if (${ENJINSDK_INCLUDE_EPOLL_TLS})
+        message(STATUS "Enjin: HTTPS available for epoll HTTP client")
+    elseif (CMAKE_SYSTEM_NAME STREQUAL "Linux")
+        message(STATUS "Enjin: HTTPS not available for epoll HTTP client")
+    endif ()
+endmacro()
+
+macro(set_json_simd_macro target)
+    if (NOT "${ENJINSDK_JSON_SIMD_DEFINITION}" STREQUAL "")
+        target_compile_definitions(${target} PRIVATE ${ENJINSDK_JSON_SIMD_DEFINITION})
+        target_compile_options(${target} PRIVATE ${ENJINSDK_JSON_SIMD_OPTIONS})
+    endif ()
+endmacro()
+
 macro(set_version_macro)
     target_compile_definitions(${PROJECT_NAME} PRIVATE ENJINSDK_VERSION="${PROJECT_VERSION}")
 endmacro()
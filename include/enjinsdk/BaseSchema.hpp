@@ -17,19 +17,34 @@
 #define ENJINCPPSDK_BASESCHEMA_HPP
 
 #include "enjinsdk_export.h"
+#include "enjinsdk/ComposedQuery.hpp"
+#include "enjinsdk/GraphqlCallback.hpp"
 #include "enjinsdk/GraphqlResponse.hpp"
+#include "enjinsdk/IExecutor.hpp"
 #include "enjinsdk/LoggerProvider.hpp"
 #include "enjinsdk/ClientMiddleware.hpp"
 #include "enjinsdk/internal/AbstractGraphqlRequest.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <exception>
+#include <functional>
 #include <future>
+#include <map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace enjin::sdk {
 
+namespace graphql {
+class GraphqlBatcher;
+}
+
 /// \brief Base class for schema with functionality to send GraphQL requests to the platform and process the responses.
 class ENJINSDK_EXPORT BaseSchema {
 public:
@@ -39,13 +54,64 @@ public:
 
     BaseSchema(BaseSchema&&) = delete;
 
-    /// \brief Default destructor.
-    ~BaseSchema() = default;
+    /// \brief Destructor.
+    /// \remarks Sends the requests still waiting for their batch and waits for the callbacks of requests sent without
+    /// an executor to have run.
+    ~BaseSchema();
+
+    /// \brief Creates an empty set of queries to be sent to the platform together as a single GraphQL document.
+    /// \return The set of queries, which must not outlive this schema.
+    /// \remarks Use this to read several unrelated objects with one request instead of one request per object.
+    [[nodiscard]] ComposedQuery compose_queries();
+
+    /// \brief Sends the requests waiting for their batch without waiting for the batch to fill or for its deadline.
+    void flush_request_batch();
 
     /// \brief Returns the logger provider used by this schema.
     /// \return The logger provider.
     [[nodiscard]] const std::shared_ptr<utils::LoggerProvider>& get_logger_provider() const;
 
+    /// \brief Returns the number of requests which shared the response of an identical request instead of being sent.
+    /// \return The number of requests.
+    [[nodiscard]] std::size_t get_coalesced_request_count() const;
+
+    /// \brief Returns the memory resource the arenas of the models of list responses take their blocks from.
+    /// \return The memory resource, which is the default memory resource if none was set.
+    [[nodiscard]] std::pmr::memory_resource* get_model_memory_resource() const;
+
+    /// \brief Returns whether identical queries sent concurrently by this schema share one request to the platform.
+    /// \return Whether request coalescing is enabled.
+    [[nodiscard]] bool is_request_coalescing_enabled() const;
+
+    /// \brief Returns whether requests sent by this schema are collected into batches.
+    /// \return Whether request batching is enabled.
+    [[nodiscard]] bool is_request_batching_enabled() const;
+
+    /// \brief Sets whether requests sent by this schema are collected into batches, which are sent to the platform as
+    /// one JSON array.
+    /// \param max_batch_size The number of requests at which a batch is sent. Batching is disabled if this is less than
+    /// two.
+    /// \param max_delay The maximum time a request waits for its batch to fill before the batch is sent anyway.
+    /// \remarks The response array is split back into the response for each request, so each request still completes
+    /// its own future or callback. Requests in a batch are not coalesced. The requests waiting in the previous batch,
+    /// if any, are sent when this is called. Disabled by default.
+    void set_request_batching(std::size_t max_batch_size, std::chrono::milliseconds max_delay);
+
+    /// \brief Sets whether identical queries sent concurrently by this schema share one request to the platform.
+    /// \param enabled Whether to enable request coalescing.
+    /// \remarks Queries are identical if they have the same template key and serialized variables. A query sent while
+    /// an identical query is in-flight waits for the response of that query instead of being sent, after which each
+    /// caller receives its own copy of the response. Mutations are never coalesced. Disabled by default.
+    void set_request_coalescing(bool enabled);
+
+    /// \brief Sets the memory resource the arenas of the models of list responses received afterwards take their
+    /// blocks from.
+    /// \param resource The memory resource, or null for the default memory resource at the time each response is
+    /// received.
+    /// \remarks The resource must outlive every model of those responses, and must be usable from any thread since a
+    /// model may be destroyed on any thread.
+    void set_model_memory_resource(std::pmr::memory_resource* resource);
+
 protected:
     /// \brief The middleware for communicating with the platform.
     const std::unique_ptr<ClientMiddleware> middleware;
@@ -56,13 +122,19 @@ protected:
     /// \brief The name of this schema.
     const std::string schema;
 
+    /// \brief The executor which runs requests sent by this schema.
+    const std::shared_ptr<utils::IExecutor> executor;
+
     /// \brief Constructs an instance of this class.
     /// \param http_client The HTTP client.
     /// \param schema The name of the schema.
     /// \param logger_provider The logger provider. Null pointer by default.
+    /// \param executor The executor for running requests. Null pointer by default.
+    /// \remarks If no executor is given, then each request is run with std::async.
     BaseSchema(std::unique_ptr<http::IHttpClient> http_client,
                std::string schema,
-               std::shared_ptr<utils::LoggerProvider> logger_provider = nullptr);
+               std::shared_ptr<utils::LoggerProvider> logger_provider = nullptr,
+               std::shared_ptr<utils::IExecutor> executor = nullptr);
 
     /// \brief Creates the serialized request body to be sent to the platform.
     /// \param request The request.
@@ -80,15 +152,16 @@ protected:
     /// \return The future containing the response.
     template<class T>
     std::future<graphql::GraphqlResponse<T>> send_request_for_one(graphql::AbstractGraphqlRequest& request) {
-        return std::async([this, http_request = create_request(request)] {
-            try {
-                auto http_response = send_request(http_request);
-                return graphql::GraphqlResponse<T>(http_response.get_body().value());
-            } catch (const std::exception& e) {
-                log_graphql_exception(e);
-                throw e;
-            }
-        });
+        return send_request_for<T>(request);
+    }
+
+    /// \brief Sends a request for one object from the platform and passes the response to a callback.
+    /// \tparam T The type contained by the response.
+    /// \param request The request to being sent.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    template<class T>
+    void send_request_for_one(graphql::AbstractGraphqlRequest& request, graphql::GraphqlCallback<T> callback) {
+        send_request_for<T>(request, std::move(callback));
     }
 
     /// \brief Sends a request for many objects from the platform.
@@ -98,23 +171,179 @@ protected:
     template<class T>
     std::future<graphql::GraphqlResponse<std::vector<T>>>
     send_request_for_many(graphql::AbstractGraphqlRequest& request) {
-        return std::async([this, http_request = create_request(request)]() {
+        return send_request_for<std::vector<T>>(request);
+    }
+
+    /// \brief Sends a request for many objects from the platform and passes the response to a callback.
+    /// \tparam T The type contained the response's vector.
+    /// \param request The request to being sent.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    template<class T>
+    void send_request_for_many(graphql::AbstractGraphqlRequest& request,
+                               graphql::GraphqlCallback<std::vector<T>> callback) {
+        send_request_for<std::vector<T>>(request, std::move(callback));
+    }
+
+    /// \brief Sends a request for many objects from the platform, decoding them into a result table.
+    /// \tparam T The model of the objects in the table.
+    /// \param request The request to being sent.
+    /// \return The future containing the response.
+    template<class T>
+    std::future<graphql::GraphqlResponse<models::ResultTable<T>>>
+    send_request_for_table(graphql::AbstractGraphqlRequest& request) {
+        return send_request_for<models::ResultTable<T>>(request);
+    }
+
+    /// \brief Sends a request for many objects from the platform, decoding them into a result table, and passes the
+    /// response to a callback.
+    /// \tparam T The model of the objects in the table.
+    /// \param request The request to being sent.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    template<class T>
+    void send_request_for_table(graphql::AbstractGraphqlRequest& request,
+                                graphql::GraphqlCallback<models::ResultTable<T>> callback) {
+        send_request_for<models::ResultTable<T>>(request, std::move(callback));
+    }
+
+private:
+    static constexpr char JSON[] = "application/json; charset=utf-8";
+
+    std::mutex detached_tasks_mutex;
+    std::vector<std::future<void>> detached_tasks;
+
+    std::atomic<bool> request_coalescing_enabled = false;
+    std::atomic<std::size_t> coalesced_request_count = 0;
+    std::mutex in_flight_queries_mutex;
+    std::map<std::string, std::shared_future<http::HttpResponse>> in_flight_queries;
+
+    std::atomic<std::pmr::memory_resource*> model_memory_resource = nullptr;
+
+    std::atomic<bool> request_batching_enabled = false;
+    std::mutex batcher_mutex;
+    std::shared_ptr<graphql::GraphqlBatcher> batcher;
+
+    [[nodiscard]] std::string create_coalescing_key(graphql::AbstractGraphqlRequest& request) const;
+
+    /// \brief Determines whether the operation of the request is a query, which may be sent again without effect.
+    /// \param request The request.
+    /// \return Whether the operation is a query.
+    [[nodiscard]] bool is_query(graphql::AbstractGraphqlRequest& request) const;
+
+    void log_callback_exception(const std::exception& e);
+
+    void log_graphql_exception(const std::exception& e);
+
+    template<class R>
+    std::future<graphql::GraphqlResponse<R>> send_request_for(graphql::AbstractGraphqlRequest& request) {
+        if (request_batching_enabled) {
+            auto promise = std::make_shared<std::promise<graphql::GraphqlResponse<R>>>();
+            auto completion = [this, promise](std::shared_future<http::HttpResponse> response) {
+                auto task = create_batched_task<R>(std::move(response));
+                try {
+                    promise->set_value(task());
+                } catch (...) {
+                    promise->set_exception(std::current_exception());
+                }
+            };
+
+            if (enqueue_batched(request, std::move(completion))) {
+                return promise->get_future();
+            }
+        }
+
+        return submit(create_task<R>(request));
+    }
+
+    template<class R>
+    void send_request_for(graphql::AbstractGraphqlRequest& request, graphql::GraphqlCallback<R> callback) {
+        if (request_batching_enabled) {
+            auto completion = [this, callback](std::shared_future<http::HttpResponse> response) {
+                run_with_callback(create_batched_task<R>(std::move(response)), callback);
+            };
+
+            if (enqueue_batched(request, std::move(completion))) {
+                return;
+            }
+        }
+
+        submit_with_callback(create_task<R>(request), std::move(callback));
+    }
+
+    template<class R>
+    auto create_task(graphql::AbstractGraphqlRequest& request) {
+        return [this,
+                http_request = create_request(request),
+                coalescing_key = create_coalescing_key(request)]() mutable {
             try {
-                auto http_response = send_request(std::move(http_request));
-                return graphql::GraphqlResponse<std::vector<T>>(http_response.get_body().value());
+                auto http_response = send_request(std::move(http_request), coalescing_key);
+                return graphql::create_graphql_response<R>(http_response.take_body().value(),
+                                                           get_model_memory_resource());
             } catch (const std::exception& e) {
                 log_graphql_exception(e);
-                throw e;
+                throw;
             }
+        };
+    }
+
+    template<class R>
+    auto create_batched_task(std::shared_future<http::HttpResponse> response) {
+        return [this, response = std::move(response)]() {
+            try {
+                return graphql::create_graphql_response<R>(response.get().get_body().value(),
+                                                           get_model_memory_resource());
+            } catch (const std::exception& e) {
+                log_graphql_exception(e);
+                throw;
+            }
+        };
+    }
+
+    template<class F>
+    std::future<std::invoke_result_t<F>> submit(F task) {
+        if (executor == nullptr) {
+            return std::async(std::move(task));
+        }
+
+        return executor->submit(std::move(task));
+    }
+
+    template<class F, class R = std::invoke_result_t<F>>
+    void submit_with_callback(F task, std::function<void(std::future<R>)> callback) {
+        dispatch([this, task = std::move(task), callback = std::move(callback)]() mutable {
+            run_with_callback(task, callback);
         });
     }
 
-private:
-    static constexpr char JSON[] = "application/json; charset=utf-8";
+    template<class F, class R = std::invoke_result_t<F>>
+    void run_with_callback(F&& task, const std::function<void(std::future<R>)>& callback) {
+        std::promise<R> promise;
+        try {
+            promise.set_value(task());
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
 
-    void log_graphql_exception(const std::exception& e);
+        // Exceptions thrown by the callback must not escape onto the executor's worker
+        try {
+            callback(promise.get_future());
+        } catch (const std::exception& e) {
+            log_callback_exception(e);
+        } catch (...) {
+        }
+    }
+
+    [[nodiscard]] http::HttpRequest create_request(std::string body) const;
+
+    void dispatch(std::function<void()> task);
+
+    bool enqueue_batched(graphql::AbstractGraphqlRequest& request,
+                         std::function<void(std::shared_future<http::HttpResponse>)> completion);
+
+    void track_detached_task(std::future<void> task);
+
+    http::HttpResponse send_request(http::HttpRequest request, const std::string& coalescing_key);
 
-    http::HttpResponse send_request(http::HttpRequest request);
+    friend class ComposedQuery;
 };
 
 }
@@ -0,0 +1,124 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_COMPOSEDQUERY_HPP
+#define ENJINSDK_COMPOSEDQUERY_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/GraphqlResponse.hpp"
+#include "enjinsdk/internal/AbstractGraphqlRequest.hpp"
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace enjin::sdk {
+
+class BaseSchema;
+
+namespace graphql {
+class GraphqlQueryComposer;
+}
+
+/// \brief Set of queries which are sent to the platform together as a single GraphQL document.
+/// \remarks Each query added to this set becomes an aliased field of the document and keeps its own future, which is
+/// completed with the part of the response for that query once the document is sent. Only queries may be composed.
+/// The futures of queries which are never sent fail with std::future_error.
+class ENJINSDK_EXPORT ComposedQuery {
+public:
+    ComposedQuery() = delete;
+
+    ComposedQuery(const ComposedQuery&) = delete;
+
+    ComposedQuery(ComposedQuery&& other) noexcept;
+
+    ~ComposedQuery();
+
+    /// \brief Adds a query for one object to this set.
+    /// \tparam T The type contained by the response.
+    /// \param request The request.
+    /// \return The future containing the response, which is completed once this set is sent.
+    /// \throws std::runtime_error If the request is not for a query.
+    template<class T>
+    std::future<graphql::GraphqlResponse<T>> add_for_one(const graphql::AbstractGraphqlRequest& request) {
+        return add_for<T>(request);
+    }
+
+    /// \brief Adds a query for many objects to this set.
+    /// \tparam T The type contained by the response's vector.
+    /// \param request The request.
+    /// \return The future containing the response, which is completed once this set is sent.
+    /// \throws std::runtime_error If the request is not for a query.
+    template<class T>
+    std::future<graphql::GraphqlResponse<std::vector<T>>>
+    add_for_many(const graphql::AbstractGraphqlRequest& request) {
+        return add_for<std::vector<T>>(request);
+    }
+
+    /// \brief Sends the queries in this set as one request and clears this set for reuse.
+    /// \remarks Does nothing if this set is empty.
+    void send();
+
+    /// \brief Returns the number of queries in this set.
+    /// \return The number of queries.
+    [[nodiscard]] std::size_t size() const;
+
+    ComposedQuery& operator=(const ComposedQuery&) = delete;
+
+    ComposedQuery& operator=(ComposedQuery&&) = delete;
+
+private:
+    using Completion = std::function<void(std::shared_future<std::string>)>;
+
+    BaseSchema* schema;
+    std::unique_ptr<graphql::GraphqlQueryComposer> composer;
+    std::vector<Completion> completions;
+
+    explicit ComposedQuery(BaseSchema& schema);
+
+    template<class R>
+    std::future<graphql::GraphqlResponse<R>> add_for(const graphql::AbstractGraphqlRequest& request) {
+        auto promise = std::make_shared<std::promise<graphql::GraphqlResponse<R>>>();
+        add(request, [schema = schema, promise](std::shared_future<std::string> response_body) {
+            try {
+                promise->set_value(graphql::create_graphql_response<R>(response_body.get(),
+                                                                       get_model_memory_resource(*schema)));
+            } catch (const std::exception& e) {
+                log_exception(*schema, e);
+                promise->set_exception(std::current_exception());
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        });
+
+        return promise->get_future();
+    }
+
+    void add(const graphql::AbstractGraphqlRequest& request, Completion completion);
+
+    static void log_exception(BaseSchema& schema, const std::exception& e);
+
+    static std::pmr::memory_resource* get_model_memory_resource(BaseSchema& schema);
+
+    friend class BaseSchema;
+};
+
+}
+
+#endif //ENJINSDK_COMPOSEDQUERY_HPP
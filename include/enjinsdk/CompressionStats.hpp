@@ -0,0 +1,49 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_COMPRESSIONSTATS_HPP
+#define ENJINSDK_COMPRESSIONSTATS_HPP
+
+#include "enjinsdk_export.h"
+#include <cstddef>
+
+namespace enjin::sdk::http {
+
+/// \brief Running totals of the bytes saved by the compression of an HTTP client.
+/// \remarks The bytes saved for requests are the difference between the uncompressed and compressed request bytes,
+/// and likewise for responses.
+struct ENJINSDK_EXPORT CompressionStats {
+    /// \brief The number of request bodies which were sent compressed.
+    std::size_t requests_compressed = 0;
+
+    /// \brief The total size of the compressed request bodies before compression.
+    std::size_t request_bytes_uncompressed = 0;
+
+    /// \brief The total size of the compressed request bodies after compression.
+    std::size_t request_bytes_compressed = 0;
+
+    /// \brief The number of response bodies which were received compressed.
+    std::size_t responses_decompressed = 0;
+
+    /// \brief The total size of the compressed response bodies as received.
+    std::size_t response_bytes_compressed = 0;
+
+    /// \brief The total size of the compressed response bodies after decompression.
+    std::size_t response_bytes_uncompressed = 0;
+};
+
+}
+
+#endif //ENJINSDK_COMPRESSIONSTATS_HPP
@@ -0,0 +1,48 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_CONNECTIONPOOLSTATS_HPP
+#define ENJINSDK_CONNECTIONPOOLSTATS_HPP
+
+#include "enjinsdk_export.h"
+#include <cstddef>
+
+namespace enjin::sdk::http {
+
+/// \brief Snapshot of the occupancy of the connection pool of an HTTP client.
+struct ENJINSDK_EXPORT ConnectionPoolStats {
+    /// \brief The maximum number of connections the pool may hold.
+    std::size_t max_connections = 0;
+
+    /// \brief The number of connections currently checked out for in-flight requests.
+    std::size_t active_connections = 0;
+
+    /// \brief The number of keep-alive connections waiting in the pool.
+    std::size_t idle_connections = 0;
+
+    /// \brief The number of requests waiting for a connection to be checked in.
+    std::size_t waiting_requests = 0;
+
+    /// \brief The total number of connections created by the pool.
+    std::size_t created_connections = 0;
+
+    /// \brief The total number of connections evicted from the pool, either for being idle for too long, for having
+    /// failed or for the client having been stopped.
+    std::size_t evicted_connections = 0;
+};
+
+}
+
+#endif //ENJINSDK_CONNECTIONPOOLSTATS_HPP
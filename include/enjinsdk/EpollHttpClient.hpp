@@ -0,0 +1,122 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+
+#ifndef ENJINSDK_EPOLLHTTPCLIENT_HPP
+#define ENJINSDK_EPOLLHTTPCLIENT_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/IHttpClient.hpp"
+#include "enjinsdk/LoggerProvider.hpp"
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace enjin::sdk::http {
+
+/// \brief Non-blocking HTTP client which drives all of its connections from a single epoll event loop.
+/// \remarks Requests are written and responses read by one I/O thread, which also completes the futures returned by
+/// send_request(). The number of requests in-flight is bound by the maximum number of connections rather than by the
+/// number of threads, with requests beyond that waiting for a connection to be released. Requests are sent as HTTP/1.1,
+/// over TLS if the base URI is HTTPS, in which case the handshake is also driven by the event loop and the certificate
+/// of the server is verified against the default trust store of OpenSSL. A request is sent again over a new connection
+/// if the server closed the keep-alive connection it was sent over before responding, but only if the request is
+/// idempotent.
+class ENJINSDK_EXPORT EpollHttpClient : public IHttpClient {
+public:
+    EpollHttpClient() = delete;
+
+    /// \brief Creates the HTTP client with the base URI.
+    /// \param base_uri The base URI for the client, in the form of "http://host[:port][/path]" or
+    /// "https://host[:port][/path]".
+    /// \param max_connections The maximum number of keep-alive connections to the base URI. At least one connection is
+    /// always allowed.
+    /// \throws std::runtime_error If the base URI is malformed, its scheme is neither HTTP nor HTTPS, or its scheme is
+    /// HTTPS and the SDK was built without OpenSSL.
+    explicit EpollHttpClient(std::string base_uri, std::size_t max_connections = DefaultMaxConnections);
+
+    EpollHttpClient(const EpollHttpClient&) = delete;
+
+    EpollHttpClient(EpollHttpClient&&) = delete;
+
+    /// \brief Destructor.
+    ~EpollHttpClient() override;
+
+    /// \copydoc IHttpClient::start()
+    /// \throws std::runtime_error If the host of the base URI could not be resolved or the event loop could not be
+    /// created.
+    void start() override;
+
+    /// \copydoc IHttpClient::stop()
+    /// \remarks Requests which are still in-flight or waiting for a connection fail with a std::runtime_error.
+    void stop() override;
+
+    std::future<HttpResponse> send_request(HttpRequest request) override;
+
+    /// \brief Returns the base URI of this client.
+    /// \return The URI.
+    [[nodiscard]] const std::string& get_base_uri() const;
+
+    /// \brief Returns the number of requests which have been sent, or are waiting to be sent, and have not completed.
+    /// \return The number of requests.
+    [[nodiscard]] std::size_t get_in_flight_count() const;
+
+    [[nodiscard]] bool is_open() const override;
+
+    void set_default_request_header(std::string key, std::string value) override;
+
+    void set_logger(HttpLogLevel level, std::shared_ptr<utils::LoggerProvider> logger_provider) override;
+
+    /// \brief Sets the timeouts of this client, which apply to requests sent afterwards.
+    /// \param connect_timeout The time allowed for connecting to the server, including the TLS handshake of HTTPS
+    /// connections.
+    /// \param read_timeout The time allowed between receiving parts of a response, and between sending the request and
+    /// receiving the first part of its response.
+    /// \param write_timeout The time allowed for sending a part of a request.
+    /// \remarks Requests which time out fail with a std::runtime_error and are not sent again.
+    void set_timeouts(std::chrono::milliseconds connect_timeout,
+                      std::chrono::milliseconds read_timeout,
+                      std::chrono::milliseconds write_timeout);
+
+    EpollHttpClient& operator=(const EpollHttpClient&) = delete;
+
+    EpollHttpClient& operator=(EpollHttpClient&&) = delete;
+
+    /// \brief The default maximum number of connections.
+    static constexpr std::size_t DefaultMaxConnections = 128;
+
+    /// \brief The default time allowed for connecting, which matches that of HttpClient.
+    static constexpr std::chrono::milliseconds DefaultConnectTimeout = std::chrono::seconds(300);
+
+    /// \brief The default time allowed for reading, which matches that of HttpClient.
+    static constexpr std::chrono::milliseconds DefaultReadTimeout = std::chrono::seconds(5);
+
+    /// \brief The default time allowed for writing, which matches that of HttpClient.
+    static constexpr std::chrono::milliseconds DefaultWriteTimeout = std::chrono::seconds(5);
+
+private:
+    class Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+}
+
+#endif //ENJINSDK_EPOLLHTTPCLIENT_HPP
+
+#endif
@@ -0,0 +1,115 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#ifndef ENJINSDK_GRAPHQLAWAITABLE_HPP
+#define ENJINSDK_GRAPHQLAWAITABLE_HPP
+
+#include "enjinsdk/GraphqlCallback.hpp"
+#include "enjinsdk/GraphqlResponse.hpp"
+#include <coroutine>
+#include <functional>
+#include <future>
+#include <type_traits>
+#include <utility>
+
+namespace enjin::sdk::graphql {
+
+/// \brief Awaitable for the response of a GraphQL request, for use with co_await in C++20 coroutines.
+/// \tparam T The type contained by the response.
+/// \remarks The request is sent when the awaitable is awaited and the awaiting coroutine is resumed by the thread that
+/// completed the request, which is a worker of the schema's executor if one is set. Awaiting rethrows the exception
+/// the request failed with, if any. Since the coroutine runs on that thread once resumed, it must not destroy the
+/// schema which sent the request before its next suspension point.
+template<class T>
+class GraphqlAwaitable {
+public:
+    /// \brief Function which sends the request and passes its outcome to the given callback.
+    using Sender = std::function<void(GraphqlCallback<T>)>;
+
+    GraphqlAwaitable() = delete;
+
+    /// \brief Constructs the awaitable with the function which sends its request.
+    /// \param sender The sender.
+    explicit GraphqlAwaitable(Sender sender) : sender(std::move(sender)) {
+    }
+
+    GraphqlAwaitable(const GraphqlAwaitable&) = delete;
+
+    GraphqlAwaitable(GraphqlAwaitable&&) noexcept = default;
+
+    ~GraphqlAwaitable() = default;
+
+    /// \brief Returns false, as the request is not sent until the coroutine suspends.
+    /// \return Always false.
+    [[nodiscard]] bool await_ready() const noexcept {
+        return false;
+    }
+
+    /// \brief Sends the request and resumes the coroutine with its outcome once it completes.
+    /// \param handle The handle to the awaiting coroutine.
+    void await_suspend(std::coroutine_handle<> handle) {
+        // The coroutine may be resumed, and this awaitable destroyed, before the sender returns
+        Sender send = std::move(sender);
+        send([this, handle](std::future<GraphqlResponse<T>> future) {
+            result = std::move(future);
+            handle.resume();
+        });
+    }
+
+    /// \brief Returns the response of the request.
+    /// \return The response.
+    /// \throws std::exception The exception the request failed with.
+    GraphqlResponse<T> await_resume() {
+        return result.get();
+    }
+
+    GraphqlAwaitable& operator=(const GraphqlAwaitable&) = delete;
+
+    GraphqlAwaitable& operator=(GraphqlAwaitable&&) noexcept = default;
+
+private:
+    Sender sender;
+    std::future<GraphqlResponse<T>> result;
+};
+
+/// \brief Creates an awaitable which sends a request with the callback overload of a schema operation.
+/// \tparam Schema The type of the schema or client.
+/// \tparam Base The class declaring the operation.
+/// \tparam Request The type of the request.
+/// \tparam T The type contained by the response.
+/// \param schema The schema or client to send the request with, which must outlive the awaitable.
+/// \param operation The operation, such as &IProjectSchema::get_balances.
+/// \param request The request.
+/// \return The awaitable.
+/// \remarks Example: <code>auto res = co_await graphql::await_operation(client, &IProjectSchema::get_balances,
+/// GetBalances().value_gt(0));</code>
+template<class Schema, class Base, class Request, class T>
+GraphqlAwaitable<T> await_operation(Schema& schema,
+                                    void (Base::*operation)(Request, GraphqlCallback<T>),
+                                    std::type_identity_t<Request> request) {
+    static_assert(std::is_base_of_v<Base, Schema>, "Schema must derive from the class declaring the operation");
+
+    return GraphqlAwaitable<T>([&schema, operation, request = std::move(request)](GraphqlCallback<T> callback) mutable {
+        (schema.*operation)(std::move(request), std::move(callback));
+    });
+}
+
+}
+
+#endif //ENJINSDK_GRAPHQLAWAITABLE_HPP
+
+#endif
@@ -0,0 +1,34 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_GRAPHQLCALLBACK_HPP
+#define ENJINSDK_GRAPHQLCALLBACK_HPP
+
+#include "enjinsdk/GraphqlResponse.hpp"
+#include <functional>
+#include <future>
+
+namespace enjin::sdk::graphql {
+
+/// \brief Callback which is passed the outcome of a GraphQL request once the request completes.
+/// \tparam T The type contained by the response.
+/// \remarks The future passed to the callback is always ready, so calling get() on it does not block. It either returns
+/// the response or rethrows the exception the request failed with.
+template<class T>
+using GraphqlCallback = std::function<void(std::future<GraphqlResponse<T>>)>;
+
+}
+
+#endif //ENJINSDK_GRAPHQLCALLBACK_HPP
@@ -35,6 +35,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the error message.
     /// \return The error message.
     [[nodiscard]] const std::optional<std::string>& get_message() const;
@@ -20,8 +20,13 @@
 #include "enjinsdk/GraphqlError.hpp"
 #include "enjinsdk/IDeserializable.hpp"
 #include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonView.hpp"
 #include "enjinsdk/internal/AbstractGraphqlResponse.hpp"
+#include "enjinsdk/models/ModelArena.hpp"
 #include "enjinsdk/models/PaginationCursor.hpp"
+#include "enjinsdk/models/ResultTable.hpp"
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -51,7 +56,13 @@ public:
         process(raw);
     };
 
-    GraphqlResponse(const GraphqlResponse<T>& other) : result(other.esult) {
+    /// \brief Constructs the GraphQL response with a JSON string, parsing it in place.
+    /// \param raw The JSON body that is the GraphQL response.
+    explicit GraphqlResponse(std::string&& raw) {
+        process(std::move(raw));
+    };
+
+    GraphqlResponse(const GraphqlResponse<T>& other) : result(other.result) {
     }
 
     GraphqlResponse(GraphqlResponse<T>&& other) noexcept: result(std::move(other.result)) {
@@ -84,7 +95,7 @@ public:
     }
 
 protected:
-    void process_data(const json::JsonValue& data) override {
+    void process_data(const json::JsonView& data) override {
         T new_result;
 
         if (utils::JsonUtils::try_get_object_as_type(data, ResultKey, new_result)) {
@@ -100,9 +111,9 @@ private:
 /// \brief Specialized member function for responses containing booleans instead of platform objects.
 /// \param data_json The JSON string of the member.
 template<>
-inline void GraphqlResponse<bool>::process_data(const json::JsonValue& data) {
+inline void GraphqlResponse<bool>::process_data(const json::JsonView& data) {
     bool new_result;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (data.try_get_object_field(ResultKey, value) && value.try_get_bool(new_result)) {
         result = new_result;
@@ -121,8 +132,26 @@ public:
 
     /// \brief Constructs the GraphQL response with a JSON string.
     /// \param raw The JSON body that is the GraphQL response.
-    explicit GraphqlResponse(const std::string& raw) {
-        process(raw);
+    /// \param upstream The memory resource the arenas of the models of the result take their blocks from. Must
+    /// outlive every model of the result and be usable from any thread which destroys one.
+    /// \remarks The items of the result are deserialized one at a time while the JSON is read, without parsing the
+    /// whole of it into a document first, and the models of every few items are allocated together from an arena.
+    /// Models which keep their nested models undecoded until first accessed share the JSON until then.
+    explicit GraphqlResponse(const std::string& raw,
+                             std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) {
+        process_streamed(std::make_shared<const std::string>(raw), upstream);
+    };
+
+    /// \brief Constructs the GraphQL response with a JSON string.
+    /// \param raw The JSON body that is the GraphQL response.
+    /// \param upstream The memory resource the arenas of the models of the result take their blocks from. Must
+    /// outlive every model of the result and be usable from any thread which destroys one.
+    /// \remarks The items of the result are deserialized one at a time while the JSON is read, without parsing the
+    /// whole of it into a document first, and the models of every few items are allocated together from an arena.
+    /// Models which keep their nested models undecoded until first accessed share the JSON until then.
+    explicit GraphqlResponse(std::string&& raw,
+                             std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) {
+        process_streamed(std::make_shared<const std::string>(std::move(raw)), upstream);
     };
 
     GraphqlResponse(const GraphqlResponse<std::vector<T>>& other) : cursor(other.cursor), result(other.result) {
@@ -159,69 +188,156 @@ public:
         return *this;
     }
 
-protected:
-    void process_data(const json::JsonValue& data) override {
-        if (is_result_paginated(data)) {
-            process_paginated_result(data);
-        } else {
-            process_non_paginated_result(data);
-        }
-    }
-
 private:
     std::optional<models::PaginationCursor> cursor;
     std::optional<std::vector<T>> result;
 
-    static constexpr char CursorKey[] = "cursor";
-    static constexpr char ItemsKey[] = "items";
-
-    /// \brief Processes non-paginated data to form the result.
-    /// \param data The data JSON object.
-    void process_non_paginated_result(const json::JsonValue& data) {
+    /// \brief Processes the raw JSON with a list result by streaming it, deserializing each item as soon as it has
+    /// been read.
+    /// \param raw The raw JSON.
+    /// \param upstream The memory resource the arenas take their blocks from.
+    /// \remarks The models of every few items are allocated from an arena of their own.
+    void process_streamed(const std::shared_ptr<const std::string>& raw, std::pmr::memory_resource* upstream) {
+        models::PagedModelArenaScope scope(models::DefaultItemsPerModelArena, upstream);
+        std::optional<models::PaginationCursor> new_cursor;
         std::vector<T> new_result;
 
-        if (utils::JsonUtils::try_get_array_as_type_array(data, ResultKey, new_result)) {
+        const ListStreamResult streamed = process_list(
+                raw,
+                [&new_result, &scope](const json::JsonView& item) {
+                    scope.begin_item();
+
+                    T t;
+                    static_cast<serialization::IDeserializable&>(t).deserialize(item);
+                    new_result.push_back(std::move(t));
+                },
+                [&new_cursor](const json::JsonView& cursor_object) {
+                    models::PaginationCursor c;
+                    c.deserialize(cursor_object);
+                    new_cursor.emplace(std::move(c));
+                });
+
+        if (streamed.is_paginated) {
+            cursor = std::move(new_cursor);
+        }
+
+        if (streamed.has_items) {
             result.emplace(std::move(new_result));
         }
     }
+};
 
-    /// \brief Processes paginated data to form the result and pagination cursor.
-    /// \param data The data JSON object.
-    void process_paginated_result(const json::JsonValue& data) {
-        json::JsonValue result_object;
+/// \brief Models the body of a GraphQL response for paginated responses or responses with many objects, with the
+/// objects decoded into a result table instead of a model each.
+/// \tparam T The model of the objects, for which models::ResultTable must be specialized.
+template<class T>
+class GraphqlResponse<models::ResultTable<T>> : public AbstractGraphqlResponse {
+public:
+    GraphqlResponse() = default;
 
-        if (!data.try_get_object_field(ResultKey, result_object)) {
-            return;
-        }
+    /// \brief Constructs the GraphQL response with a JSON string.
+    /// \param raw The JSON body that is the GraphQL response.
+    /// \remarks The items of the result are appended to the table one at a time while the JSON is read, without
+    /// parsing the whole of it into a document first.
+    explicit GraphqlResponse(const std::string& raw) {
+        process_streamed(raw);
+    };
 
-        models::PaginationCursor new_cursor;
-        std::vector<T> new_result;
+    /// \brief Constructs the GraphQL response with a JSON string.
+    /// \param raw The JSON body that is the GraphQL response.
+    /// \remarks The items of the result are appended to the table one at a time while the JSON is read, without
+    /// parsing the whole of it into a document first.
+    explicit GraphqlResponse(std::string&& raw) {
+        process_streamed(raw);
+    };
 
-        if (utils::JsonUtils::try_get_object_as_type(result_object, CursorKey, new_cursor)) {
-            cursor.emplace(std::move(new_cursor));
-        }
+    GraphqlResponse(const GraphqlResponse<models::ResultTable<T>>& other) : AbstractGraphqlResponse(other),
+                                                                             cursor(other.cursor),
+                                                                             result(other.result) {
+    }
 
-        if (utils::JsonUtils::try_get_array_as_type_array(result_object, ItemsKey, new_result)) {
-            result.emplace(std::move(new_result));
-        }
+    GraphqlResponse(GraphqlResponse<models::ResultTable<T>>&& other) noexcept
+            : AbstractGraphqlResponse(std::move(other)),
+              cursor(std::move(other.cursor)),
+              result(std::move(other.result)) {
+    }
+
+    ~GraphqlResponse() override = default;
+
+    [[nodiscard]] const std::optional<models::PaginationCursor>& get_cursor() const override {
+        return cursor;
+    }
+
+    /// \brief Returns the result of the response.
+    /// \return Optional for the result.
+    [[nodiscard]] const std::optional<models::ResultTable<T>>& get_result() const {
+        return result;
+    }
+
+    [[nodiscard]] bool is_empty() const noexcept override {
+        return !result.has_value();
     }
 
-    /// \brief Determines whether the data is paginated.
-    /// \param data The data JSON object.
-    /// \return Whether the data is paginated.
-    static bool is_result_paginated(const json::JsonValue& data) {
-        json::JsonValue result_object;
+    [[nodiscard]] bool is_paginated() const noexcept override {
+        return cursor.has_value();
+    }
+
+    GraphqlResponse<models::ResultTable<T>>& operator=(const GraphqlResponse<models::ResultTable<T>>& rhs) {
+        AbstractGraphqlResponse::operator=(rhs);
+        cursor = rhs.cursor;
+        result = rhs.result;
 
-        if (data.try_get_object_field(ResultKey, result_object)) {
-            json::JsonValue cursor_object;
+        return *this;
+    }
 
-            return result_object.try_get_object_field(CursorKey, cursor_object) && cursor_object.is_object();
+private:
+    std::optional<models::PaginationCursor> cursor;
+    std::optional<models::ResultTable<T>> result;
+
+    /// \brief Processes the raw JSON with a list result by streaming it, appending each item to the table as soon as
+    /// it has been read.
+    /// \param raw The raw JSON.
+    void process_streamed(const std::string& raw) {
+        std::optional<models::PaginationCursor> new_cursor;
+        models::ResultTable<T> new_result;
+
+        const ListStreamResult streamed = process_list(
+                raw,
+                [&new_result](const json::JsonView& item) {
+                    new_result.append(item);
+                },
+                [&new_cursor](const json::JsonView& cursor_object) {
+                    models::PaginationCursor c;
+                    c.deserialize(cursor_object);
+                    new_cursor.emplace(std::move(c));
+                });
+
+        if (streamed.is_paginated) {
+            cursor = std::move(new_cursor);
         }
 
-        return false;
+        if (streamed.has_items) {
+            result.emplace(std::move(new_result));
+        }
     }
 };
 
+/// \brief Creates the GraphQL response for a JSON string.
+/// \tparam T The type contained by the response.
+/// \tparam Raw The type of the JSON string.
+/// \param raw The JSON body that is the GraphQL response.
+/// \param upstream The memory resource the arenas of the models of the result take their blocks from, for responses
+/// whose models are allocated from arenas.
+/// \return The response.
+template<class T, class Raw>
+GraphqlResponse<T> create_graphql_response(Raw&& raw, std::pmr::memory_resource* upstream) {
+    if constexpr (std::is_constructible_v<GraphqlResponse<T>, Raw&&, std::pmr::memory_resource*>) {
+        return GraphqlResponse<T>(std::forward<Raw>(raw), upstream);
+    } else {
+        return GraphqlResponse<T>(std::forward<Raw>(raw));
+    }
+}
+
 }
 
 #endif //ENJINCPPSDK_GRAPHQLRESPONSE_HPP
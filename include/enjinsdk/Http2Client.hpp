@@ -0,0 +1,120 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL
+#define ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL 0
+#endif
+
+#if ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL
+
+#ifndef ENJINSDK_HTTP2CLIENT_HPP
+#define ENJINSDK_HTTP2CLIENT_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/IHttpClient.hpp"
+#include "enjinsdk/LoggerProvider.hpp"
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace enjin::sdk::http {
+
+/// \brief HTTP/2 client which multiplexes all of its requests as streams over a single connection to the host.
+/// \remarks Request headers are compressed with HPACK, so headers repeated across requests, such as the authorization
+/// header, are sent as table indices after their first use. For "https" base URIs the protocol is negotiated with ALPN,
+/// while for "http" base URIs the client speaks HTTP/2 with prior knowledge (h2c). The connection is opened when the
+/// first request is sent and is reopened when a request is sent after the server closed it. Connecting, including the
+/// TLS handshake, is done without blocking the event loop, and requests which exceed their timeouts have their streams
+/// reset. Only available on POSIX platforms.
+class ENJINSDK_EXPORT Http2Client : public IHttpClient {
+public:
+    Http2Client() = delete;
+
+    /// \brief Creates the HTTP client with the base URI.
+    /// \param base_uri The base URI for the client, in the form of "scheme://host[:port][/path]".
+    /// \throws std::runtime_error If the base URI is malformed or its scheme is neither HTTP nor HTTPS.
+    explicit Http2Client(std::string base_uri);
+
+    Http2Client(const Http2Client&) = delete;
+
+    Http2Client(Http2Client&&) = delete;
+
+    /// \brief Destructor.
+    ~Http2Client() override;
+
+    void start() override;
+
+    /// \copydoc IHttpClient::stop()
+    /// \remarks Requests which are still in-flight fail with a std::runtime_error.
+    void stop() override;
+
+    std::future<HttpResponse> send_request(HttpRequest request) override;
+
+    /// \brief Returns the base URI of this client.
+    /// \return The URI.
+    [[nodiscard]] const std::string& get_base_uri() const;
+
+    /// \brief Returns the number of connections this client has opened since it was created.
+    /// \return The number of connections.
+    [[nodiscard]] std::size_t get_connection_count() const;
+
+    /// \brief Returns the number of requests which have been sent, or are waiting to be sent, and have not completed.
+    /// \return The number of requests.
+    [[nodiscard]] std::size_t get_in_flight_count() const;
+
+    [[nodiscard]] bool is_open() const override;
+
+    void set_default_request_header(std::string key, std::string value) override;
+
+    void set_logger(HttpLogLevel level, std::shared_ptr<utils::LoggerProvider> logger_provider) override;
+
+    /// \brief Sets the timeouts of this client, which apply to requests sent afterwards.
+    /// \param connect_timeout The time allowed for connecting to the server, including the TLS handshake of HTTPS
+    /// connections.
+    /// \param read_timeout The time allowed for the stream of a request to go without receiving or sending data.
+    /// \param request_timeout The time allowed for a request to complete, including the time spent waiting for the
+    /// connection.
+    /// \remarks Requests which time out fail with a std::runtime_error, and their streams are reset.
+    void set_timeouts(std::chrono::milliseconds connect_timeout,
+                      std::chrono::milliseconds read_timeout,
+                      std::chrono::milliseconds request_timeout);
+
+    Http2Client& operator=(const Http2Client&) = delete;
+
+    Http2Client& operator=(Http2Client&&) = delete;
+
+    /// \brief The default time allowed for connecting, which matches that of HttpClient.
+    static constexpr std::chrono::milliseconds DefaultConnectTimeout = std::chrono::seconds(300);
+
+    /// \brief The default time allowed for a stream to go without activity, which matches the read timeout of
+    /// HttpClient.
+    static constexpr std::chrono::milliseconds DefaultReadTimeout = std::chrono::seconds(5);
+
+    /// \brief The default time allowed for a request to complete.
+    static constexpr std::chrono::milliseconds DefaultRequestTimeout = std::chrono::seconds(60);
+
+private:
+    class Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+}
+
+#endif //ENJINSDK_HTTP2CLIENT_HPP
+
+#endif
@@ -18,9 +18,18 @@
 
 namespace enjin::sdk::http {
 
+/// \brief The key for the accept-encoding header.
+static constexpr char AcceptEncoding[] = "Accept-Encoding";
+
 /// \brief The key for the authorization header.
 static constexpr char Authorization[] = "Authorization";
 
+/// \brief The key for the content-encoding header.
+static constexpr char ContentEncoding[] = "Content-Encoding";
+
+/// \brief The key for the content-length header.
+static constexpr char ContentLength[] = "Content-Length";
+
 /// \brief The key for the content-type header.
 static constexpr char ContentType[] = "Content-Type";
 
@@ -53,6 +53,13 @@ public:
     /// \return This request for chaining.
     HttpRequest& set_content_type(std::string content_type);
 
+    /// \brief Sets whether this request may be sent more than once with the same effect as sending it once.
+    /// \param idempotent Whether this request is idempotent.
+    /// \return This request for chaining.
+    /// \remarks HTTP clients only send a request again on their own after a connection failed if it is idempotent.
+    /// Requests are not idempotent by default, as every request to the platform is a POST.
+    HttpRequest& set_idempotent(bool idempotent);
+
     /// \brief Adds a header for this request.
     /// \param name The header name.
     /// \param value The header value.
@@ -84,6 +91,15 @@ public:
     /// \return An optional containing the header value if one exists.
     [[nodiscard]] std::optional<std::string> get_header_value(const std::string& name) const;
 
+    /// \brief Determines whether this request may be sent more than once with the same effect as sending it once.
+    /// \return Whether this request is idempotent.
+    [[nodiscard]] bool is_idempotent() const noexcept;
+
+    /// \brief Moves the body out of this request, leaving the request without a body.
+    /// \return The request body.
+    /// \remarks Allows HTTP clients to hand the body to their transport without copying it.
+    [[nodiscard]] std::optional<std::string> take_body();
+
     /// \brief Determines if a value exists for the provided header name.
     /// \param name The header name.
     /// \return Whether a value exists.
@@ -106,6 +122,7 @@ private:
     std::optional<std::string> path_query_fragment;
     std::optional<std::string> body;
     std::map<std::string, std::string> headers;
+    bool idempotent = false;
 };
 
 }
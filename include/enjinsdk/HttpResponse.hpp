@@ -50,6 +50,11 @@ public:
     /// \return The response body optional.
     [[nodiscard]] const std::optional<std::string>& get_body() const;
 
+    /// \brief Moves the body out of this response, leaving the response without a body.
+    /// \return The response body.
+    /// \remarks Allows the body to be handed to a GraphQL response, which parses it in place, without copying it.
+    [[nodiscard]] std::optional<std::string> take_body();
+
     /// \brief Returns the map for the HTTP headers.
     /// \return The headers.
     [[nodiscard]] const std::map<std::string, std::string>& get_headers() const;
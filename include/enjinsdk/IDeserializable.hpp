@@ -17,6 +17,7 @@
 #define ENJINCPPSDK_IDESERIALIZABLE_HPP
 
 #include "enjinsdk_export.h"
+#include "enjinsdk/JsonView.hpp"
 #include <string>
 
 namespace enjin::sdk::serialization {
@@ -30,6 +31,15 @@ public:
     /// \brief Parses the JSON string and assigns valid values to this object's fields.
     /// \param json The JSON string.
     virtual void deserialize(const std::string& json) = 0;
+
+    /// \brief Assigns valid values from the already parsed JSON value to this object's fields.
+    /// \param json The view of the JSON value.
+    /// \remarks The default implementation converts the value to a string and passes it to the string overload.
+    /// Implementations should override this to read fields from the view directly, so that nested objects of a
+    /// response are not serialized and parsed again.
+    virtual void deserialize(const json::JsonView& json) {
+        deserialize(json.to_string());
+    }
 };
 
 }
@@ -0,0 +1,66 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_IEXECUTOR_HPP
+#define ENJINSDK_IEXECUTOR_HPP
+
+#include "enjinsdk_export.h"
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace enjin::sdk::utils {
+
+/// \brief Interface for executors which run the asynchronous work of the SDK's clients and schemas.
+class ENJINSDK_EXPORT IExecutor {
+public:
+    /// \brief Default destructor.
+    virtual ~IExecutor() = default;
+
+    /// \brief Schedules the given task to be run by this executor.
+    /// \param task The task.
+    virtual void execute(std::function<void()> task) = 0;
+
+    /// \brief Determines if the calling thread is one owned by this executor.
+    /// \return Whether the calling thread belongs to this executor.
+    /// \remarks Used by callers to run work inline rather than blocking a worker on work queued behind it.
+    [[nodiscard]] virtual bool is_worker_thread() const {
+        return false;
+    }
+
+    /// \brief Schedules the given callable to be run by this executor and returns a future for its result.
+    /// \tparam F The type of the callable.
+    /// \param task The callable.
+    /// \return The future for the result of the callable.
+    template<class F>
+    std::future<std::invoke_result_t<F>> submit(F task) {
+        using R = std::invoke_result_t<F>;
+
+        auto packaged_task = std::make_shared<std::packaged_task<R()>>(std::move(task));
+        std::future<R> future = packaged_task->get_future();
+
+        execute([packaged_task]() {
+            (*packaged_task)();
+        });
+
+        return future;
+    }
+};
+
+}
+
+#endif //ENJINSDK_IEXECUTOR_HPP
@@ -17,11 +17,14 @@
 #define ENJINCPPSDK_IHTTPCLIENT_HPP
 
 #include "enjinsdk_export.h"
+#include "enjinsdk/CompressionStats.hpp"
+#include "enjinsdk/ConnectionPoolStats.hpp"
 #include "enjinsdk/HttpLogLevel.hpp"
 #include "enjinsdk/HttpRequest.hpp"
 #include "enjinsdk/HttpResponse.hpp"
 #include "enjinsdk/LoggerProvider.hpp"
 #include <future>
+#include <optional>
 
 namespace enjin::sdk::http {
 
@@ -42,6 +45,18 @@ public:
     /// \return The future for accessing the response.
     virtual std::future<HttpResponse> send_request(HttpRequest request) = 0;
 
+    /// \brief Returns the bytes saved by compression since this client was created.
+    /// \return The compression stats, or an empty optional if this client does not track them.
+    [[nodiscard]] virtual std::optional<CompressionStats> get_compression_stats() const {
+        return std::nullopt;
+    }
+
+    /// \brief Returns the current occupancy of the connection pool of this client.
+    /// \return The pool stats, or an empty optional if this client does not pool its connections.
+    [[nodiscard]] virtual std::optional<ConnectionPoolStats> get_connection_pool_stats() const {
+        return std::nullopt;
+    }
+
     /// \brief Determines if this client is open.
     /// \return Whether this client is open.
     [[nodiscard]] virtual bool is_open() const = 0;
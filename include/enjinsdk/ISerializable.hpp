@@ -18,6 +18,7 @@
 
 #include "enjinsdk_export.h"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include <string>
 
 namespace enjin::sdk::serialization {
@@ -33,6 +34,14 @@ public:
     /// \remark Null fields are to be omitted from the JSON string.
     [[nodiscard]] virtual std::string serialize() const = 0;
 
+    /// \brief Writes this object's data to the writer as a JSON value.
+    /// \param writer The writer.
+    /// \remarks The default implementation writes the value returned by to_json(). Implementations may override this
+    /// to write their fields straight to the writer instead of building a JSON value first.
+    virtual void serialize(json::JsonWriter& writer) const {
+        writer.write_value(to_json());
+    }
+
     /// \brief Returns a JSON value representing this object.
     /// \return The JSON value.
     [[nodiscard]] virtual json::JsonValue to_json() const = 0;
@@ -0,0 +1,74 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_JSONPARSELIMITS_HPP
+#define ENJINSDK_JSONPARSELIMITS_HPP
+
+#include "enjinsdk_export.h"
+#include <cstddef>
+
+namespace enjin::sdk::json {
+
+/// \brief Limits enforced while this SDK parses JSON it receives, so that an oversized or hostile payload is rejected
+/// as soon as it exceeds one of them instead of growing without bound in memory.
+/// \remarks A limit of zero is not enforced.
+struct ENJINSDK_EXPORT JsonParseLimits {
+    /// \brief The maximum size of the JSON text in bytes.
+    std::size_t max_bytes = 64 * 1024 * 1024;
+
+    /// \brief The maximum depth of nested objects and arrays.
+    std::size_t max_depth = 256;
+
+    /// \brief The maximum length of a string or object key in bytes.
+    std::size_t max_string_length = 16 * 1024 * 1024;
+
+    /// \brief The maximum number of values, counting every value nested in objects and arrays.
+    std::size_t max_nodes = 4 * 1024 * 1024;
+};
+
+/// \brief Running totals of the JSON texts rejected for exceeding a parse limit.
+struct ENJINSDK_EXPORT JsonParseRejectionStats {
+    /// \brief The number of texts rejected for their size.
+    std::size_t too_many_bytes = 0;
+
+    /// \brief The number of texts rejected for their nesting depth.
+    std::size_t too_deep = 0;
+
+    /// \brief The number of texts rejected for the length of a string or object key.
+    std::size_t string_too_long = 0;
+
+    /// \brief The number of texts rejected for their number of values.
+    std::size_t too_many_nodes = 0;
+};
+
+/// \brief Returns the limits currently enforced while parsing JSON.
+/// \return The limits.
+ENJINSDK_EXPORT
+JsonParseLimits get_json_parse_limits();
+
+/// \brief Returns the number of JSON texts rejected for exceeding each limit since the process started.
+/// \return The rejection stats.
+ENJINSDK_EXPORT
+JsonParseRejectionStats get_json_parse_rejection_stats();
+
+/// \brief Sets the limits enforced while parsing JSON, which apply to every client in the process.
+/// \param limits The limits.
+/// \remarks Parsing which is already in progress keeps the limits it started with.
+ENJINSDK_EXPORT
+void set_json_parse_limits(const JsonParseLimits& limits);
+
+}
+
+#endif //ENJINSDK_JSONPARSELIMITS_HPP
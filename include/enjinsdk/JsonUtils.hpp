@@ -21,6 +21,8 @@
 #include "enjinsdk/IDeserializable.hpp"
 #include "enjinsdk/ISerializable.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include "enjinsdk/models/AssetField.hpp"
 #include "enjinsdk/models/AssetIdFormat.hpp"
 #include "enjinsdk/models/AssetIndexFormat.hpp"
@@ -36,6 +38,7 @@
 #include "enjinsdk/models/Whitelisted.hpp"
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -81,7 +84,7 @@ public:
     /// \return Whether this action was successful.
     /// \remarks Class type T must implement Serialization::IDeserializable.
     template<class T>
-    static bool try_get_array_as_type_array(const json::JsonValue& json, const std::string& key, std::vector<T>& out) {
+    static bool try_get_array_as_type_array(const json::JsonView& json, const std::string& key, std::vector<T>& out) {
         static_assert(std::is_base_of_v<serialization::IDeserializable, T>,
                       "Class T does not inherit from IDeserializable.");
 
@@ -89,21 +92,18 @@ public:
             return false;
         }
 
-        json::JsonValue array;
-        if (!json.try_get_object_field(key, array)) {
-            return false;
-        }
-
-        std::vector<json::JsonValue> value_array;
-        if (!array.try_get_array(value_array)) {
+        json::JsonView array;
+        if (!json.try_get_object_field(key, array) || !array.is_array()) {
             return false;
         }
 
         out.clear();
+        out.reserve(array.size());
 
-        for (const json::JsonValue& value: value_array) {
+        for (const json::JsonView value: array.get_array_elements()) {
             T t;
-            t.deserialize(value.to_string());
+            // Called through the interface so that types overriding only the string overload still deserialize
+            static_cast<serialization::IDeserializable&>(t).deserialize(value);
 
             out.push_back(std::move(t));
         }
@@ -119,7 +119,7 @@ public:
     /// \return Whether this action was successful.
     /// \remarks The out optional will be cleared if this operation is not successful.
     template<class T>
-    static bool try_get_field(const json::JsonValue& json, const std::string& key, std::optional<T>& out_field) {
+    static bool try_get_field(const json::JsonView& json, const std::string& key, std::optional<T>& out_field) {
         T new_field;
 
         if (try_get_object_as_type<T>(json, key, new_field)) {
@@ -139,7 +139,7 @@ public:
     /// \return Whether this action was successful.
     /// \remarks The out optional will be cleared if this operation is not successful.
     template<class T>
-    static bool try_get_field(const json::JsonValue& json,
+    static bool try_get_field(const json::JsonView& json,
                               const std::string& key,
                               std::optional<std::vector<T>>& out_field) {
         std::vector<T> new_field;
@@ -161,16 +161,17 @@ public:
     /// \return Whether this action was successful.
     /// \remarks Class type T must implement Serialization::IDeserializable.
     template<class T>
-    static bool try_get_object_as_type(const json::JsonValue& json, const std::string& key, T& out) {
+    static bool try_get_object_as_type(const json::JsonView& json, const std::string& key, T& out) {
         static_assert(std::is_base_of_v<serialization::IDeserializable, T>,
                       "Class T does not inherit from IDeserializable.");
 
-        json::JsonValue value = json::JsonValue::create_object();
+        json::JsonView value;
         if (!json.try_get_object_field(key, value) || !value.is_object()) {
             return false;
         }
 
-        out.deserialize(value.to_string());
+        // Called through the interface so that types overriding only the string overload still deserialize
+        static_cast<serialization::IDeserializable&>(out).deserialize(value);
         return true;
     }
 
@@ -217,6 +218,101 @@ public:
         json.try_remove_object_field(key);
         return false;
     }
+
+    /// \brief Tries to write the specified field with the data contained within the optional.
+    /// \tparam T The type of the data.
+    /// \param writer The writer, which must be writing an object.
+    /// \param key The name of the field.
+    /// \param in_field The optional containing the data to write.
+    /// \return Whether the field was written, which it is not if the optional is empty.
+    template<class T>
+    static bool try_write_field(json::JsonWriter& writer, const std::string& key, const std::optional<T>& in_field) {
+        if (!in_field.has_value()) {
+            return false;
+        }
+
+        writer.write_key(key);
+        write_value(writer, in_field.value());
+        return true;
+    }
+
+    /// \brief Tries to write the specified field with the array contained within the optional.
+    /// \tparam T The type contained in the array.
+    /// \param writer The writer, which must be writing an object.
+    /// \param key The name of the field.
+    /// \param in_field The optional containing the array to write.
+    /// \return Whether the field was written, which it is not if the optional is empty.
+    template<class T>
+    static bool try_write_field(json::JsonWriter& writer,
+                                const std::string& key,
+                                const std::optional<std::vector<T>>& in_field) {
+        if (!in_field.has_value()) {
+            return false;
+        }
+
+        writer.write_key(key);
+        writer.start_array();
+        for (const T& el: in_field.value()) {
+            write_value(writer, el);
+        }
+        writer.end_array();
+
+        return true;
+    }
+
+    /// \brief Writes the serializable object as a JSON object.
+    /// \tparam T The class type of the object.
+    /// \param writer The writer.
+    /// \param value The object.
+    /// \remarks Class type T must implement Serialization::ISerializable.
+    template<class T>
+    static void write_value(json::JsonWriter& writer, const T& value) {
+        static_assert(std::is_base_of_v<serialization::ISerializable, T>,
+                      "Class T does not inherit from ISerializable.");
+
+        // Called through the interface so that types overriding only the string overload still serialize
+        static_cast<const serialization::ISerializable&>(value).serialize(writer);
+    }
+
+    static void write_value(json::JsonWriter& writer, bool value);
+
+    static void write_value(json::JsonWriter& writer, double value);
+
+    static void write_value(json::JsonWriter& writer, float value);
+
+    static void write_value(json::JsonWriter& writer, int value);
+
+    static void write_value(json::JsonWriter& writer, long value);
+
+    static void write_value(json::JsonWriter& writer, const std::string& value);
+
+    static void write_value(json::JsonWriter& writer, const json::JsonValue& value);
+
+    static void write_value(json::JsonWriter& writer, models::AssetField value);
+
+    static void write_value(json::JsonWriter& writer, models::AssetIdFormat value);
+
+    static void write_value(json::JsonWriter& writer, models::AssetIndexFormat value);
+
+    static void write_value(json::JsonWriter& writer, models::AssetSupplyModel value);
+
+    static void write_value(json::JsonWriter& writer, models::AssetTransferFeeType value);
+
+    static void write_value(json::JsonWriter& writer, models::AssetTransferable value);
+
+    static void write_value(json::JsonWriter& writer, models::AssetVariantMode value);
+
+    static void write_value(json::JsonWriter& writer, models::Operator value);
+
+    static void write_value(json::JsonWriter& writer, models::SortDirection value);
+
+    static void write_value(json::JsonWriter& writer, models::TransactionField value);
+
+    static void write_value(json::JsonWriter& writer, models::TransactionState value);
+
+    static void write_value(json::JsonWriter& writer, models::TransactionType value);
+
+    static void write_value(json::JsonWriter& writer, models::Whitelisted value);
 };
 
 /// \brief Creates a JSON value-array from a string array.
@@ -244,11 +340,11 @@ inline json::JsonValue JsonUtils::get_type_array_as_json_value_array(const std::
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<bool>& out_field) {
     bool new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_bool(new_field)) {
         out_field = new_field;
@@ -266,11 +362,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<double>& out_field) {
     double new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_number(new_field)) {
         out_field = new_field;
@@ -288,11 +384,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<float>& out_field) {
     float new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_number(new_field)) {
         out_field = new_field;
@@ -310,11 +406,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<int>& out_field) {
     int new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_number(new_field)) {
         out_field = new_field;
@@ -332,11 +428,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<long>& out_field) {
     long new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_number(new_field)) {
         out_field = new_field;
@@ -354,13 +450,13 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<json::JsonValue>& out_field) {
-    json::JsonValue new_field;
+    json::JsonView value;
 
-    if (json.try_get_object_field(key, new_field) && new_field.is_object()) {
-        out_field.emplace(std::move(new_field));
+    if (json.try_get_object_field(key, value) && value.is_object()) {
+        out_field.emplace(value.to_value());
         return true;
     }
 
@@ -375,13 +471,19 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<std::vector<json::JsonValue>>& out_field) {
-    std::vector<json::JsonValue> value_array;
-    json::JsonValue value;
+    json::JsonView value;
+
+    if (json.try_get_object_field(key, value) && value.is_array()) {
+        std::vector<json::JsonValue> value_array;
+        value_array.reserve(value.size());
+
+        for (const json::JsonView el: value.get_array_elements()) {
+            value_array.push_back(el.to_value());
+        }
 
-    if (json.try_get_object_field(key, value) && value.try_get_array(value_array)) {
         out_field.emplace(std::move(value_array));
         return true;
     }
@@ -397,11 +499,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<std::string>& out_field) {
     std::string new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
         out_field.emplace(std::move(new_field));
@@ -412,6 +514,29 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
     return false;
 }
 
+/// \brief Tries and set the optional with a view of the specified string field.
+/// \param json The JSON value-object.
+/// \param key The name of the field.
+/// \param out_field The optional to write to.
+/// \return Whether this action was successful.
+/// \remarks The out optional will be cleared if this operation is not successful. The view is only valid while the
+/// value the JSON value-object views is alive and unmodified.
+template<>
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
+                                     const std::string& key,
+                                     std::optional<std::string_view>& out_field) {
+    std::string_view new_field;
+    json::JsonView value;
+
+    if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
+        out_field = new_field;
+        return true;
+    }
+
+    out_field.reset();
+    return false;
+}
+
 /// \brief Tries and set the optional with the specified string-array field.
 /// \param json The JSON value-object.
 /// \param key The name of the field.
@@ -419,16 +544,16 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<std::vector<std::string>>& out_field) {
-    std::vector<json::JsonValue> value_array;
-    json::JsonValue value;
+    json::JsonView value;
 
-    if (json.try_get_object_field(key, value) && value.try_get_array(value_array)) {
+    if (json.try_get_object_field(key, value) && value.is_array()) {
         std::vector<std::string> new_field;
+        new_field.reserve(value.size());
 
-        for (const json::JsonValue& el: value_array) {
+        for (const json::JsonView el: value.get_array_elements()) {
             new_field.push_back(el.to_string());
         }
 
@@ -447,11 +572,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<models::AssetSupplyModel>& out_field) {
     std::string new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
         out_field = EnumUtils::deserialize_asset_supply_model(new_field);
@@ -469,11 +594,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<models::AssetTransferFeeType>& out_field) {
     std::string new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
         out_field = EnumUtils::deserialize_asset_transfer_fee_type(new_field);
@@ -491,11 +616,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<models::AssetTransferable>& out_field) {
     std::string new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
         out_field = EnumUtils::deserialize_asset_transferable(new_field);
@@ -513,11 +638,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<models::AssetVariantMode>& out_field) {
     std::string new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
         out_field = EnumUtils::deserialize_asset_variant_mode(new_field);
@@ -535,11 +660,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<models::TransactionState>& out_field) {
     std::string new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
         out_field = EnumUtils::deserialize_transaction_state(new_field);
@@ -557,11 +682,11 @@ inline bool JsonUtils::try_get_field(const json::JsonValue& json,
 /// \return Whether this action was successful.
 /// \remarks The out optional will be cleared if this operation is not successful.
 template<>
-inline bool JsonUtils::try_get_field(const json::JsonValue& json,
+inline bool JsonUtils::try_get_field(const json::JsonView& json,
                                      const std::string& key,
                                      std::optional<models::TransactionType>& out_field) {
     std::string new_field;
-    json::JsonValue value;
+    json::JsonView value;
 
     if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
         out_field = EnumUtils::deserialize_transaction_type(new_field);
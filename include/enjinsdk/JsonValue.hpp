@@ -17,6 +17,7 @@
 #define ENJINSDK_JSONVALUE_HPP
 
 #include "enjinsdk_export.h"
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <string>
@@ -24,7 +25,11 @@
 
 namespace enjin::sdk::json {
 
+class JsonView;
+
 /// \brief Public API class for JSON functionality needed by this SDK.
+/// \remarks Nulls, booleans, numbers and short strings are held inline without allocating. Objects, arrays and long
+/// strings are held in a document which copies share until one of them is modified, so copying a value is cheap.
 class ENJINSDK_EXPORT JsonValue final {
 public:
     /// \brief Creates an instance of this class as a null value type.
@@ -139,6 +144,14 @@ public:
     /// \return Whether the out parameter was set.
     bool try_get_object_field(const std::string& key, JsonValue& out) const;
 
+    /// \brief Tries to get a view of an object field from this value and assign it to an out parameter.
+    /// \param key The field key.
+    /// \param out The out parameter.
+    /// \return Whether the out parameter was set.
+    /// \remarks Unlike getting the field as a value, this does not copy the field. The view is only valid while this
+    /// value is alive and unmodified.
+    bool try_get_object_field(const std::string& key, JsonView& out) const;
+
     /// \brief Tries to get this value as a string and assign it to an out parameter.
     /// \param out The out parameter.
     /// \return Whether the out parameter was set.
@@ -226,14 +239,32 @@ public:
     static JsonValue create_string();
 
 private:
-    /// \brief The implementation class.
+    /// \brief The implementation class, which holds the document of an object, array or long string value.
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    /// \brief Size in bytes of the storage for a node held inline.
+    static constexpr std::size_t InlineNodeSize = 24;
+
+    /// \brief Storage for the node of a null, boolean, number or short string value, which is held inline instead of
+    /// in a document.
+    alignas(8) unsigned char inline_node[InlineNodeSize];
+
+    /// \brief The document of this value, which is shared between copies until one of them is modified, or null if
+    /// the node is held inline.
+    std::shared_ptr<Impl> pimpl;
+
+    /// \brief Returns the underlying node of this value for views to borrow.
+    /// \return The node.
+    [[nodiscard]] const void* get_node() const;
+
+    /// \brief Creates a value instance as a copy of the given node.
+    /// \param node The node.
+    /// \return The created value instance.
+    static JsonValue create_from_node(const void* node);
+
+    friend class JsonView;
 
-    /// \brief Constructs an instance of this class with the given implementation-pointer.
-    /// \param ptr The implementation-pointer.
-    explicit JsonValue(std::unique_ptr<Impl> ptr);
+    friend class JsonWriter;
 };
 
 }
@@ -0,0 +1,266 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_JSONVIEW_HPP
+#define ENJINSDK_JSONVIEW_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/JsonValue.hpp"
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace enjin::sdk::graphql {
+
+class AbstractGraphqlResponse;
+
+}
+
+namespace enjin::sdk::json {
+
+class JsonSource;
+
+struct JsonMember;
+
+/// \brief Read-only view of a JSON value which borrows from the value it was created from instead of copying it.
+/// \remarks Creating, copying and navigating views does not allocate. A view, and any view or string view obtained
+/// from it, is only valid while the value it borrows from is alive and unmodified.
+class ENJINSDK_EXPORT JsonView final {
+public:
+    /// \brief Iterator over the elements of a JSON array.
+    class ENJINSDK_EXPORT ElementIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = JsonView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = JsonView;
+
+        ElementIterator() = default;
+
+        JsonView operator*() const;
+
+        ElementIterator& operator++();
+
+        ElementIterator operator++(int);
+
+        bool operator==(const ElementIterator& rhs) const;
+
+        bool operator!=(const ElementIterator& rhs) const;
+
+    private:
+        const void* element = nullptr;
+
+        explicit ElementIterator(const void* element);
+
+        friend class JsonView;
+    };
+
+    /// \brief Iterator over the members of a JSON object.
+    class ENJINSDK_EXPORT MemberIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = JsonMember;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = JsonMember;
+
+        MemberIterator() = default;
+
+        JsonMember operator*() const;
+
+        MemberIterator& operator++();
+
+        MemberIterator operator++(int);
+
+        bool operator==(const MemberIterator& rhs) const;
+
+        bool operator!=(const MemberIterator& rhs) const;
+
+    private:
+        const void* member = nullptr;
+
+        explicit MemberIterator(const void* member);
+
+        friend class JsonView;
+    };
+
+    /// \brief Range of iterators for use in range-based for loops.
+    /// \tparam I The iterator type.
+    template<class I>
+    class Range {
+    public:
+        Range(I first, I last) : first(first), last(last) {
+        }
+
+        [[nodiscard]] I begin() const {
+            return first;
+        }
+
+        [[nodiscard]] I end() const {
+            return last;
+        }
+
+    private:
+        I first;
+        I last;
+    };
+
+    /// \brief Constructs a view of a null value.
+    JsonView();
+
+    /// \brief Constructs a view of the given value.
+    /// \param value The value, which must outlive this view.
+    /// \remarks Not explicit so that functions taking a view may be passed a value.
+    JsonView(const JsonValue& value);
+
+    /// \brief Returns a range over the elements of this view as a JSON array.
+    /// \return The range, which is empty if this view is not of an array.
+    [[nodiscard]] Range<ElementIterator> get_array_elements() const;
+
+    /// \brief Returns a range over the members of this view as a JSON object.
+    /// \return The range, which is empty if this view is not of an object.
+    [[nodiscard]] Range<MemberIterator> get_object_members() const;
+
+    /// \brief Determines if this view as a JSON object has the specified field.
+    /// \param key The field key.
+    /// \return Whether this view is of a JSON object and has the specified field.
+    [[nodiscard]] bool has_object_field(const std::string& key) const;
+
+    /// \brief Determines whether this views an array value.
+    /// \return Whether this views an array value.
+    [[nodiscard]] bool is_array() const;
+
+    /// \brief Determines whether this views a boolean value.
+    /// \return Whether this views a boolean value.
+    [[nodiscard]] bool is_bool() const;
+
+    /// \brief Determines whether this views a double value.
+    /// \return Whether this views a double value.
+    [[nodiscard]] bool is_double() const;
+
+    /// \brief Determines whether this views a float value.
+    /// \return Whether this views a float value.
+    [[nodiscard]] bool is_float() const;
+
+    /// \brief Determines whether this views an integer value.
+    /// \return Whether this views an integer value.
+    [[nodiscard]] bool is_int() const;
+
+    /// \brief Determines whether this views a 64-bit integer value.
+    /// \return Whether this views a 64-bit integer value.
+    [[nodiscard]] bool is_int64() const;
+
+    /// \brief Determines whether this views a null value.
+    /// \return Whether this views a null value.
+    [[nodiscard]] bool is_null() const;
+
+    /// \brief Determines whether this views a number value.
+    /// \return Whether this views a number value.
+    [[nodiscard]] bool is_number() const;
+
+    /// \brief Determines whether this views an object value.
+    /// \return Whether this views an object value.
+    [[nodiscard]] bool is_object() const;
+
+    /// \brief Determines whether this views a string value.
+    /// \return Whether this views a string value.
+    [[nodiscard]] bool is_string() const;
+
+    /// \brief Returns the number of elements or members of this view as a JSON array or object.
+    /// \return The number of elements or members, or zero if this view is of neither an array nor an object.
+    [[nodiscard]] std::size_t size() const;
+
+    /// \brief Returns a string representation of the viewed value.
+    /// \return The string representation.
+    [[nodiscard]] std::string to_string() const;
+
+    /// \brief Returns a copy of the viewed value which owns its data.
+    /// \return The copy.
+    [[nodiscard]] JsonValue to_value() const;
+
+    /// \brief Tries to get this view as a boolean and assign it to an out parameter.
+    /// \param out The out parameter.
+    /// \return Whether the out parameter was set.
+    bool try_get_bool(bool& out) const;
+
+    /// \brief Tries to get this view as a double and assign it to an out parameter.
+    /// \param out The out parameter.
+    /// \return Whether the out parameter was set.
+    bool try_get_number(double& out) const;
+
+    /// \brief Tries to get this view as a float and assign it to an out parameter.
+    /// \param out The out parameter.
+    /// \return Whether the out parameter was set.
+    bool try_get_number(float& out) const;
+
+    /// \brief Tries to get this view as an integer and assign it to an out parameter.
+    /// \param out The out parameter.
+    /// \return Whether the out parameter was set.
+    bool try_get_number(int& out) const;
+
+    /// \brief Tries to get this view as a long and assign it to an out parameter.
+    /// \param out The out parameter.
+    /// \return Whether the out parameter was set.
+    bool try_get_number(long& out) const;
+
+    /// \brief Tries to get a view of an object field of this view and assign it to an out parameter.
+    /// \param key The field key.
+    /// \param out The out parameter, which is set to a view of a null value if this view does not have the field.
+    /// \return Whether the out parameter was set.
+    bool try_get_object_field(const std::string& key, JsonView& out) const;
+
+    /// \brief Tries to get this view as a string and assign a copy of it to an out parameter.
+    /// \param out The out parameter.
+    /// \return Whether the out parameter was set.
+    bool try_get_string(std::string& out) const;
+
+    /// \brief Tries to get this view as a string and assign a view of it to an out parameter.
+    /// \param out The out parameter.
+    /// \return Whether the out parameter was set.
+    bool try_get_string(std::string_view& out) const;
+
+    bool operator==(const JsonView& rhs) const;
+
+    bool operator!=(const JsonView& rhs) const;
+
+private:
+    const void* node;
+    const JsonSource* source = nullptr;
+
+    explicit JsonView(const void* node);
+
+    JsonView(const void* node, const JsonSource* source);
+
+    friend class JsonSource;
+
+    friend class JsonValue;
+
+    friend class graphql::AbstractGraphqlResponse;
+};
+
+/// \brief Member of a JSON object, as given by JsonView::MemberIterator.
+struct ENJINSDK_EXPORT JsonMember {
+    /// \brief The key of the member.
+    std::string_view key;
+
+    /// \brief The view of the value of the member.
+    JsonView value;
+};
+
+}
+
+#endif //ENJINSDK_JSONVIEW_HPP
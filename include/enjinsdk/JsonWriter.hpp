@@ -0,0 +1,109 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_JSONWRITER_HPP
+#define ENJINSDK_JSONWRITER_HPP
+
+#include "enjinsdk_export.h"
+#include <memory>
+#include <string>
+
+namespace enjin::sdk::json {
+
+class JsonValue;
+
+/// \brief Writer which streams JSON straight into a string without building a JSON value first.
+/// \remarks A writer reuses a buffer belonging to its thread unless another writer on the same thread is already
+/// using it, so writing many requests on one thread does not grow a new buffer for each of them.
+class ENJINSDK_EXPORT JsonWriter final {
+public:
+    /// \brief Constructs a writer with nothing written.
+    JsonWriter();
+
+    JsonWriter(const JsonWriter&) = delete;
+
+    JsonWriter(JsonWriter&&) = delete;
+
+    /// \brief Deconstructs this writer and releases its buffer.
+    ~JsonWriter();
+
+    /// \brief Writes the end of the current array.
+    void end_array();
+
+    /// \brief Writes the end of the current object.
+    void end_object();
+
+    /// \brief Determines whether a complete JSON value has been written.
+    /// \return Whether a complete value has been written.
+    [[nodiscard]] bool is_complete() const;
+
+    /// \brief Writes the start of an array.
+    void start_array();
+
+    /// \brief Writes the start of an object.
+    void start_object();
+
+    /// \brief Returns what has been written as a string.
+    /// \return The JSON string.
+    [[nodiscard]] std::string to_string() const;
+
+    /// \brief Writes a boolean.
+    /// \param value The boolean.
+    void write_bool(bool value);
+
+    /// \brief Writes the key of the next field of the current object.
+    /// \param key The key.
+    void write_key(const std::string& key);
+
+    /// \brief Writes a null.
+    void write_null();
+
+    /// \brief Writes a double.
+    /// \param value The number.
+    void write_number(double value);
+
+    /// \brief Writes a float.
+    /// \param value The number.
+    void write_number(float value);
+
+    /// \brief Writes an integer.
+    /// \param value The number.
+    void write_number(int value);
+
+    /// \brief Writes a long.
+    /// \param value The number.
+    void write_number(long value);
+
+    /// \brief Writes a string.
+    /// \param value The string.
+    void write_string(const std::string& value);
+
+    /// \brief Writes a JSON value.
+    /// \param value The value.
+    void write_value(const JsonValue& value);
+
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    JsonWriter& operator=(JsonWriter&&) = delete;
+
+private:
+    class Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+}
+
+#endif //ENJINSDK_JSONWRITER_HPP
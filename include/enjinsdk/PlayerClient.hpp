@@ -17,9 +17,12 @@
 #define ENJINCPPSDK_PLAYERCLIENT_HPP
 
 #include "enjinsdk_export.h"
-#include "enjinsdk/IHttpClient.hpp"
 #include "enjinsdk/IClient.hpp"
+#include "enjinsdk/IExecutor.hpp"
+#include "enjinsdk/IHttpClient.hpp"
 #include "enjinsdk/player/PlayerSchema.hpp"
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -44,6 +47,14 @@ public:
 
     void close() override;
 
+    /// \brief Returns the bytes saved by the compression of the HTTP client of this client.
+    /// \return The compression stats, or an empty optional if the HTTP client does not track them.
+    [[nodiscard]] std::optional<http::CompressionStats> get_http_compression_stats() const;
+
+    /// \brief Returns the current occupancy of the connection pool of the HTTP client of this client.
+    /// \return The pool stats, or an empty optional if the HTTP client does not pool its connections.
+    [[nodiscard]] std::optional<http::ConnectionPoolStats> get_http_connection_pool_stats() const;
+
     [[nodiscard]] bool is_authenticated() const override;
 
     [[nodiscard]] bool is_closed() const override;
@@ -67,26 +78,80 @@ public:
         /// \return This builder for chaining.
         PlayerClientBuilder& base_uri(std::string base_uri);
 
+        /// \brief Enables identical queries sent concurrently by the client to share one request to the platform.
+        /// \return This builder for chaining.
+        /// \remarks See BaseSchema::set_request_coalescing() for which requests are coalesced.
+        PlayerClientBuilder& enable_request_coalescing();
+
+        /// \brief Sets the executor to be shared by the client's schema and built-in HTTP client.
+        /// \param executor The executor.
+        /// \return This builder for chaining.
+        /// \remarks If an executor is not provided, then each request is run with std::async.
+        PlayerClientBuilder& executor(std::shared_ptr<utils::IExecutor> executor);
+
         /// \brief Sets the underlying HTTP client implementation to be moved to the client.
         /// \param http_client The client implementation.
         /// \return This builder for chaining.
         PlayerClientBuilder& http_client(std::unique_ptr<http::IHttpClient> http_client);
 
+        /// \brief Enables gzip compression of the request bodies sent by the built-in HTTP client.
+        /// \param threshold The size in bytes a request body must reach to be compressed.
+        /// \return This builder for chaining.
+        /// \remarks Has no effect if an HTTP client implementation is provided. The built-in HTTP client requests gzip
+        /// and deflate encoded responses with the Accept-Encoding header and decompresses them regardless of this
+        /// setting.
+        PlayerClientBuilder& http_compression_threshold(std::size_t threshold);
+
         /// \brief Sets the HTTP log level to set the HTTP client to.
         /// \param http_log_level The HTTP log level.
         /// \return This builder for chaining.
         PlayerClientBuilder& http_log_level(http::HttpLogLevel http_log_level);
 
+        /// \brief Sets the duration after which the built-in HTTP client evicts an unused connection from its pool.
+        /// \param http_idle_timeout The idle timeout.
+        /// \return This builder for chaining.
+        /// \remarks Has no effect if an HTTP client implementation is provided.
+        PlayerClientBuilder& http_idle_timeout(std::chrono::milliseconds http_idle_timeout);
+
+        /// \brief Sets the maximum number of keep-alive connections the built-in HTTP client may pool.
+        /// \param http_max_connections The maximum number of connections.
+        /// \return This builder for chaining.
+        /// \remarks Has no effect if an HTTP client implementation is provided.
+        PlayerClientBuilder& http_max_connections(std::size_t http_max_connections);
+
+        /// \brief Sets the number of connections the built-in HTTP client opens when it is started.
+        /// \param http_prewarmed_connections The number of connections.
+        /// \return This builder for chaining.
+        /// \remarks Has no effect if an HTTP client implementation is provided. The connections are opened in the
+        /// background, so starting the client does not wait for them.
+        PlayerClientBuilder& http_prewarmed_connections(std::size_t http_prewarmed_connections);
+
         /// \brief Sets the logger provider to be used by the client.
         /// \param logger_provider The logger provider.
         /// \return This builder for chaining.
         PlayerClientBuilder& logger_provider(std::shared_ptr<utils::LoggerProvider> logger_provider);
 
+        /// \brief Enables the client to collect its requests into batches, which are sent to the platform as one
+        /// request.
+        /// \param max_batch_size The number of requests at which a batch is sent.
+        /// \param max_delay The maximum time a request waits for its batch to fill.
+        /// \return This builder for chaining.
+        /// \remarks See BaseSchema::set_request_batching() for how batches are sent.
+        PlayerClientBuilder& request_batching(std::size_t max_batch_size, std::chrono::milliseconds max_delay);
+
     private:
         std::optional<std::string> m_base_uri;
+        std::shared_ptr<utils::IExecutor> m_executor;
         std::unique_ptr<http::IHttpClient> m_http_client;
+        std::optional<std::size_t> m_http_compression_threshold;
+        std::optional<std::chrono::milliseconds> m_http_idle_timeout;
         std::optional<http::HttpLogLevel> m_http_log_level;
+        std::optional<std::size_t> m_http_max_connections;
+        std::optional<std::size_t> m_http_prewarmed_connections;
         std::shared_ptr<utils::LoggerProvider> m_logger_provider;
+        std::optional<std::size_t> m_request_batch_size;
+        std::chrono::milliseconds m_request_batch_delay = std::chrono::milliseconds(0);
+        std::optional<bool> m_request_coalescing;
 
         PlayerClientBuilder() = default;
 
@@ -95,7 +160,8 @@ public:
 
 private:
     PlayerClient(std::unique_ptr<http::IHttpClient> http_client,
-                 std::shared_ptr<utils::LoggerProvider> logger_provider);
+                 std::shared_ptr<utils::LoggerProvider> logger_provider,
+                 std::shared_ptr<utils::IExecutor> executor);
 };
 
 }
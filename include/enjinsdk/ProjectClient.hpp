@@ -17,11 +17,14 @@
 #define ENJINCPPSDK_PROJECTCLIENT_HPP
 
 #include "enjinsdk_export.h"
-#include "enjinsdk/IHttpClient.hpp"
 #include "enjinsdk/IClient.hpp"
+#include "enjinsdk/IExecutor.hpp"
+#include "enjinsdk/IHttpClient.hpp"
 #include "enjinsdk/internal/Timer.hpp"
 #include "enjinsdk/models/AccessToken.hpp"
 #include "enjinsdk/project/ProjectSchema.hpp"
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <memory>
@@ -69,6 +72,14 @@ public:
 
     void close() override;
 
+    /// \brief Returns the bytes saved by the compression of the HTTP client of this client.
+    /// \return The compression stats, or an empty optional if the HTTP client does not track them.
+    [[nodiscard]] std::optional<http::CompressionStats> get_http_compression_stats() const;
+
+    /// \brief Returns the current occupancy of the connection pool of the HTTP client of this client.
+    /// \return The pool stats, or an empty optional if the HTTP client does not pool its connections.
+    [[nodiscard]] std::optional<http::ConnectionPoolStats> get_http_connection_pool_stats() const;
+
     [[nodiscard]] bool is_authenticated() const override;
 
     /// \brief Determines if this client is enabled for automatic reauthentication.
@@ -105,16 +116,54 @@ public:
         /// \return This builder for chaining.
         ProjectClientBuilder& enable_automatic_reauthentication();
 
+        /// \brief Enables identical queries sent concurrently by the client to share one request to the platform.
+        /// \return This builder for chaining.
+        /// \remarks See BaseSchema::set_request_coalescing() for which requests are coalesced.
+        ProjectClientBuilder& enable_request_coalescing();
+
+        /// \brief Sets the executor to be shared by the client's schema and built-in HTTP client.
+        /// \param executor The executor.
+        /// \return This builder for chaining.
+        /// \remarks If an executor is not provided, then each request is run with std::async.
+        ProjectClientBuilder& executor(std::shared_ptr<utils::IExecutor> executor);
+
         /// \brief Sets the underlying HTTP client implementation to be moved to the client.
         /// \param http_client The client implementation.
         /// \return This builder for chaining.
         ProjectClientBuilder& http_client(std::unique_ptr<http::IHttpClient> http_client);
 
+        /// \brief Enables gzip compression of the request bodies sent by the built-in HTTP client.
+        /// \param threshold The size in bytes a request body must reach to be compressed.
+        /// \return This builder for chaining.
+        /// \remarks Has no effect if an HTTP client implementation is provided. The built-in HTTP client requests gzip
+        /// and deflate encoded responses with the Accept-Encoding header and decompresses them regardless of this
+        /// setting.
+        ProjectClientBuilder& http_compression_threshold(std::size_t threshold);
+
         /// \brief Sets the HTTP log level to set the HTTP client to.
         /// \param http_log_level The HTTP log level.
         /// \return This builder for chaining.
         ProjectClientBuilder& http_log_level(http::HttpLogLevel http_log_level);
 
+        /// \brief Sets the duration after which the built-in HTTP client evicts an unused connection from its pool.
+        /// \param http_idle_timeout The idle timeout.
+        /// \return This builder for chaining.
+        /// \remarks Has no effect if an HTTP client implementation is provided.
+        ProjectClientBuilder& http_idle_timeout(std::chrono::milliseconds http_idle_timeout);
+
+        /// \brief Sets the maximum number of keep-alive connections the built-in HTTP client may pool.
+        /// \param http_max_connections The maximum number of connections.
+        /// \return This builder for chaining.
+        /// \remarks Has no effect if an HTTP client implementation is provided.
+        ProjectClientBuilder& http_max_connections(std::size_t http_max_connections);
+
+        /// \brief Sets the number of connections the built-in HTTP client opens when it is started.
+        /// \param http_prewarmed_connections The number of connections.
+        /// \return This builder for chaining.
+        /// \remarks Has no effect if an HTTP client implementation is provided. The connections are opened in the
+        /// background, so starting the client does not wait for them.
+        ProjectClientBuilder& http_prewarmed_connections(std::size_t http_prewarmed_connections);
+
         /// \brief Sets the logger provider to be used by the client.
         /// \param logger_provider The logger provider.
         /// \return This builder for chaining.
@@ -125,13 +174,29 @@ public:
         /// \return This builder for chaining.
         ProjectClientBuilder& reauthentication_stopped_handler(std::function<void()> handler);
 
+        /// \brief Enables the client to collect its requests into batches, which are sent to the platform as one
+        /// request.
+        /// \param max_batch_size The number of requests at which a batch is sent.
+        /// \param max_delay The maximum time a request waits for its batch to fill.
+        /// \return This builder for chaining.
+        /// \remarks See BaseSchema::set_request_batching() for how batches are sent.
+        ProjectClientBuilder& request_batching(std::size_t max_batch_size, std::chrono::milliseconds max_delay);
+
     private:
         std::optional<std::function<void()>> m_reauthentication_stopped_handler;
         std::optional<std::string> m_base_uri;
         std::optional<bool> m_automatic_reauthentication;
+        std::shared_ptr<utils::IExecutor> m_executor;
         std::unique_ptr<http::IHttpClient> m_http_client;
+        std::optional<std::size_t> m_http_compression_threshold;
+        std::optional<std::chrono::milliseconds> m_http_idle_timeout;
         std::optional<http::HttpLogLevel> m_http_log_level;
+        std::optional<std::size_t> m_http_max_connections;
+        std::optional<std::size_t> m_http_prewarmed_connections;
         std::shared_ptr<utils::LoggerProvider> m_logger_provider;
+        std::optional<std::size_t> m_request_batch_size;
+        std::chrono::milliseconds m_request_batch_delay = std::chrono::milliseconds(0);
+        std::optional<bool> m_request_coalescing;
 
         ProjectClientBuilder() = default;
 
@@ -155,7 +220,8 @@ private:
     ProjectClient(std::unique_ptr<http::IHttpClient> http_client,
                   bool automatic_reauthentication,
                   std::shared_ptr<utils::LoggerProvider> logger_provider,
-                  std::optional<std::function<void()>> reauthentication_stopped_handler);
+                  std::optional<std::function<void()>> reauthentication_stopped_handler,
+                  std::shared_ptr<utils::IExecutor> executor);
 
     void auth(std::optional<std::string> token, std::optional<long> expires_in);
 
@@ -0,0 +1,68 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_STRINGINTERNPOOL_HPP
+#define ENJINSDK_STRINGINTERNPOOL_HPP
+
+#include "enjinsdk_export.h"
+#include <cstddef>
+
+namespace enjin::sdk::utils {
+
+/// \brief The default maximum number of distinct strings held by the string intern pool.
+constexpr std::size_t DefaultMaxInternedStrings = 1024 * 1024;
+
+/// \brief Running totals of the string intern pool.
+struct ENJINSDK_EXPORT StringInternPoolStats {
+    /// \brief The number of distinct strings held by the pool.
+    std::size_t strings = 0;
+
+    /// \brief The number of strings which were found in the pool when interned.
+    std::size_t hits = 0;
+
+    /// \brief The number of strings which were not found in the pool when interned, including those not added for the
+    /// pool being full.
+    std::size_t misses = 0;
+};
+
+/// \brief Clears the string intern pool.
+/// \remarks Models keep the strings they were deserialized with, which are freed once no model holds them.
+ENJINSDK_EXPORT
+void clear_string_intern_pool();
+
+/// \brief Returns the totals of the string intern pool.
+/// \return The stats.
+ENJINSDK_EXPORT
+StringInternPoolStats get_string_intern_pool_stats();
+
+/// \brief Determines whether identifiers such as asset IDs and Ethereum addresses are interned when models are
+/// deserialized.
+/// \return Whether string interning is enabled.
+ENJINSDK_EXPORT
+bool is_string_interning_enabled();
+
+/// \brief Sets whether identifiers such as asset IDs and Ethereum addresses are interned when models are
+/// deserialized, which applies to every client in the process.
+/// \param enabled Whether to intern identifiers.
+/// \param max_strings The maximum number of distinct strings held by the pool, past which identifiers not yet in the
+/// pool are held by their model alone.
+/// \remarks Models deserialized with interning enabled share a single copy of each identifier and compare identifiers
+/// by address. Interning is disabled by default.
+ENJINSDK_EXPORT
+void set_string_interning(bool enabled, std::size_t max_strings = DefaultMaxInternedStrings);
+
+}
+
+#endif //ENJINSDK_STRINGINTERNPOOL_HPP
@@ -0,0 +1,89 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_THREADPOOLEXECUTOR_HPP
+#define ENJINSDK_THREADPOOLEXECUTOR_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/IExecutor.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace enjin::sdk::utils {
+
+/// \brief Bounded, work-stealing executor backed by a fixed set of worker threads.
+/// \remarks Each worker owns a task deque. Tasks scheduled from a worker are pushed to that worker's deque, which
+/// the worker takes its most recent task from, and idle workers steal the oldest tasks from the deques of busy ones.
+/// Workers with no task to run sleep until one is scheduled. Tasks scheduled while the executor already holds its
+/// maximum number of pending tasks are run on the calling thread, which throttles producers without risking a deadlock
+/// between workers.
+class ENJINSDK_EXPORT ThreadPoolExecutor : public IExecutor {
+public:
+    /// \brief Constructs an executor and starts its workers.
+    /// \param worker_count The number of worker threads. If zero, then the hardware concurrency of the system is used.
+    /// \param max_queue_depth The maximum number of pending tasks. If zero, then the number of pending tasks is not
+    /// bounded.
+    explicit ThreadPoolExecutor(std::size_t worker_count = 0,
+                                std::size_t max_queue_depth = DefaultMaxQueueDepth);
+
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+
+    ThreadPoolExecutor(ThreadPoolExecutor&&) = delete;
+
+    /// \brief Shuts down this executor and joins its workers.
+    ~ThreadPoolExecutor() override;
+
+    /// \copydoc IExecutor::execute(std::function<void()>)
+    /// \throws std::runtime_error If this executor has been shut down.
+    void execute(std::function<void()> task) override;
+
+    [[nodiscard]] bool is_worker_thread() const override;
+
+    /// \brief Stops accepting tasks, runs the tasks still pending and joins the workers.
+    void shutdown();
+
+    /// \brief Determines if this executor has been shut down.
+    /// \return Whether this executor has been shut down.
+    [[nodiscard]] bool is_shutdown() const;
+
+    /// \brief Returns the number of worker threads of this executor.
+    /// \return The number of workers.
+    [[nodiscard]] std::size_t get_worker_count() const;
+
+    /// \brief Returns the maximum number of pending tasks of this executor.
+    /// \return The maximum queue depth, or zero if not bounded.
+    [[nodiscard]] std::size_t get_max_queue_depth() const;
+
+    /// \brief Returns the number of tasks waiting to be run.
+    /// \return The number of pending tasks.
+    [[nodiscard]] std::size_t get_pending_count() const;
+
+    ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+    ThreadPoolExecutor& operator=(ThreadPoolExecutor&&) = delete;
+
+    /// \brief The default maximum number of pending tasks.
+    static constexpr std::size_t DefaultMaxQueueDepth = 1024;
+
+private:
+    class Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+}
+
+#endif //ENJINSDK_THREADPOOLEXECUTOR_HPP
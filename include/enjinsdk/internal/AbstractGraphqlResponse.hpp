@@ -18,8 +18,10 @@
 
 #include "enjinsdk_export.h"
 #include "enjinsdk/GraphqlError.hpp"
-#include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
 #include "enjinsdk/models/PaginationCursor.hpp"
+#include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -58,6 +60,26 @@ public:
     [[nodiscard]] virtual bool is_paginated() const noexcept = 0;
 
 protected:
+    AbstractGraphqlResponse() = default;
+
+    AbstractGraphqlResponse(const AbstractGraphqlResponse& other) = default;
+
+    AbstractGraphqlResponse(AbstractGraphqlResponse&& other) noexcept = default;
+
+    AbstractGraphqlResponse& operator=(const AbstractGraphqlResponse& rhs) = default;
+
+    /// \brief Handler for a JSON value read while streaming a response.
+    using ValueHandler = std::function<void(const json::JsonView&)>;
+
+    /// \brief Outcome of streaming a response with a list result.
+    struct ListStreamResult {
+        /// \brief Whether the items handed to the item handler make up the result.
+        bool has_items = false;
+
+        /// \brief Whether the result is paginated, in which case its cursor was handed to the cursor handler.
+        bool is_paginated = false;
+    };
+
     /// \brief Constant-expression representing the expected key for results in most data objects.
     static constexpr char ResultKey[] = "result";
 
@@ -65,12 +87,50 @@ protected:
     /// \param json The raw JSON.
     void process(const std::string& json);
 
+    /// \brief Processes this response from raw JSON input, parsing it in place.
+    /// \param json The raw JSON. Its contents are overwritten while parsing.
+    /// \remarks Strings in the parsed document may point into the input and every value is allocated from a single
+    /// arena sized from the length of the input, which is released in one go once processing finishes.
+    void process(std::string&& json);
+
+    /// \brief Processes this response from raw JSON input with a list result, reading the input with a SAX reader
+    /// instead of parsing all of it into a document.
+    /// \param json The raw JSON.
+    /// \param item_handler Handler called with each item of the result as soon as the item has been read.
+    /// \param cursor_handler Handler called with the pagination cursor of the result.
+    /// \return Whether the handled items make up the result and whether the result is paginated.
+    /// \remarks The result may either be an array of items or an object with an array of items and a cursor. Only the
+    /// item or cursor being handled is held as a JSON value at any one time, and the views handed to the handlers are
+    /// only valid until the handler returns. Nothing handled makes up the result if the input is not valid JSON.
+    ListStreamResult process_list(const std::string& json,
+                                  const ValueHandler& item_handler,
+                                  const ValueHandler& cursor_handler);
+
+    /// \brief Processes this response from shared raw JSON input with a list result, reading the input with a SAX
+    /// reader instead of parsing all of it into a document.
+    /// \param json The raw JSON.
+    /// \param item_handler Handler called with each item of the result as soon as the item has been read.
+    /// \param cursor_handler Handler called with the pagination cursor of the result.
+    /// \return Whether the handled items make up the result and whether the result is paginated.
+    /// \remarks As process_list() for unshared input, except that the views of items which are objects carry the
+    /// spans of their members which are objects or arrays. Models read from them may keep those members undecoded,
+    /// sharing the input until they are decoded.
+    ListStreamResult process_list(const std::shared_ptr<const std::string>& json,
+                                  const ValueHandler& item_handler,
+                                  const ValueHandler& cursor_handler);
+
     /// \brief Processes the data member of a serialized GraphQL response.
     /// \param data The JSON object of the data field.
-    virtual void process_data(const json::JsonValue& data) = 0;
+    /// \remarks Does nothing by default, for responses which read their result with process_list() instead.
+    virtual void process_data(const json::JsonView& data);
 
 private:
     std::optional<std::vector<GraphqlError>> errors;
+
+    ListStreamResult read_list(const std::string& json,
+                               const std::shared_ptr<const std::string>& shared_json,
+                               const ValueHandler& item_handler,
+                               const ValueHandler& cursor_handler);
 };
 
 }
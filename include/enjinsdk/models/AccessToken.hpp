@@ -30,7 +30,7 @@ public:
     /// \brief Constructs an instance of this class.
     AccessToken();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     AccessToken(const AccessToken& other);
 
@@ -43,6 +43,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the auth token.
     /// \return The auth token.
     [[nodiscard]] const std::optional<std::string>& get_token() const;
@@ -60,7 +62,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
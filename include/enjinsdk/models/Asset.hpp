@@ -35,7 +35,7 @@ public:
     /// \brief Constructs an instance of this class.
     Asset();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     Asset(const Asset& other);
 
@@ -48,6 +48,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the ID of this asset.
     /// \return The ID.
     [[nodiscard]] const std::optional<std::string>& get_id() const;
@@ -91,7 +93,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
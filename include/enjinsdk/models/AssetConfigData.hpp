@@ -32,7 +32,7 @@ public:
     /// \brief Constructs an instance of this class.
     AssetConfigData();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     AssetConfigData(const AssetConfigData& other);
 
@@ -45,6 +45,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the melt fee ratio of the asset this config belongs too.
     /// \return The ratio.
     /// \remarks The ratio is in the range of 0-10000 to allow for fractional ratios. e.g. 1 = 0.01%, 10000 = 100%,
@@ -82,7 +84,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
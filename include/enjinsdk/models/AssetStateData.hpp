@@ -31,7 +31,7 @@ public:
     /// \brief Constructs an instance of this class.
     AssetStateData();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     AssetStateData(const AssetStateData& other);
 
@@ -44,6 +44,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the fungible state of the asset this state belongs to.
     /// \return Whether this asset is fungible.
     [[nodiscard]] const std::optional<bool>& get_non_fungible() const;
@@ -89,7 +91,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -31,7 +31,7 @@ public:
     /// \brief Constructs an instance of this class.
     AssetTransferFeeSettings();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     AssetTransferFeeSettings(const AssetTransferFeeSettings& other);
 
@@ -44,6 +44,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the transfer fee type.
     /// \return The transfer type.
     [[nodiscard]] const std::optional<AssetTransferFeeType>& get_type() const;
@@ -65,7 +67,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
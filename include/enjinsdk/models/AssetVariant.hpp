@@ -31,7 +31,7 @@ public:
     /// \brief Constructs an instance of this class.
     AssetVariant();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     AssetVariant(const AssetVariant& other);
 
@@ -44,6 +44,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the ID of this variant.
     /// \return The ID.
     [[nodiscard]] const std::optional<int>& get_id() const;
@@ -79,7 +81,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -34,7 +34,7 @@ public:
     /// \brief Constructs an instance of this class.
     Balance();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     Balance(const Balance& other);
 
@@ -47,6 +47,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the asset ID for this balance.
     /// \return The asset ID.
     [[nodiscard]] const std::optional<std::string>& get_id() const;
@@ -76,7 +78,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -31,7 +31,7 @@ public:
     /// \brief Constructs an instance of this class.
     BlockchainData();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     BlockchainData(const BlockchainData& other);
 
@@ -44,6 +44,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the encoded data of the request this data container belongs to.
     /// \return The encoded data.
     [[nodiscard]] const std::optional<std::string>& get_encoded_data() const;
@@ -81,7 +83,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -31,7 +31,7 @@ public:
     /// \brief Constructs an instance of this class.
     Contracts();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     Contracts(const Contracts& other);
 
@@ -44,6 +44,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the ENJ contract address.
     /// \return The contract address.
     [[nodiscard]] const std::optional<std::string>& get_enj() const;
@@ -69,7 +71,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
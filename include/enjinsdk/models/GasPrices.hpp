@@ -30,7 +30,7 @@ public:
     /// \brief Constructs an instance of this class.
     GasPrices();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     GasPrices(const GasPrices& other);
 
@@ -43,6 +43,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the recommended safe gas price in Gwei.
     /// \return The gas price.
     /// \remarks Expected to be mined in less than 30 minutes.
@@ -72,7 +74,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -30,7 +30,7 @@ public:
     /// \brief Constructs an instance of this class.
     LinkingInfo();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     LinkingInfo(const LinkingInfo& other);
 
@@ -43,6 +43,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the linking code used to link a wallet to the player this info belongs to.
     /// \return The linking code.
     [[nodiscard]] const std::optional<std::string>& get_code() const;
@@ -60,7 +62,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -43,6 +43,8 @@ public:
 
     [[nodiscard]] std::string serialize() const override;
 
+    void serialize(json::JsonWriter& writer) const override;
+
     /// \brief Sets the Ethereum address to mint to.
     /// \param address The address.
     /// \return This input for chaining.
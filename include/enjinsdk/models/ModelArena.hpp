@@ -0,0 +1,133 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINCPPSDK_MODELARENA_HPP
+#define ENJINCPPSDK_MODELARENA_HPP
+
+#include "enjinsdk_export.h"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace enjin::sdk::models {
+
+class ArenaAllocated;
+
+/// \brief The default number of items of a list result whose models are allocated from each arena of a
+/// PagedModelArenaScope.
+constexpr std::size_t DefaultItemsPerModelArena = 16;
+
+/// \brief Arena which models are allocated from while a ModelArenaScope is open for it, so the models deserialized
+/// together are allocated and released together instead of one at a time.
+/// \remarks Copies of an arena share it. The memory of the arena is released once the arena and every model allocated
+/// from it have been destroyed, so models allocated from it may safely outlive it.
+class ENJINSDK_EXPORT ModelArena final {
+public:
+    /// \brief Constructs an arena.
+    /// \param initial_size The size of the first block taken from the upstream resource, or zero to let the arena
+    /// choose it.
+    /// \param upstream The memory resource the arena takes its blocks from. Must outlive every model allocated from
+    /// the arena.
+    explicit ModelArena(std::size_t initial_size = 0,
+                        std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    ModelArena(const ModelArena& other) = default;
+
+    ModelArena(ModelArena&& other) noexcept = default;
+
+    ~ModelArena();
+
+    ModelArena& operator=(const ModelArena& rhs) = default;
+
+    ModelArena& operator=(ModelArena&& rhs) noexcept = default;
+
+private:
+    class Impl;
+
+    std::shared_ptr<Impl> pimpl;
+
+    /// \brief Returns the arena of the innermost scope open on the calling thread.
+    /// \return The arena, or null if no scope is open.
+    static std::shared_ptr<Impl>& current() noexcept;
+
+    friend class ArenaAllocated;
+    friend class ModelArenaScope;
+    friend class PagedModelArenaScope;
+};
+
+/// \brief Scope in which models constructed on the calling thread are allocated from an arena.
+/// \remarks Scopes may be nested, in which case the innermost one applies. An arena must not be open in scopes on more
+/// than one thread at a time.
+class ENJINSDK_EXPORT ModelArenaScope final {
+public:
+    /// \brief Opens a scope for the given arena on the calling thread.
+    /// \param arena The arena.
+    explicit ModelArenaScope(const ModelArena& arena);
+
+    ModelArenaScope(const ModelArenaScope& other) = delete;
+
+    ModelArenaScope(ModelArenaScope&& other) = delete;
+
+    /// \brief Closes this scope, restoring the scope which was open when it was opened.
+    ~ModelArenaScope();
+
+    ModelArenaScope& operator=(const ModelArenaScope& rhs) = delete;
+
+    ModelArenaScope& operator=(ModelArenaScope&& rhs) = delete;
+
+private:
+    std::shared_ptr<ModelArena::Impl> previous;
+};
+
+/// \brief Scope in which the models of the items of a list result are allocated on the calling thread, taking a new
+/// arena every given number of items.
+/// \remarks A model kept after the rest of the list has been destroyed therefore only keeps the arena of a few items
+/// alive, rather than that of the whole list. Each arena after the first starts with a block as large as the memory
+/// the previous arena used.
+class ENJINSDK_EXPORT PagedModelArenaScope final {
+public:
+    /// \brief Opens a scope on the calling thread, in which models are allocated from the global heap until the first
+    /// item is begun.
+    /// \param items_per_arena The number of items whose models are allocated from each arena.
+    /// \param upstream The memory resource the arenas take their blocks from. Must outlive every model allocated from
+    /// the arenas.
+    explicit PagedModelArenaScope(std::size_t items_per_arena = DefaultItemsPerModelArena,
+                                  std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    PagedModelArenaScope(const PagedModelArenaScope& other) = delete;
+
+    PagedModelArenaScope(PagedModelArenaScope&& other) = delete;
+
+    /// \brief Closes this scope, restoring the scope which was open when it was opened.
+    ~PagedModelArenaScope();
+
+    /// \brief Begins the next item, taking a new arena for its models if the current arena holds the models of as
+    /// many items as it may.
+    void begin_item();
+
+    PagedModelArenaScope& operator=(const PagedModelArenaScope& rhs) = delete;
+
+    PagedModelArenaScope& operator=(PagedModelArenaScope&& rhs) = delete;
+
+private:
+    std::shared_ptr<ModelArena::Impl> previous;
+    std::pmr::memory_resource* upstream;
+    std::size_t items_per_arena;
+    std::size_t items_in_arena = 0;
+};
+
+}
+
+#endif //ENJINCPPSDK_MODELARENA_HPP
@@ -31,7 +31,7 @@ public:
     /// \brief Constructs an instance of this class.
     Notifications();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     Notifications(const Notifications& other);
 
@@ -44,6 +44,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the Pusher settings of the platform.
     /// \return The Pusher settings.
     [[nodiscard]] const std::optional<Pusher>& get_pusher() const;
@@ -57,7 +59,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -30,7 +30,7 @@ public:
     /// \brief Constructs an instance of this class.
     PaginationCursor();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     PaginationCursor(const PaginationCursor& other);
 
@@ -43,6 +43,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the total number of items selected by this cursor.
     /// \return The total number of items.
     [[nodiscard]] const std::optional<int>& get_total() const;
@@ -84,7 +86,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -32,7 +32,7 @@ public:
     /// \brief Constructs an instance of this class.
     Platform();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     Platform(const Platform& other);
 
@@ -45,6 +45,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the ID of this platform.
     /// \return The ID.
     [[nodiscard]] const std::optional<int>& get_id() const;
@@ -74,7 +76,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
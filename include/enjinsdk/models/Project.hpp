@@ -30,7 +30,7 @@ public:
     /// \brief Constructs an instance of this class.
     Project();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     Project(const Project& other);
 
@@ -43,6 +43,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the UUID of this project.
     /// \return The UUID.
     [[nodiscard]] const std::optional<std::string>& get_uuid() const;
@@ -78,7 +80,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -30,7 +30,7 @@ public:
     /// \brief Constructs an instance of this class.
     PusherOptions();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     PusherOptions(const PusherOptions& other);
 
@@ -43,6 +43,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the cluster the platform is in.
     /// \return The cluster.
     [[nodiscard]] const std::optional<std::string>& get_cluster() const;
@@ -60,7 +62,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -0,0 +1,208 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINCPPSDK_RESULTTABLE_HPP
+#define ENJINCPPSDK_RESULTTABLE_HPP
+
+#include "enjinsdk_export.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace enjin::sdk::models {
+
+/// \brief Bitmap recording which rows of a column have a value.
+class ENJINSDK_EXPORT PresenceBitmap final {
+public:
+    /// \brief Constructs an empty bitmap.
+    PresenceBitmap() = default;
+
+    /// \brief Appends a row to this bitmap.
+    /// \param is_present Whether the row has a value.
+    void push_back(bool is_present);
+
+    /// \brief Removes every row from this bitmap.
+    void clear() noexcept;
+
+    /// \brief Returns the number of rows which have a value.
+    /// \return The number of rows.
+    [[nodiscard]] std::size_t count() const noexcept;
+
+    /// \brief Returns the words of this bitmap, where bit i % 64 of word i / 64 is set if row i has a value.
+    /// \return The words.
+    /// \remarks Bits past the last row are never set.
+    [[nodiscard]] const std::vector<std::uint64_t>& get_words() const noexcept;
+
+    /// \brief Returns the number of rows in this bitmap.
+    /// \return The number of rows.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// \brief Determines whether the given row has a value.
+    /// \param row The row, which must be less than the size of this bitmap.
+    /// \return Whether the row has a value.
+    [[nodiscard]] bool test(std::size_t row) const noexcept;
+
+    bool operator==(const PresenceBitmap& rhs) const;
+
+    bool operator!=(const PresenceBitmap& rhs) const;
+
+private:
+    std::vector<std::uint64_t> words;
+    std::size_t rows = 0;
+};
+
+/// \brief Column of a result table holding a number, boolean or enum value for each row.
+/// \tparam T The type of the values.
+template<class T>
+class Column final {
+public:
+    /// \brief Constructs an empty column.
+    Column() = default;
+
+    /// \brief Appends a row to this column.
+    /// \param value The value of the row, if it has one.
+    void push_back(const std::optional<T>& value) {
+        values.push_back(value.value_or(T()));
+        presence.push_back(value.has_value());
+    }
+
+    /// \brief Removes every row from this column.
+    void clear() noexcept {
+        values.clear();
+        presence.clear();
+    }
+
+    /// \brief Returns the value of the given row.
+    /// \param row The row, which must be less than the size of this column.
+    /// \return The value, or an empty optional if the row does not have one.
+    [[nodiscard]] std::optional<T> get(std::size_t row) const {
+        return presence.test(row) ? std::optional<T>(values[row]) : std::nullopt;
+    }
+
+    /// \brief Returns the bitmap recording which rows of this column have a value.
+    /// \return The bitmap.
+    [[nodiscard]] const PresenceBitmap& get_presence() const noexcept {
+        return presence;
+    }
+
+    /// \brief Returns the contiguous values of this column.
+    /// \return The values.
+    /// \remarks Rows without a value hold a value-initialized T, so the values may be summed without checking the
+    /// presence of each row.
+    [[nodiscard]] const std::vector<T>& get_values() const noexcept {
+        return values;
+    }
+
+    /// \brief Returns the number of rows in this column.
+    /// \return The number of rows.
+    [[nodiscard]] std::size_t size() const noexcept {
+        return values.size();
+    }
+
+    bool operator==(const Column<T>& rhs) const {
+        return values == rhs.values
+               && presence == rhs.presence;
+    }
+
+    bool operator!=(const Column<T>& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    std::vector<T> values;
+    PresenceBitmap presence;
+};
+
+/// \brief Column of a result table holding a string for each row, where each distinct string is stored once.
+class ENJINSDK_EXPORT StringColumn final {
+public:
+    /// \brief Constructs an empty column.
+    StringColumn() = default;
+
+    /// \brief Constructs an instance as a copy of another.
+    /// \param other The other instance.
+    StringColumn(const StringColumn& other);
+
+    /// \brief Constructs an instance via move.
+    /// \param other The other instance being moved.
+    StringColumn(StringColumn&& other) noexcept = default;
+
+    /// \brief Deconstructs this instance.
+    ~StringColumn() = default;
+
+    /// \brief Appends a row to this column.
+    /// \param value The value of the row, if it has one.
+    void push_back(std::optional<std::string_view> value);
+
+    /// \brief Removes every row and string from this column.
+    void clear() noexcept;
+
+    /// \brief Returns the value of the given row.
+    /// \param row The row, which must be less than the size of this column.
+    /// \return The value, or an empty optional if the row does not have one.
+    /// \remarks The returned view is valid until this column is modified or destroyed.
+    [[nodiscard]] std::optional<std::string_view> get(std::size_t row) const;
+
+    /// \brief Returns the code of each row, which is the index of its value in the dictionary of this column.
+    /// \return The codes.
+    /// \remarks Rows without a value have a code of zero, so the presence of a row must be checked before using its
+    /// code. Rows with equal values have equal codes, so rows may be grouped by their code.
+    [[nodiscard]] const std::vector<std::uint32_t>& get_codes() const noexcept;
+
+    /// \brief Returns the distinct strings of this column, in the order they were first appended.
+    /// \return The strings, which are valid until this column is cleared or destroyed.
+    [[nodiscard]] const std::vector<std::string_view>& get_dictionary() const noexcept;
+
+    /// \brief Returns the bitmap recording which rows of this column have a value.
+    /// \return The bitmap.
+    [[nodiscard]] const PresenceBitmap& get_presence() const noexcept;
+
+    /// \brief Returns the number of rows in this column.
+    /// \return The number of rows.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    bool operator==(const StringColumn& rhs) const;
+
+    bool operator!=(const StringColumn& rhs) const;
+
+    StringColumn& operator=(const StringColumn& rhs);
+
+    StringColumn& operator=(StringColumn&& rhs) noexcept = default;
+
+private:
+    std::vector<std::uint32_t> codes;
+    std::deque<std::string> strings;
+    std::vector<std::string_view> dictionary;
+    std::unordered_map<std::string_view, std::uint32_t> codes_by_string;
+    PresenceBitmap presence;
+
+    std::uint32_t intern(std::string_view value);
+};
+
+/// \brief Result of a list query decoded into a column for each scalar field of the model instead of a model for each
+/// item.
+/// \tparam T The model of the items.
+/// \remarks Specialized for the models of large list queries. Nested objects of the items are not decoded.
+template<class T>
+class ResultTable;
+
+}
+
+#endif //ENJINCPPSDK_RESULTTABLE_HPP
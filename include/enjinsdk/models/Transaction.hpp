@@ -38,7 +38,7 @@ public:
     /// \brief Constructs an instance of this class.
     Transaction();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     Transaction(const Transaction& other);
 
@@ -51,6 +51,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the ID of this transaction.
     /// \return The ID.
     [[nodiscard]] const std::optional<int>& get_id() const;
@@ -126,7 +128,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
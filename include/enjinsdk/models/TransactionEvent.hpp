@@ -32,7 +32,7 @@ public:
     /// \brief Constructs an instance of this class.
     TransactionEvent();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     TransactionEvent(const TransactionEvent& other);
 
@@ -45,6 +45,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the name of this event.
     /// \return The name.
     [[nodiscard]] const std::optional<std::string>& get_name() const;
@@ -79,7 +81,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -33,7 +33,7 @@ public:
     /// \brief Constructs an instance of this class.
     TransactionLog();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     TransactionLog(const TransactionLog& other);
 
@@ -46,6 +46,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the block number.
     /// \return The block number.
     [[nodiscard]] const std::optional<int>& get_block_number() const;
@@ -79,7 +81,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -32,7 +32,7 @@ public:
     /// \brief Constructs an instance of this class.
     TransactionReceipt();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     TransactionReceipt(const TransactionReceipt& other);
 
@@ -45,6 +45,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the hash of the block for the transaction this receipt belongs to.
     /// \return The block hash.
     [[nodiscard]] const std::optional<std::string>& get_block_hash() const;
@@ -95,7 +97,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -0,0 +1,125 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef ENJINCPPSDK_TRANSACTIONTABLE_HPP
+#define ENJINCPPSDK_TRANSACTIONTABLE_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/JsonView.hpp"
+#include "enjinsdk/models/Transaction.hpp"
+#include "enjinsdk/models/TransactionState.hpp"
+#include "enjinsdk/models/TransactionType.hpp"
+#include "enjinsdk/models/ResultTable.hpp"
+#include <cstddef>
+#include <memory>
+
+namespace enjin::sdk::models {
+
+/// \brief Models transactions in a result table, with a column for each scalar field of the transactions.
+template<>
+class ENJINSDK_EXPORT ResultTable<Transaction> final {
+public:
+    /// \brief Constructs an empty table.
+    ResultTable();
+
+    /// \brief Constructs an instance as a copy of another.
+    /// \param other The other instance.
+    ResultTable(const ResultTable& other);
+
+    /// \brief Constructs an instance via move.
+    /// \param other The other instance being moved.
+    ResultTable(ResultTable&& other) noexcept;
+
+    /// \brief Deconstructs this instance.
+    ~ResultTable();
+
+    /// \brief Appends a row to this table with the fields of a JSON object of a transaction.
+    /// \param item The JSON object. A row without values is appended if it is not an object.
+    void append(const json::JsonView& item);
+
+    /// \brief Removes every row from this table.
+    void clear();
+
+    /// \brief Returns the number of rows in this table.
+    /// \return The number of rows.
+    [[nodiscard]] std::size_t size() const;
+
+    /// \brief Returns the column of the IDs of the transactions.
+    /// \return The column.
+    [[nodiscard]] const Column<int>& get_ids() const;
+
+    /// \brief Returns the column of the hash IDs of the transactions.
+    /// \return The column.
+    [[nodiscard]] const StringColumn& get_transaction_ids() const;
+
+    /// \brief Returns the column of the titles of the transactions.
+    /// \return The column.
+    [[nodiscard]] const StringColumn& get_titles() const;
+
+    /// \brief Returns the column of the contract addresses of the transactions.
+    /// \return The column.
+    [[nodiscard]] const StringColumn& get_contracts() const;
+
+    /// \brief Returns the column of the types of the transactions.
+    /// \return The column.
+    [[nodiscard]] const Column<TransactionType>& get_types() const;
+
+    /// \brief Returns the column of the values of the transactions.
+    /// \return The column.
+    [[nodiscard]] const StringColumn& get_values() const;
+
+    /// \brief Returns the column of the retry states of the transactions.
+    /// \return The column.
+    [[nodiscard]] const StringColumn& get_retry_states() const;
+
+    /// \brief Returns the column of the states of the transactions.
+    /// \return The column.
+    [[nodiscard]] const Column<TransactionState>& get_states() const;
+
+    /// \brief Returns the column of the whether each of the transactions has been accepted.
+    /// \return The column.
+    [[nodiscard]] const Column<bool>& get_accepted() const;
+
+    /// \brief Returns the column of the whether the wallet of each of the transactions is a project wallet.
+    /// \return The column.
+    [[nodiscard]] const Column<bool>& get_project_wallets() const;
+
+    /// \brief Returns the column of the datetimes when the transactions were created.
+    /// \return The column.
+    [[nodiscard]] const StringColumn& get_created_at() const;
+
+    /// \brief Returns the column of the datetimes when the transactions were last updated.
+    /// \return The column.
+    [[nodiscard]] const StringColumn& get_updated_at() const;
+
+    bool operator==(const ResultTable& rhs) const;
+
+    bool operator!=(const ResultTable& rhs) const;
+
+    ResultTable& operator=(const ResultTable& rhs);
+
+private:
+    class Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+/// \brief Result table of transactions.
+using TransactionTable = ResultTable<Transaction>;
+
+}
+
+#endif //ENJINCPPSDK_TRANSACTIONTABLE_HPP
@@ -43,6 +43,8 @@ public:
 
     [[nodiscard]] std::string serialize() const override;
 
+    void serialize(json::JsonWriter& writer) const override;
+
     /// Sets the source Ethereum address.
     /// \param address The source.
     /// \return This input for chaining.
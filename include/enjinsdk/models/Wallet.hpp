@@ -38,7 +38,7 @@ public:
     /// \brief Constructs an instance of this class.
     Wallet();
 
-    /// \brief Constructs an instance as a copy of another.
+    /// \brief Constructs an instance as a copy of another, sharing its state until either is deserialized.
     /// \param other The other instance.
     Wallet(const Wallet& other);
 
@@ -51,6 +51,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const json::JsonView& json) override;
+
     /// \brief Returns the Ethereum address of this wallet.
     /// \return The address.
     [[nodiscard]] const std::optional<std::string>& get_eth_address() const;
@@ -88,7 +90,7 @@ public:
 private:
     class Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
 };
 
 }
@@ -0,0 +1,91 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef ENJINCPPSDK_WALLETTABLE_HPP
+#define ENJINCPPSDK_WALLETTABLE_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/JsonView.hpp"
+#include "enjinsdk/models/Wallet.hpp"
+#include "enjinsdk/models/ResultTable.hpp"
+#include <cstddef>
+#include <memory>
+
+namespace enjin::sdk::models {
+
+/// \brief Models wallets in a result table, with a column for each scalar field of the wallets.
+template<>
+class ENJINSDK_EXPORT ResultTable<Wallet> final {
+public:
+    /// \brief Constructs an empty table.
+    ResultTable();
+
+    /// \brief Constructs an instance as a copy of another.
+    /// \param other The other instance.
+    ResultTable(const ResultTable& other);
+
+    /// \brief Constructs an instance via move.
+    /// \param other The other instance being moved.
+    ResultTable(ResultTable&& other) noexcept;
+
+    /// \brief Deconstructs this instance.
+    ~ResultTable();
+
+    /// \brief Appends a row to this table with the fields of a JSON object of a wallet.
+    /// \param item The JSON object. A row without values is appended if it is not an object.
+    void append(const json::JsonView& item);
+
+    /// \brief Removes every row from this table.
+    void clear();
+
+    /// \brief Returns the number of rows in this table.
+    /// \return The number of rows.
+    [[nodiscard]] std::size_t size() const;
+
+    /// \brief Returns the column of the Ethereum addresses of the wallets.
+    /// \return The column.
+    [[nodiscard]] const StringColumn& get_eth_addresses() const;
+
+    /// \brief Returns the column of the ENJ allowances given for crypto-items by the wallets.
+    /// \return The column.
+    [[nodiscard]] const Column<float>& get_enj_allowances() const;
+
+    /// \brief Returns the column of the ENJ balances of the wallets.
+    /// \return The column.
+    [[nodiscard]] const Column<float>& get_enj_balances() const;
+
+    /// \brief Returns the column of the ETH balances of the wallets.
+    /// \return The column.
+    [[nodiscard]] const Column<float>& get_eth_balances() const;
+
+    bool operator==(const ResultTable& rhs) const;
+
+    bool operator!=(const ResultTable& rhs) const;
+
+    ResultTable& operator=(const ResultTable& rhs);
+
+private:
+    class Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+/// \brief Result table of wallets.
+using WalletTable = ResultTable<Wallet>;
+
+}
+
+#endif //ENJINCPPSDK_WALLETTABLE_HPP
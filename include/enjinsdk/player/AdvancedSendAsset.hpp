@@ -37,6 +37,8 @@ public:
 
     [[nodiscard]] std::string serialize() const override;
 
+    void serialize(json::JsonWriter& writer) const override;
+
     /// \brief Sets the different transfers to perform.
     /// \param transfers The transfers.
     /// \return This request for chaining.
@@ -17,6 +17,7 @@
 #define ENJINCPPSDK_IPLAYERSCHEMA_HPP
 
 #include "enjinsdk_export.h"
+#include "enjinsdk/GraphqlCallback.hpp"
 #include "enjinsdk/GraphqlResponse.hpp"
 #include "enjinsdk/models/Player.hpp"
 #include "enjinsdk/models/Transaction.hpp"
@@ -52,75 +53,154 @@ public:
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> advanced_send_asset(AdvancedSendAsset request) = 0;
 
+    /// \brief Sends the AdvancedSendAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void advanced_send_asset(AdvancedSendAsset request,
+                                     graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the ApproveEnj request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> approve_enj(ApproveEnj request) = 0;
 
+    /// \brief Sends the ApproveEnj request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void approve_enj(ApproveEnj request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the ApproveMaxEnj request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> approve_enj_max(ApproveMaxEnj request) = 0;
 
+    /// \brief Sends the ApproveMaxEnj request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void approve_enj_max(ApproveMaxEnj request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the BridgeAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> bridge_asset(BridgeAsset request) = 0;
 
+    /// \brief Sends the BridgeAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void bridge_asset(BridgeAsset request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the BridgeAssets request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> bridge_assets(BridgeAssets request) = 0;
 
+    /// \brief Sends the BridgeAssets request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void bridge_assets(BridgeAssets request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the BridgeClaimAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> bridge_claim_asset(BridgeClaimAsset request) = 0;
 
+    /// \brief Sends the BridgeClaimAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void bridge_claim_asset(BridgeClaimAsset request,
+                                    graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the GetPlayer request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Player>> get_player(GetPlayer request) = 0;
 
+    /// \brief Sends the GetPlayer request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_player(GetPlayer request, graphql::GraphqlCallback<models::Player> callback) = 0;
+
     /// \brief Sends the GetWallet request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Wallet>> get_wallet(GetWallet request) = 0;
 
+    /// \brief Sends the GetWallet request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_wallet(GetWallet request, graphql::GraphqlCallback<models::Wallet> callback) = 0;
+
     /// \brief Sends the MeltAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> melt_asset(MeltAsset request) = 0;
 
+    /// \brief Sends the MeltAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void melt_asset(MeltAsset request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the Message request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> message(Message request) = 0;
 
+    /// \brief Sends the Message request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void message(Message request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the ResetEnjApproval request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> reset_enj_approval(ResetEnjApproval request) = 0;
 
+    /// \brief Sends the ResetEnjApproval request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void reset_enj_approval(ResetEnjApproval request,
+                                    graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SendAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> send_asset(SendAsset request) = 0;
 
+    /// \brief Sends the SendAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void send_asset(SendAsset request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SendEnj request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> send_enj(SendEnj request) = 0;
 
+    /// \brief Sends the SendEnj request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void send_enj(SendEnj request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SetApprovalForAll request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> set_approval_for_all(SetApprovalForAll request) = 0;
 
+    /// \brief Sends the SetApprovalForAll request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void set_approval_for_all(SetApprovalForAll request,
+                                      graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the UnlinkWallet request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<bool>> unlink_wallet(UnlinkWallet request) = 0;
+
+    /// \brief Sends the UnlinkWallet request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void unlink_wallet(UnlinkWallet request, graphql::GraphqlCallback<bool> callback) = 0;
 };
 
 }
@@ -36,40 +36,74 @@ public:
 
     std::future<graphql::GraphqlResponse<models::Transaction>> advanced_send_asset(AdvancedSendAsset request) override;
 
+    void advanced_send_asset(AdvancedSendAsset request,
+                             graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> approve_enj(ApproveEnj request) override;
 
+    void approve_enj(ApproveEnj request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> approve_enj_max(ApproveMaxEnj request) override;
 
+    void approve_enj_max(ApproveMaxEnj request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> bridge_asset(BridgeAsset request) override;
 
+    void bridge_asset(BridgeAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> bridge_assets(BridgeAssets request) override;
 
+    void bridge_assets(BridgeAssets request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> bridge_claim_asset(BridgeClaimAsset request) override;
 
+    void bridge_claim_asset(BridgeClaimAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Player>> get_player(GetPlayer request) override;
 
+    void get_player(GetPlayer request, graphql::GraphqlCallback<models::Player> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Wallet>> get_wallet(GetWallet request) override;
 
+    void get_wallet(GetWallet request, graphql::GraphqlCallback<models::Wallet> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> melt_asset(MeltAsset request) override;
 
+    void melt_asset(MeltAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> message(Message request) override;
 
+    void message(Message request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> reset_enj_approval(ResetEnjApproval request) override;
 
+    void reset_enj_approval(ResetEnjApproval request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> send_asset(SendAsset request) override;
 
+    void send_asset(SendAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> send_enj(SendEnj request) override;
 
+    void send_enj(SendEnj request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> set_approval_for_all(SetApprovalForAll request) override;
 
+    void set_approval_for_all(SetApprovalForAll request,
+                              graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<bool>> unlink_wallet(UnlinkWallet request) override;
 
+    void unlink_wallet(UnlinkWallet request, graphql::GraphqlCallback<bool> callback) override;
+
 protected:
     /// \brief Constructs an instance of this class.
     /// \param http_client The HTTP client.
     /// \param logger_provider The logger provider.
+    /// \param executor The executor.
     PlayerSchema(std::unique_ptr<http::IHttpClient> http_client,
-                 std::shared_ptr<utils::LoggerProvider> logger_provider);
+                 std::shared_ptr<utils::LoggerProvider> logger_provider,
+                 std::shared_ptr<utils::IExecutor> executor = nullptr);
 };
 
 }
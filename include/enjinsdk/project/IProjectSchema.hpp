@@ -17,11 +17,13 @@
 #define ENJINCPPSDK_IPROJECTSCHEMA_HPP
 
 #include "enjinsdk_export.h"
+#include "enjinsdk/GraphqlCallback.hpp"
 #include "enjinsdk/GraphqlResponse.hpp"
 #include "enjinsdk/models/AccessToken.hpp"
 #include "enjinsdk/models/Player.hpp"
 #include "enjinsdk/models/Transaction.hpp"
 #include "enjinsdk/models/Wallet.hpp"
+#include "enjinsdk/models/WalletTable.hpp"
 #include "enjinsdk/project/AdvancedSendAsset.hpp"
 #include "enjinsdk/project/ApproveEnj.hpp"
 #include "enjinsdk/project/ApproveMaxEnj.hpp"
@@ -72,172 +74,360 @@ public:
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> advanced_send_asset(AdvancedSendAsset request) = 0;
 
+    /// \brief Sends the AdvancedSendAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void advanced_send_asset(AdvancedSendAsset request,
+                                     graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the ApproveEnj request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> approve_enj(ApproveEnj request) = 0;
 
+    /// \brief Sends the ApproveEnj request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void approve_enj(ApproveEnj request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the ApproveMaxEnj request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> approve_enj_max(ApproveMaxEnj request) = 0;
 
+    /// \brief Sends the ApproveMaxEnj request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void approve_enj_max(ApproveMaxEnj request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the AuthPlayer request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::AccessToken>> auth_player(AuthPlayer request) = 0;
 
+    /// \brief Sends the AuthPlayer request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void auth_player(AuthPlayer request, graphql::GraphqlCallback<models::AccessToken> callback) = 0;
+
     /// \brief Sends the AuthProject request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::AccessToken>> auth_project(AuthProject request) = 0;
 
+    /// \brief Sends the AuthProject request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void auth_project(AuthProject request, graphql::GraphqlCallback<models::AccessToken> callback) = 0;
+
     /// \brief Sends the BridgeAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> bridge_asset(BridgeAsset request) = 0;
 
+    /// \brief Sends the BridgeAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void bridge_asset(BridgeAsset request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the BridgeAssets request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> bridge_assets(BridgeAssets request) = 0;
 
+    /// \brief Sends the BridgeAssets request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void bridge_assets(BridgeAssets request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the BridgeClaimAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> bridge_claim_asset(BridgeClaimAsset request) = 0;
 
+    /// \brief Sends the BridgeClaimAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void bridge_claim_asset(BridgeClaimAsset request,
+                                    graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the CompleteTrade request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> complete_trade(CompleteTrade request) = 0;
 
+    /// \brief Sends the CompleteTrade request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void complete_trade(CompleteTrade request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the CreateAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> create_asset(CreateAsset request) = 0;
 
+    /// \brief Sends the CreateAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void create_asset(CreateAsset request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the CreatePlayer request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::AccessToken>> create_player(CreatePlayer request) = 0;
 
+    /// \brief Sends the CreatePlayer request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void create_player(CreatePlayer request, graphql::GraphqlCallback<models::AccessToken> callback) = 0;
+
     /// \brief Sends the CreateTrade request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> create_trade(CreateTrade request) = 0;
 
+    /// \brief Sends the CreateTrade request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void create_trade(CreateTrade request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the DecreaseMaxMeltFee request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>>
     decrease_max_melt_fee(DecreaseMaxMeltFee request) = 0;
 
+    /// \brief Sends the DecreaseMaxMeltFee request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void decrease_max_melt_fee(DecreaseMaxMeltFee request,
+                                       graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the DecreaseMaxTransferFee request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>>
     decrease_max_transfer_fee(DecreaseMaxTransferFee request) = 0;
 
+    /// \brief Sends the DecreaseMaxTransferFee request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void decrease_max_transfer_fee(DecreaseMaxTransferFee request,
+                                           graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the DeletePlayer request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<bool>> delete_player(DeletePlayer request) = 0;
 
+    /// \brief Sends the DeletePlayer request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void delete_player(DeletePlayer request, graphql::GraphqlCallback<bool> callback) = 0;
+
     /// \brief Sends the GetPlayer request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Player>> get_player(GetPlayer request) = 0;
 
+    /// \brief Sends the GetPlayer request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_player(GetPlayer request, graphql::GraphqlCallback<models::Player> callback) = 0;
+
     /// \brief Sends the GetPlayers request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<std::vector<models::Player>>> get_players(GetPlayers request) = 0;
 
+    /// \brief Sends the GetPlayers request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_players(GetPlayers request, graphql::GraphqlCallback<std::vector<models::Player>> callback) = 0;
+
     /// \brief Sends the GetWallet request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Wallet>> get_wallet(GetWallet request) = 0;
 
+    /// \brief Sends the GetWallet request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_wallet(GetWallet request, graphql::GraphqlCallback<models::Wallet> callback) = 0;
+
     /// \brief Sends the GetWallets request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<std::vector<models::Wallet>>> get_wallets(GetWallets request) = 0;
 
+    /// \brief Sends the GetWallets request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_wallets(GetWallets request, graphql::GraphqlCallback<std::vector<models::Wallet>> callback) = 0;
+
+    /// \brief Sends the GetWallets request to the platform, decoding the wallets into a result table.
+    /// \param request The request.
+    /// \return The future containing the response.
+    virtual std::future<graphql::GraphqlResponse<models::WalletTable>> get_wallets_table(GetWallets request) = 0;
+
+    /// \brief Sends the GetWallets request to the platform, decoding the wallets into a result table, and passes the
+    /// response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_wallets_table(GetWallets request, graphql::GraphqlCallback<models::WalletTable> callback) = 0;
+
     /// \brief Sends the InvalidateAssetMetadata request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<bool>> invalidate_asset_metadata(InvalidateAssetMetadata request) = 0;
 
+    /// \brief Sends the InvalidateAssetMetadata request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void invalidate_asset_metadata(InvalidateAssetMetadata request,
+                                           graphql::GraphqlCallback<bool> callback) = 0;
+
     /// \brief Sends the MeltAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> melt_asset(MeltAsset request) = 0;
 
+    /// \brief Sends the MeltAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void melt_asset(MeltAsset request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the Message request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> message(Message request) = 0;
 
+    /// \brief Sends the Message request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void message(Message request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the MintAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> mint_asset(MintAsset request) = 0;
 
+    /// \brief Sends the MintAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void mint_asset(MintAsset request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the ReleaseReserve request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> release_reserve(ReleaseReserve request) = 0;
 
+    /// \brief Sends the ReleaseReserve request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void release_reserve(ReleaseReserve request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the ResetEnjApproval request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> reset_enj_approval(ResetEnjApproval request) = 0;
 
+    /// \brief Sends the ResetEnjApproval request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void reset_enj_approval(ResetEnjApproval request,
+                                    graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SendAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> send_asset(SendAsset request) = 0;
 
+    /// \brief Sends the SendAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void send_asset(SendAsset request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SendEnj request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> send_enj(SendEnj request) = 0;
 
+    /// \brief Sends the SendEnj request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void send_enj(SendEnj request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SetApprovalForAll request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> set_approval_for_all(SetApprovalForAll request) = 0;
 
+    /// \brief Sends the SetApprovalForAll request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void set_approval_for_all(SetApprovalForAll request,
+                                      graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SetMeltFee request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> set_melt_fee(SetMeltFee request) = 0;
 
+    /// \brief Sends the SetMeltFee request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void set_melt_fee(SetMeltFee request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SetTransferFee request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> set_transfer_fee(SetTransferFee request) = 0;
 
+    /// \brief Sends the SetTransferFee request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void set_transfer_fee(SetTransferFee request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SetTransferable request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> set_transferable(SetTransferable request) = 0;
 
+    /// \brief Sends the SetTransferable request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void set_transferable(SetTransferable request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SetUri request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> set_uri(SetUri request) = 0;
 
+    /// \brief Sends the SetUri request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void set_uri(SetUri request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the SetWhitelisted request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> set_whitelisted(SetWhitelisted request) = 0;
 
+    /// \brief Sends the SetWhitelisted request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void set_whitelisted(SetWhitelisted request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the UnlinkWallet request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<bool>> unlink_wallet(UnlinkWallet request) = 0;
+
+    /// \brief Sends the UnlinkWallet request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void unlink_wallet(UnlinkWallet request, graphql::GraphqlCallback<bool> callback) = 0;
 };
 
 }
@@ -37,6 +37,8 @@ public:
 
     [[nodiscard]] std::string serialize() const override;
 
+    void serialize(json::JsonWriter& writer) const override;
+
     /// \brief Sets the asset ID.
     /// \param asset_id The ID.
     /// \return This request for chaining.
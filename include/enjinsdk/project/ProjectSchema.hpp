@@ -36,79 +36,157 @@ public:
 
     std::future<graphql::GraphqlResponse<models::Transaction>> advanced_send_asset(AdvancedSendAsset request) override;
 
+    void advanced_send_asset(AdvancedSendAsset request,
+                             graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> approve_enj(ApproveEnj request) override;
 
+    void approve_enj(ApproveEnj request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> approve_enj_max(ApproveMaxEnj request) override;
 
+    void approve_enj_max(ApproveMaxEnj request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::AccessToken>> auth_player(AuthPlayer request) override;
 
+    void auth_player(AuthPlayer request, graphql::GraphqlCallback<models::AccessToken> callback) override;
+
     std::future<graphql::GraphqlResponse<models::AccessToken>> auth_project(AuthProject request) override;
 
+    void auth_project(AuthProject request, graphql::GraphqlCallback<models::AccessToken> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> bridge_asset(BridgeAsset request) override;
 
+    void bridge_asset(BridgeAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> bridge_assets(BridgeAssets request) override;
 
+    void bridge_assets(BridgeAssets request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> bridge_claim_asset(BridgeClaimAsset request) override;
 
+    void bridge_claim_asset(BridgeClaimAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> complete_trade(CompleteTrade request) override;
 
+    void complete_trade(CompleteTrade request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> create_asset(CreateAsset request) override;
 
+    void create_asset(CreateAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::AccessToken>> create_player(CreatePlayer request) override;
 
+    void create_player(CreatePlayer request, graphql::GraphqlCallback<models::AccessToken> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> create_trade(CreateTrade request) override;
 
+    void create_trade(CreateTrade request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> decrease_max_melt_fee(DecreaseMaxMeltFee request) override;
 
+    void decrease_max_melt_fee(DecreaseMaxMeltFee request,
+                               graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>>
     decrease_max_transfer_fee(DecreaseMaxTransferFee request) override;
 
+    void decrease_max_transfer_fee(DecreaseMaxTransferFee request,
+                                   graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<bool>> delete_player(DeletePlayer request) override;
 
+    void delete_player(DeletePlayer request, graphql::GraphqlCallback<bool> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Player>> get_player(GetPlayer request) override;
 
+    void get_player(GetPlayer request, graphql::GraphqlCallback<models::Player> callback) override;
+
     std::future<graphql::GraphqlResponse<std::vector<models::Player>>> get_players(GetPlayers request) override;
 
+    void get_players(GetPlayers request, graphql::GraphqlCallback<std::vector<models::Player>> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Wallet>> get_wallet(GetWallet request) override;
 
+    void get_wallet(GetWallet request, graphql::GraphqlCallback<models::Wallet> callback) override;
+
     std::future<graphql::GraphqlResponse<std::vector<models::Wallet>>> get_wallets(GetWallets request) override;
 
+    void get_wallets(GetWallets request, graphql::GraphqlCallback<std::vector<models::Wallet>> callback) override;
+
+    std::future<graphql::GraphqlResponse<models::WalletTable>> get_wallets_table(GetWallets request) override;
+
+    void get_wallets_table(GetWallets request, graphql::GraphqlCallback<models::WalletTable> callback) override;
+
     std::future<graphql::GraphqlResponse<bool>> invalidate_asset_metadata(InvalidateAssetMetadata request) override;
 
+    void invalidate_asset_metadata(InvalidateAssetMetadata request, graphql::GraphqlCallback<bool> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> melt_asset(MeltAsset request) override;
 
+    void melt_asset(MeltAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> message(Message request) override;
 
+    void message(Message request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> mint_asset(MintAsset request) override;
 
+    void mint_asset(MintAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> release_reserve(ReleaseReserve request) override;
 
+    void release_reserve(ReleaseReserve request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> reset_enj_approval(ResetEnjApproval request) override;
 
+    void reset_enj_approval(ResetEnjApproval request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> send_asset(SendAsset request) override;
 
+    void send_asset(SendAsset request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> send_enj(SendEnj request) override;
 
+    void send_enj(SendEnj request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> set_approval_for_all(SetApprovalForAll request) override;
 
+    void set_approval_for_all(SetApprovalForAll request,
+                              graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> set_melt_fee(SetMeltFee request) override;
 
+    void set_melt_fee(SetMeltFee request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> set_transfer_fee(SetTransferFee request) override;
 
+    void set_transfer_fee(SetTransferFee request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> set_transferable(SetTransferable request) override;
 
+    void set_transferable(SetTransferable request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> set_uri(SetUri request) override;
 
+    void set_uri(SetUri request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> set_whitelisted(SetWhitelisted request) override;
 
+    void set_whitelisted(SetWhitelisted request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<bool>> unlink_wallet(UnlinkWallet request) override;
 
+    void unlink_wallet(UnlinkWallet request, graphql::GraphqlCallback<bool> callback) override;
+
 protected:
     /// \brief Constructs an instance of this class.
     /// \param http_client The HTTP client.
     /// \param logger_provider The logger provider.
+    /// \param executor The executor.
     ProjectSchema(std::unique_ptr<http::IHttpClient> http_client,
-                  std::shared_ptr<utils::LoggerProvider> logger_provider);
+                  std::shared_ptr<utils::LoggerProvider> logger_provider,
+                  std::shared_ptr<utils::IExecutor> executor = nullptr);
 };
 
 }
@@ -19,6 +19,7 @@
 #include "enjinsdk_export.h"
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include "enjinsdk/shared/TransactionFragmentArguments.hpp"
 #include <optional>
 #include <string>
@@ -71,6 +72,13 @@ protected:
                       "Class T does not inherit from TransactionRequestArguments.");
     }
 
+    /// \brief Writes the fields of these arguments to the writer.
+    /// \param writer The writer, which must be writing an object.
+    void serialize_fields(json::JsonWriter& writer) const {
+        shared::TransactionFragmentArguments<T>::serialize_fields(writer);
+        utils::JsonUtils::try_write_field(writer, "ethAddress", eth_address_opt);
+    }
+
 private:
     std::optional<std::string> eth_address_opt;
 };
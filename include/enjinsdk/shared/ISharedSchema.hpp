@@ -17,12 +17,15 @@
 #define ENJINCPPSDK_ISHAREDSCHEMA_HPP
 
 #include "enjinsdk_export.h"
+#include "enjinsdk/GraphqlCallback.hpp"
 #include "enjinsdk/GraphqlResponse.hpp"
 #include "enjinsdk/models/Balance.hpp"
+#include "enjinsdk/models/BalanceTable.hpp"
 #include "enjinsdk/models/GasPrices.hpp"
 #include "enjinsdk/models/Platform.hpp"
 #include "enjinsdk/models/Project.hpp"
 #include "enjinsdk/models/Transaction.hpp"
+#include "enjinsdk/models/TransactionTable.hpp"
 #include "enjinsdk/models/Asset.hpp"
 #include "enjinsdk/shared/CancelTransaction.hpp"
 #include "enjinsdk/shared/GetBalances.hpp"
@@ -49,45 +52,115 @@ public:
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<bool>> cancel_transaction(CancelTransaction request) = 0;
 
+    /// \brief Sends the CancelTransaction request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void cancel_transaction(CancelTransaction request, graphql::GraphqlCallback<bool> callback) = 0;
+
     /// \brief Sends the GetBalances request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<std::vector<models::Balance>>> get_balances(GetBalances request) = 0;
 
+    /// \brief Sends the GetBalances request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_balances(GetBalances request, graphql::GraphqlCallback<std::vector<models::Balance>> callback) = 0;
+
+    /// \brief Sends the GetBalances request to the platform, decoding the balances into a result table.
+    /// \param request The request.
+    /// \return The future containing the response.
+    virtual std::future<graphql::GraphqlResponse<models::BalanceTable>> get_balances_table(GetBalances request) = 0;
+
+    /// \brief Sends the GetBalances request to the platform, decoding the balances into a result table, and passes the
+    /// response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_balances_table(GetBalances request, graphql::GraphqlCallback<models::BalanceTable> callback) = 0;
+
     /// \brief Sends the GetGasPrices request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::GasPrices>> get_gas_prices(GetGasPrices request) = 0;
 
+    /// \brief Sends the GetGasPrices request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_gas_prices(GetGasPrices request, graphql::GraphqlCallback<models::GasPrices> callback) = 0;
+
     /// \brief Sends the GetPlatform request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Platform>> get_platform(GetPlatform request) = 0;
 
+    /// \brief Sends the GetPlatform request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_platform(GetPlatform request, graphql::GraphqlCallback<models::Platform> callback) = 0;
+
     /// \brief Sends the GetProject request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Project>> get_project(GetProject request) = 0;
 
+    /// \brief Sends the GetProject request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_project(GetProject request, graphql::GraphqlCallback<models::Project> callback) = 0;
+
     /// \brief Sends the GetRequest request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Transaction>> get_request(GetTransaction request) = 0;
 
+    /// \brief Sends the GetRequest request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_request(GetTransaction request, graphql::GraphqlCallback<models::Transaction> callback) = 0;
+
     /// \brief Sends the GetRequests request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<std::vector<models::Transaction>>> get_requests(GetTransactions request) = 0;
 
+    /// \brief Sends the GetRequests request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_requests(GetTransactions request,
+                              graphql::GraphqlCallback<std::vector<models::Transaction>> callback) = 0;
+
+    /// \brief Sends the GetRequests request to the platform, decoding the transactions into a result table.
+    /// \param request The request.
+    /// \return The future containing the response.
+    virtual std::future<graphql::GraphqlResponse<models::TransactionTable>>
+    get_requests_table(GetTransactions request) = 0;
+
+    /// \brief Sends the GetRequests request to the platform, decoding the transactions into a result table, and
+    /// passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_requests_table(GetTransactions request,
+                                    graphql::GraphqlCallback<models::TransactionTable> callback) = 0;
+
     /// \brief Sends the GetAsset request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<models::Asset>> get_asset(GetAsset request) = 0;
 
+    /// \brief Sends the GetAsset request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_asset(GetAsset request, graphql::GraphqlCallback<models::Asset> callback) = 0;
+
     /// \brief Sends the GetAssets request to the platform.
     /// \param request The request.
     /// \return The future containing the response.
     virtual std::future<graphql::GraphqlResponse<std::vector<models::Asset>>> get_assets(GetAssets request) = 0;
+
+    /// \brief Sends the GetAssets request to the platform and passes the response to the callback.
+    /// \param request The request.
+    /// \param callback The callback, which is run on the executor once the request completes.
+    virtual void get_assets(GetAssets request, graphql::GraphqlCallback<std::vector<models::Asset>> callback) = 0;
 };
 
 }
@@ -37,30 +37,61 @@ public:
 
     std::future<graphql::GraphqlResponse<bool>> cancel_transaction(CancelTransaction request) override;
 
+    void cancel_transaction(CancelTransaction request, graphql::GraphqlCallback<bool> callback) override;
+
     std::future<graphql::GraphqlResponse<std::vector<models::Balance>>> get_balances(GetBalances request) override;
 
+    void get_balances(GetBalances request, graphql::GraphqlCallback<std::vector<models::Balance>> callback) override;
+
+    std::future<graphql::GraphqlResponse<models::BalanceTable>> get_balances_table(GetBalances request) override;
+
+    void get_balances_table(GetBalances request, graphql::GraphqlCallback<models::BalanceTable> callback) override;
+
     std::future<graphql::GraphqlResponse<models::GasPrices>> get_gas_prices(GetGasPrices request) override;
 
+    void get_gas_prices(GetGasPrices request, graphql::GraphqlCallback<models::GasPrices> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Platform>> get_platform(GetPlatform request) override;
 
+    void get_platform(GetPlatform request, graphql::GraphqlCallback<models::Platform> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Project>> get_project(GetProject request) override;
 
+    void get_project(GetProject request, graphql::GraphqlCallback<models::Project> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Transaction>> get_request(GetTransaction request) override;
 
+    void get_request(GetTransaction request, graphql::GraphqlCallback<models::Transaction> callback) override;
+
     std::future<graphql::GraphqlResponse<std::vector<models::Transaction>>> get_requests(GetTransactions request) override;
 
+    void get_requests(GetTransactions request,
+                      graphql::GraphqlCallback<std::vector<models::Transaction>> callback) override;
+
+    std::future<graphql::GraphqlResponse<models::TransactionTable>>
+    get_requests_table(GetTransactions request) override;
+
+    void get_requests_table(GetTransactions request,
+                            graphql::GraphqlCallback<models::TransactionTable> callback) override;
+
     std::future<graphql::GraphqlResponse<models::Asset>> get_asset(GetAsset request) override;
 
+    void get_asset(GetAsset request, graphql::GraphqlCallback<models::Asset> callback) override;
+
     std::future<graphql::GraphqlResponse<std::vector<models::Asset>>> get_assets(GetAssets request) override;
 
+    void get_assets(GetAssets request, graphql::GraphqlCallback<std::vector<models::Asset>> callback) override;
+
 protected:
     /// \brief Constructs an instance of this class.
     /// \param http_client The HTTP client.
     /// \param schema The schema name.
     /// \param logger_provider The logger provider.
+    /// \param executor The executor.
     SharedSchema(std::unique_ptr<http::IHttpClient> http_client,
                  std::string schema,
-                 std::shared_ptr<utils::LoggerProvider> logger_provider);
+                 std::shared_ptr<utils::LoggerProvider> logger_provider,
+                 std::shared_ptr<utils::IExecutor> executor = nullptr);
 };
 
 }
@@ -20,6 +20,7 @@
 #include "enjinsdk/ISerializable.hpp"
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -187,6 +188,25 @@ protected:
                       "Class T does not inherit from TransactionFragmentArguments.");
     }
 
+    /// \brief Writes the fields of these arguments to the writer.
+    /// \param writer The writer, which must be writing an object.
+    void serialize_fields(json::JsonWriter& writer) const {
+        utils::JsonUtils::try_write_field(writer, "transactionAssetIdFormat", transaction_asset_id_format_opt);
+        utils::JsonUtils::try_write_field(writer, "withBlockchainData", with_blockchain_data_opt);
+        utils::JsonUtils::try_write_field(writer, "withMeta", with_meta_opt);
+        utils::JsonUtils::try_write_field(writer, "withEncodedData", with_encoded_data_opt);
+        utils::JsonUtils::try_write_field(writer, "withAssetData", with_asset_data_opt);
+        utils::JsonUtils::try_write_field(writer, "withSignedTxs", with_signed_txs_opt);
+        utils::JsonUtils::try_write_field(writer, "withError", with_error_opt);
+        utils::JsonUtils::try_write_field(writer, "withNonce", with_nonce_opt);
+        utils::JsonUtils::try_write_field(writer, "withState", with_state_opt);
+        utils::JsonUtils::try_write_field(writer, "withReceipt", with_receipt_opt);
+        utils::JsonUtils::try_write_field(writer, "withReceiptLogs", with_receipt_logs_opt);
+        utils::JsonUtils::try_write_field(writer, "withLogEvent", with_log_event_opt);
+        utils::JsonUtils::try_write_field(writer, "withTransactionProjectUuid", with_transaction_project_uuid_opt);
+        utils::JsonUtils::try_write_field(writer, "withTransactionWalletAddress", with_transaction_wallet_address_opt);
+    }
+
 private:
     std::optional<models::AssetIdFormat> transaction_asset_id_format_opt;
     std::optional<bool> with_blockchain_data_opt;
@@ -30,8 +30,9 @@
 namespace enjin::sdk {
 
 PlayerClient::PlayerClient(std::unique_ptr<http::IHttpClient> http_client,
-                           std::shared_ptr<utils::LoggerProvider> logger_provider)
-        : PlayerSchema(std::move(http_client), std::move(logger_provider)) {
+                           std::shared_ptr<utils::LoggerProvider> logger_provider,
+                           std::shared_ptr<utils::IExecutor> executor)
+        : PlayerSchema(std::move(http_client), std::move(logger_provider), std::move(executor)) {
 }
 
 PlayerClient::~PlayerClient() {
@@ -46,6 +47,14 @@ void PlayerClient::close() {
     middleware->close();
 }
 
+std::optional<http::CompressionStats> PlayerClient::get_http_compression_stats() const {
+    return middleware->get_client()->get_compression_stats();
+}
+
+std::optional<http::ConnectionPoolStats> PlayerClient::get_http_connection_pool_stats() const {
+    return middleware->get_client()->get_connection_pool_stats();
+}
+
 bool PlayerClient::is_authenticated() const {
     return middleware->is_authenticated();
 }
@@ -59,27 +68,44 @@ PlayerClient::PlayerClientBuilder PlayerClient::builder() {
 }
 
 std::unique_ptr<PlayerClient> PlayerClient::PlayerClientBuilder::build() {
-    if (m_http_client == nullptr) {
+    std::unique_ptr<http::IHttpClient> http_client = std::move(m_http_client);
+    if (http_client == nullptr) {
 #if ENJINSDK_INCLUDE_HTTP_CLIENT_IMPL
         if (!m_base_uri.has_value()) {
             throw std::runtime_error("No base URI was set for default HTTP client implementation");
         }
 
-        auto client = std::make_unique<http::HttpClient>(m_base_uri.value());
+        auto client = std::make_unique<http::HttpClient>(
+                m_base_uri.value(),
+                m_http_max_connections.value_or(http::HttpClient::DefaultMaxConnections),
+                m_http_idle_timeout.value_or(http::HttpClient::DefaultIdleTimeout));
+        client->set_executor(m_executor);
+        if (m_http_compression_threshold.has_value()) {
+            client->set_request_compression(true, m_http_compression_threshold.value());
+        }
+        if (m_http_prewarmed_connections.has_value()) {
+            client->set_prewarmed_connections(m_http_prewarmed_connections.value());
+        }
         auto log_level = m_http_log_level.value_or(http::HttpLogLevel::None);
         if (log_level != http::HttpLogLevel::None && m_logger_provider != nullptr) {
             client->set_logger(log_level, m_logger_provider);
         }
 
-        return std::unique_ptr<PlayerClient>(new PlayerClient(std::move(client),
-                                                              m_logger_provider));
+        http_client = std::move(client);
 #else
         throw std::runtime_error("Attempted building platform client without providing an HTTP client");
 #endif
-    } else {
-        return std::unique_ptr<PlayerClient>(new PlayerClient(std::move(m_http_client),
-                                                              m_logger_provider));
     }
+
+    auto player_client = std::unique_ptr<PlayerClient>(new PlayerClient(std::move(http_client),
+                                                                        m_logger_provider,
+                                                                        m_executor));
+    player_client->set_request_coalescing(m_request_coalescing.value_or(false));
+    if (m_request_batch_size.has_value()) {
+        player_client->set_request_batching(m_request_batch_size.value(), m_request_batch_delay);
+    }
+
+    return player_client;
 }
 
 PlayerClient::PlayerClientBuilder& PlayerClient::PlayerClientBuilder::base_uri(std::string base_uri) {
@@ -87,22 +113,64 @@ PlayerClient::PlayerClientBuilder& PlayerClient::PlayerClientBuilder::base_uri(s
     return *this;
 }
 
+PlayerClient::PlayerClientBuilder& PlayerClient::PlayerClientBuilder::enable_request_coalescing() {
+    m_request_coalescing = true;
+    return *this;
+}
+
+PlayerClient::PlayerClientBuilder&
+PlayerClient::PlayerClientBuilder::executor(std::shared_ptr<utils::IExecutor> executor) {
+    m_executor = std::move(executor);
+    return *this;
+}
+
 PlayerClient::PlayerClientBuilder&
 PlayerClient::PlayerClientBuilder::http_client(std::unique_ptr<http::IHttpClient> http_client) {
     m_http_client = std::move(http_client);
     return *this;
 }
 
+PlayerClient::PlayerClientBuilder&
+PlayerClient::PlayerClientBuilder::http_compression_threshold(std::size_t threshold) {
+    m_http_compression_threshold = threshold;
+    return *this;
+}
+
+PlayerClient::PlayerClientBuilder&
+PlayerClient::PlayerClientBuilder::http_idle_timeout(std::chrono::milliseconds http_idle_timeout) {
+    m_http_idle_timeout = http_idle_timeout;
+    return *this;
+}
+
 PlayerClient::PlayerClientBuilder&
 PlayerClient::PlayerClientBuilder::http_log_level(http::HttpLogLevel http_log_level) {
     m_http_log_level = http_log_level;
     return *this;
 }
 
+PlayerClient::PlayerClientBuilder&
+PlayerClient::PlayerClientBuilder::http_max_connections(std::size_t http_max_connections) {
+    m_http_max_connections = http_max_connections;
+    return *this;
+}
+
+PlayerClient::PlayerClientBuilder&
+PlayerClient::PlayerClientBuilder::http_prewarmed_connections(std::size_t http_prewarmed_connections) {
+    m_http_prewarmed_connections = http_prewarmed_connections;
+    return *this;
+}
+
 PlayerClient::PlayerClientBuilder&
 PlayerClient::PlayerClientBuilder::logger_provider(std::shared_ptr<utils::LoggerProvider> logger_provider) {
     m_logger_provider = std::move(logger_provider);
     return *this;
 }
 
+PlayerClient::PlayerClientBuilder&
+PlayerClient::PlayerClientBuilder::request_batching(std::size_t max_batch_size, std::chrono::milliseconds max_delay) {
+    m_request_batch_size = max_batch_size;
+    m_request_batch_delay = max_delay;
+    return *this;
+}
+
 }
@@ -33,8 +33,9 @@ namespace enjin::sdk {
 ProjectClient::ProjectClient(std::unique_ptr<http::IHttpClient> http_client,
                              bool automatic_reauthentication,
                              std::shared_ptr<utils::LoggerProvider> logger_provider,
-                             std::optional<std::function<void()>> reauthentication_stopped_handler)
-        : ProjectSchema(std::move(http_client), std::move(logger_provider)),
+                             std::optional<std::function<void()>> reauthentication_stopped_handler,
+                             std::shared_ptr<utils::IExecutor> executor)
+        : ProjectSchema(std::move(http_client), std::move(logger_provider), std::move(executor)),
           automatic_reauthentication_enabled(automatic_reauthentication),
           reauthentication_stopped_handler(std::move(reauthentication_stopped_handler)) {
     if (automatic_reauthentication) {
@@ -86,6 +87,14 @@ void ProjectClient::close() {
     middleware->close();
 }
 
+std::optional<http::CompressionStats> ProjectClient::get_http_compression_stats() const {
+    return middleware->get_client()->get_compression_stats();
+}
+
+std::optional<http::ConnectionPoolStats> ProjectClient::get_http_connection_pool_stats() const {
+    return middleware->get_client()->get_connection_pool_stats();
+}
+
 bool ProjectClient::is_authenticated() const {
     return middleware->is_authenticated();
 }
@@ -179,31 +188,47 @@ void ProjectClient::send_request_and_auth() {
 }
 
 std::unique_ptr<ProjectClient> ProjectClient::ProjectClientBuilder::build() {
-    if (m_http_client == nullptr) {
+    std::unique_ptr<http::IHttpClient> http_client = std::move(m_http_client);
+    if (http_client == nullptr) {
 #if ENJINSDK_INCLUDE_HTTP_CLIENT_IMPL
         if (!m_base_uri.has_value()) {
             throw std::runtime_error("No base URI was set for default HTTP client implementation");
         }
 
-        auto client = std::make_unique<http::HttpClient>(m_base_uri.value());
+        auto client = std::make_unique<http::HttpClient>(
+                m_base_uri.value(),
+                m_http_max_connections.value_or(http::HttpClient::DefaultMaxConnections),
+                m_http_idle_timeout.value_or(http::HttpClient::DefaultIdleTimeout));
+        client->set_executor(m_executor);
+        if (m_http_compression_threshold.has_value()) {
+            client->set_request_compression(true, m_http_compression_threshold.value());
+        }
+        if (m_http_prewarmed_connections.has_value()) {
+            client->set_prewarmed_connections(m_http_prewarmed_connections.value());
+        }
         auto log_level = m_http_log_level.value_or(http::HttpLogLevel::None);
         if (log_level != http::HttpLogLevel::None && m_logger_provider != nullptr) {
             client->set_logger(log_level, m_logger_provider);
         }
 
-        return std::unique_ptr<ProjectClient>(new ProjectClient(std::move(client),
-                                                                m_automatic_reauthentication.value_or(false),
-                                                                m_logger_provider,
-                                                                std::move(m_reauthentication_stopped_handler)));
+        http_client = std::move(client);
 #else
         throw std::runtime_error("Attempted building platform client without providing an HTTP client");
 #endif
-    } else {
-        return std::unique_ptr<ProjectClient>(new ProjectClient(std::move(m_http_client),
-                                                                m_automatic_reauthentication.value_or(false),
-                                                                m_logger_provider,
-                                                                std::move(m_reauthentication_stopped_handler)));
     }
+
+    auto project_client = std::unique_ptr<ProjectClient>(
+            new ProjectClient(std::move(http_client),
+                              m_automatic_reauthentication.value_or(false),
+                              m_logger_provider,
+                              std::move(m_reauthentication_stopped_handler),
+                              m_executor));
+    project_client->set_request_coalescing(m_request_coalescing.value_or(false));
+    if (m_request_batch_size.has_value()) {
+        project_client->set_request_batching(m_request_batch_size.value(), m_request_batch_delay);
+    }
+
+    return project_client;
 }
 
 ProjectClient::ProjectClientBuilder& ProjectClient::ProjectClientBuilder::base_uri(std::string base_uri) {
@@ -216,18 +241,53 @@ ProjectClient::ProjectClientBuilder& ProjectClient::ProjectClientBuilder::enable
     return *this;
 }
 
+ProjectClient::ProjectClientBuilder& ProjectClient::ProjectClientBuilder::enable_request_coalescing() {
+    m_request_coalescing = true;
+    return *this;
+}
+
+ProjectClient::ProjectClientBuilder&
+ProjectClient::ProjectClientBuilder::executor(std::shared_ptr<utils::IExecutor> executor) {
+    m_executor = std::move(executor);
+    return *this;
+}
+
 ProjectClient::ProjectClientBuilder&
 ProjectClient::ProjectClientBuilder::http_client(std::unique_ptr<http::IHttpClient> http_client) {
     m_http_client = std::move(http_client);
     return *this;
 }
 
+ProjectClient::ProjectClientBuilder&
+ProjectClient::ProjectClientBuilder::http_compression_threshold(std::size_t threshold) {
+    m_http_compression_threshold = threshold;
+    return *this;
+}
+
+ProjectClient::ProjectClientBuilder&
+ProjectClient::ProjectClientBuilder::http_idle_timeout(std::chrono::milliseconds http_idle_timeout) {
+    m_http_idle_timeout = http_idle_timeout;
+    return *this;
+}
+
 ProjectClient::ProjectClientBuilder&
 ProjectClient::ProjectClientBuilder::http_log_level(http::HttpLogLevel http_log_level) {
     m_http_log_level = http_log_level;
     return *this;
 }
 
+ProjectClient::ProjectClientBuilder&
+ProjectClient::ProjectClientBuilder::http_max_connections(std::size_t http_max_connections) {
+    m_http_max_connections = http_max_connections;
+    return *this;
+}
+
+ProjectClient::ProjectClientBuilder&
+ProjectClient::ProjectClientBuilder::http_prewarmed_connections(std::size_t http_prewarmed_connections) {
+    m_http_prewarmed_connections = http_prewarmed_connections;
+    return *this;
+}
+
 ProjectClient::ProjectClientBuilder&
 ProjectClient::ProjectClientBuilder::logger_provider(std::shared_ptr<utils::LoggerProvider> logger_provider) {
     m_logger_provider = std::move(logger_provider);
@@ -240,4 +300,11 @@ ProjectClient::ProjectClientBuilder::reauthentication_stopped_handler(std::funct
     return *this;
 }
 
+ProjectClient::ProjectClientBuilder&
+ProjectClient::ProjectClientBuilder::request_batching(std::size_t max_batch_size, std::chrono::milliseconds max_delay) {
+    m_request_batch_size = max_batch_size;
+    m_request_batch_delay = max_delay;
+    return *this;
+}
+
 }
@@ -16,10 +16,27 @@
 #include "enjinsdk/internal/AbstractGraphqlResponse.hpp"
 
 #include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonView.hpp"
+
+#include "JsonParser.hpp"
+#include "JsonSource.hpp"
+#include "ListResultReader.hpp"
+#include "rapidjson/document.h"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
 
 using namespace enjin::sdk::graphql;
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::utils;
+using namespace rapidjson;
+
+namespace {
+
+/// Smallest first chunk of a response arena, so that tiny responses do not need a second chunk for their values.
+constexpr std::size_t MinArenaChunkCapacity = 1024;
+
+}
 
 const std::optional<std::vector<GraphqlError>>& AbstractGraphqlResponse::get_errors() const {
     return errors;
@@ -34,17 +51,90 @@ bool AbstractGraphqlResponse::is_successful() const noexcept {
 }
 
 void AbstractGraphqlResponse::process(const std::string& json) {
-    JsonValue json_object;
+    process(std::string(json));
+}
+
+void AbstractGraphqlResponse::process(std::string&& json) {
+    // The values of an in situ document take about as many bytes as the text they were parsed from, so sizing the
+    // first chunk from the body lets most responses be parsed without the arena growing
+    std::string buffer(std::move(json));
+    MemoryPoolAllocator<> arena(std::max(buffer.size(), MinArenaChunkCapacity));
+    Document document(&arena);
 
-    if (!json_object.try_parse_as_object(json)) {
+    if (!parse_document_in_situ(document, buffer) || !document.IsObject()) {
         return;
     }
 
+    JsonView json_object(static_cast<const Value*>(&document));
+
     JsonUtils::try_get_field(json_object, "errors", errors);
 
-    JsonValue data_object;
+    JsonView data_object;
 
     if (json_object.try_get_object_field("data", data_object) && data_object.is_object()) {
         process_data(data_object);
     }
 }
+
+void AbstractGraphqlResponse::process_data(const JsonView&) {
+}
+
+AbstractGraphqlResponse::ListStreamResult AbstractGraphqlResponse::process_list(const std::string& json,
+                                                                                const ValueHandler& item_handler,
+                                                                                const ValueHandler& cursor_handler) {
+    return read_list(json, nullptr, item_handler, cursor_handler);
+}
+
+AbstractGraphqlResponse::ListStreamResult
+AbstractGraphqlResponse::process_list(const std::shared_ptr<const std::string>& json,
+                                      const ValueHandler& item_handler,
+                                      const ValueHandler& cursor_handler) {
+    return read_list(*json, json, item_handler, cursor_handler);
+}
+
+AbstractGraphqlResponse::ListStreamResult
+AbstractGraphqlResponse::read_list(const std::string& json,
+                                   const std::shared_ptr<const std::string>& shared_json,
+                                   const ValueHandler& item_handler,
+                                   const ValueHandler& cursor_handler) {
+    std::optional<std::vector<GraphqlError>> new_errors;
+
+    ListResultReader reader(
+            [&item_handler](const Value& item, const JsonSource* source) {
+                item_handler(JsonSource::create_view(item, source));
+            },
+            [&cursor_handler](const Value& cursor) {
+                cursor_handler(JsonView(static_cast<const Value*>(&cursor)));
+            },
+            [&new_errors](const Value& errors_value) {
+                JsonView errors_array(static_cast<const Value*>(&errors_value));
+
+                if (!errors_array.is_array()) {
+                    new_errors.reset();
+                    return;
+                }
+
+                std::vector<GraphqlError> list;
+                list.reserve(errors_array.size());
+
+                for (const JsonView& element: errors_array.get_array_elements()) {
+                    GraphqlError error;
+                    error.deserialize(element);
+                    list.push_back(std::move(error));
+                }
+
+                new_errors.emplace(std::move(list));
+            });
+
+    const bool is_valid = shared_json != nullptr
+                          ? reader.read(shared_json)
+                          : reader.read(json);
+
+    if (!is_valid) {
+        return {};
+    }
+
+    errors = std::move(new_errors);
+
+    return {reader.has_items(), reader.is_paginated()};
+}
@@ -0,0 +1,221 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GraphqlBatcher.hpp"
+
+#include "JsonParser.hpp"
+#include "RapidJsonUtils.hpp"
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::http;
+
+GraphqlBatcher::GraphqlBatcher(Sender sender,
+                               Dispatcher dispatcher,
+                               std::size_t max_batch_size,
+                               std::chrono::milliseconds max_delay)
+        : sender(std::move(sender)),
+          dispatcher(std::move(dispatcher)),
+          max_batch_size(std::max<std::size_t>(max_batch_size, 1)),
+          max_delay(max_delay) {
+    deadline_thread = std::thread([this]() {
+        run_deadlines();
+    });
+}
+
+GraphqlBatcher::~GraphqlBatcher() {
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        running = false;
+    }
+    cv.notify_all();
+
+    if (deadline_thread.joinable()) {
+        deadline_thread.join();
+    }
+
+    flush();
+}
+
+void GraphqlBatcher::enqueue(std::string request_body, Completion completion) {
+    std::vector<Entry> batch;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+
+        pending.push_back(Entry{std::move(request_body), std::move(completion)});
+        if (pending.size() >= max_batch_size) {
+            batch = take_pending();
+        } else if (pending.size() == 1) {
+            deadline = std::chrono::steady_clock::now() + max_delay;
+            cv.notify_all();
+        }
+    }
+
+    send_batch(std::move(batch));
+}
+
+void GraphqlBatcher::flush() {
+    std::vector<Entry> batch;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        batch = take_pending();
+    }
+
+    send_batch(std::move(batch));
+}
+
+void GraphqlBatcher::run_deadlines() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (running) {
+        if (pending.empty()) {
+            cv.wait(lock);
+        } else if (std::chrono::steady_clock::now() < deadline) {
+            cv.wait_until(lock, deadline);
+        } else {
+            auto batch = take_pending();
+
+            lock.unlock();
+            send_batch(std::move(batch));
+            lock.lock();
+        }
+    }
+}
+
+void GraphqlBatcher::send_batch(std::vector<Entry> batch) {
+    if (batch.empty()) {
+        return;
+    }
+
+    std::vector<std::string> request_bodies;
+    request_bodies.reserve(batch.size());
+    for (auto& entry: batch) {
+        request_bodies.push_back(std::move(entry.request_body));
+    }
+
+    auto entries = std::make_shared<std::vector<Entry>>(std::move(batch));
+    std::shared_future<HttpResponse> response;
+    try {
+        response = sender(entries->size() == 1
+                          ? std::move(request_bodies.front())
+                          : create_batch_body(request_bodies)).share();
+    } catch (...) {
+        complete(*entries, std::current_exception());
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        batch_count++;
+    }
+
+    dispatcher([entries, response]() {
+        std::vector<HttpResponse> responses;
+        try {
+            if (entries->size() == 1) {
+                responses.push_back(response.get());
+            } else {
+                responses = split_batch_response(response.get(), entries->size());
+            }
+        } catch (...) {
+            complete(*entries, std::current_exception());
+            return;
+        }
+
+        for (std::size_t i = 0; i < entries->size(); i++) {
+            std::promise<HttpResponse> promise;
+            promise.set_value(std::move(responses[i]));
+            entries->at(i).completion(promise.get_future().share());
+        }
+    });
+}
+
+std::vector<GraphqlBatcher::Entry> GraphqlBatcher::take_pending() {
+    std::vector<Entry> batch;
+    batch.swap(pending);
+
+    return batch;
+}
+
+void GraphqlBatcher::complete(const std::vector<Entry>& batch, const std::exception_ptr& exception) {
+    for (const auto& entry: batch) {
+        std::promise<HttpResponse> promise;
+        promise.set_exception(exception);
+        entry.completion(promise.get_future().share());
+    }
+}
+
+std::size_t GraphqlBatcher::get_batch_count() const {
+    std::lock_guard<std::mutex> guard(mutex);
+    return batch_count;
+}
+
+std::size_t GraphqlBatcher::get_max_batch_size() const {
+    return max_batch_size;
+}
+
+std::chrono::milliseconds GraphqlBatcher::get_max_delay() const {
+    return max_delay;
+}
+
+std::string GraphqlBatcher::create_batch_body(const std::vector<std::string>& request_bodies) {
+    std::string body("[");
+    for (std::size_t i = 0; i < request_bodies.size(); i++) {
+        if (i > 0) {
+            body.push_back(',');
+        }
+        body.append(request_bodies[i]);
+    }
+    body.push_back(']');
+
+    return body;
+}
+
+std::vector<HttpResponse> GraphqlBatcher::split_batch_response(const HttpResponse& response, std::size_t count) {
+    const auto& body = response.get_body();
+    rapidjson::Document document;
+    const bool is_parsed = body.has_value() && enjin::sdk::json::parse_document(document, body.value());
+
+    std::vector<HttpResponse> responses;
+    responses.reserve(count);
+
+    if (is_parsed && document.IsArray()) {
+        auto results = enjin::sdk::utils::get_array_as_serialized_vector(document);
+        if (results.size() != count) {
+            std::stringstream ss;
+            ss << "Batch response has " << results.size() << " results for " << count << " requests";
+            throw std::runtime_error(ss.str());
+        }
+
+        for (auto& result: results) {
+            auto builder = HttpResponse::builder();
+            if (response.get_code().has_value()) {
+                builder.code(response.get_code().value());
+            }
+
+            responses.push_back(builder.body(std::move(result)).build());
+        }
+    } else {
+        responses.assign(count, response);
+    }
+
+    return responses;
+}
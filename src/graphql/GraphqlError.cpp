@@ -17,8 +17,8 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
 #include <map>
-#include <set>
 
 using namespace enjin::sdk::graphql;
 using namespace enjin::sdk::json;
@@ -26,8 +26,13 @@ using namespace enjin::sdk::utils;
 
 void GraphqlError::deserialize(const std::string& json) {
     JsonValue json_object;
+    json_object.try_parse_as_object(json);
 
-    if (!json_object.try_parse_as_object(json)) {
+    deserialize(JsonView(json_object));
+}
+
+void GraphqlError::deserialize(const JsonView& json) {
+    if (!json.is_object()) {
         message.reset();
         code.reset();
         locations.reset();
@@ -36,30 +41,27 @@ void GraphqlError::deserialize(const std::string& json) {
         return;
     }
 
-    JsonUtils::try_get_field(json_object, "message", message);
-    JsonUtils::try_get_field(json_object, "code", code);
-    JsonUtils::try_get_field(json_object, "message", details);
+    JsonUtils::try_get_field(json, "message", message);
+    JsonUtils::try_get_field(json, "code", code);
+    JsonUtils::try_get_field(json, "message", details);
 
-    JsonValue locations_field;
-    std::vector<JsonValue> locations_value;
-    if (!json_object.try_get_object_field("locations", locations_field)
-        || !locations_field.try_get_array(locations_value)) {
+    JsonView locations_field;
+    if (!json.try_get_object_field("locations", locations_field) || !locations_field.is_array()) {
         locations.reset();
         return;
     }
 
     std::vector<std::map<std::string, int>> locations_array;
+    locations_array.reserve(locations_field.size());
 
-    for (const JsonValue& location_value: locations_value) {
+    for (const JsonView location_value: locations_field.get_array_elements()) {
         std::map<std::string, int> location;
-        std::set<std::string> keys = location_value.get_object_field_keys();
 
-        for (const std::string& key: keys) {
+        for (const JsonMember member: location_value.get_object_members()) {
             int value;
-            JsonValue value_value;
 
-            if (location_value.try_get_object_field(key, value_value) && value_value.try_get_number(value)) {
-                location.emplace(key, value);
+            if (member.value.try_get_number(value)) {
+                location.emplace(member.key, value);
             }
         }
 
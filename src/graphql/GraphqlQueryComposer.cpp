@@ -0,0 +1,292 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GraphqlQueryComposer.hpp"
+
+#include "JsonParser.hpp"
+#include "RapidJsonUtils.hpp"
+#include "enjinsdk_utils/StringUtils.hpp"
+#include <regex>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+namespace enjin::sdk::graphql {
+
+namespace {
+
+const std::regex FRAGMENT_DEFINITION_REGEX(R"(fragment\s+([_A-Za-z][_0-9A-Za-z]*)\s+on\b)");
+const std::regex ROOT_ALIAS_REGEX(R"(^\s*result\s*:)");
+const std::regex VARIABLE_REGEX(R"(\$([_A-Za-z][_0-9A-Za-z]*))");
+
+std::size_t find_closing(const std::string& text, std::size_t open_pos) {
+    int depth = 0;
+    bool in_string = false;
+
+    for (std::size_t i = open_pos; i < text.size(); i++) {
+        char c = text[i];
+        if (in_string) {
+            if (c == '\\') {
+                i++;
+            } else if (c == '"') {
+                in_string = false;
+            }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == '{' || c == '(' || c == '[') {
+            depth++;
+        } else if (c == '}' || c == ')' || c == ']') {
+            depth--;
+            if (depth == 0) {
+                return i;
+            }
+        }
+    }
+
+    throw std::runtime_error("GraphQL operation has unbalanced brackets");
+}
+
+std::vector<std::string> split_parameters(const std::string& parameters) {
+    std::vector<std::string> result;
+    std::size_t start = 0;
+    int depth = 0;
+
+    for (std::size_t i = 0; i <= parameters.size(); i++) {
+        char c = i < parameters.size() ? parameters[i] : ',';
+        if (c == '(' || c == '[' || c == '{') {
+            depth++;
+        } else if (c == ')' || c == ']' || c == '}') {
+            depth--;
+        } else if (c == ',' && depth == 0) {
+            auto parameter = enjin::utils::trim(parameters.substr(start, i - start));
+            if (!parameter.empty()) {
+                result.push_back(std::move(parameter));
+            }
+            start = i + 1;
+        }
+    }
+
+    return result;
+}
+
+// Renames the variables and fragments of an operation so they are unique to it within the composed document
+std::string rename(const std::string& text, const std::set<std::string>& fragment_names, const std::string& suffix) {
+    std::string renamed = std::regex_replace(text, VARIABLE_REGEX, "$$$1" + suffix);
+
+    for (const auto& name: fragment_names) {
+        std::regex fragment_regex(R"((\.\.\.\s*|fragment\s+))" + name + R"(\b)");
+        renamed = std::regex_replace(renamed, fragment_regex, "$1" + name + suffix);
+    }
+
+    return renamed;
+}
+
+}
+
+GraphqlQueryComposer::GraphqlQueryComposer(const GraphqlQueryRegistry& registry) : registry(registry) {
+}
+
+void GraphqlQueryComposer::add(const AbstractGraphqlRequest& request) {
+    const std::string& name = request.get_namespace();
+    if (!registry.has_operation_for_name(name)) {
+        throw std::runtime_error("No template is registered for " + name);
+    }
+
+    std::string text = enjin::utils::trim(registry.get_operation_for_name(name));
+    if (text.rfind("query", 0) != 0) {
+        throw std::runtime_error("Template for " + name + " is not a query and cannot be composed");
+    }
+
+    std::size_t selection_open = text.find('{');
+    if (selection_open == std::string::npos) {
+        throw std::runtime_error("Template for " + name + " has no selection set");
+    }
+    std::size_t selection_close = find_closing(text, selection_open);
+
+    std::string header = text.substr(0, selection_open);
+    std::string selection = text.substr(selection_open + 1, selection_close - selection_open - 1);
+    std::string fragments = enjin::utils::trim(text.substr(selection_close + 1));
+
+    if (!std::regex_search(selection, ROOT_ALIAS_REGEX)) {
+        throw std::runtime_error("Template for " + name + " does not alias its root field as \"result\"");
+    }
+
+    std::vector<std::string> parameters;
+    std::size_t parameters_open = header.find('(');
+    if (parameters_open != std::string::npos) {
+        std::size_t parameters_close = find_closing(header, parameters_open);
+        parameters = split_parameters(header.substr(parameters_open + 1, parameters_close - parameters_open - 1));
+    }
+
+    std::set<std::string> fragment_names;
+    for (auto iter = std::sregex_iterator(fragments.begin(), fragments.end(), FRAGMENT_DEFINITION_REGEX);
+         iter != std::sregex_iterator();
+         iter++) {
+        fragment_names.insert((*iter)[1].str());
+    }
+
+    std::string suffix = "_" + std::to_string(operations.size());
+    Operation operation;
+    std::set<std::string> variable_names;
+
+    for (const auto& parameter: parameters) {
+        std::smatch match;
+        if (std::regex_search(parameter, match, VARIABLE_REGEX)) {
+            variable_names.insert(match[1].str());
+        }
+        operation.parameters.push_back(rename(parameter, fragment_names, suffix));
+    }
+
+    operation.selection = std::regex_replace(enjin::utils::trim(rename(selection, fragment_names, suffix)),
+                                             ROOT_ALIAS_REGEX,
+                                             create_alias(operations.size()) + ":");
+    operation.fragments = rename(fragments, fragment_names, suffix);
+
+    // Keeps only the declared variables, as the server rejects variables the document does not define
+    rapidjson::Document source;
+    std::string serialized = request.serialize();
+    source.Parse(serialized.c_str(), serialized.size());
+
+    rapidjson::Document variables(rapidjson::kObjectType);
+    auto& allocator = variables.GetAllocator();
+    if (!source.HasParseError() && source.IsObject()) {
+        for (auto& member: source.GetObject()) {
+            std::string variable_name(member.name.GetString(), member.name.GetStringLength());
+            if (variable_names.find(variable_name) == variable_names.end()) {
+                continue;
+            }
+
+            variable_name.append(suffix);
+            variables.AddMember(rapidjson::Value(variable_name.c_str(),
+                                                 static_cast<rapidjson::SizeType>(variable_name.size()),
+                                                 allocator),
+                                rapidjson::Value(member.value, allocator),
+                                allocator);
+        }
+    }
+    operation.variables = utils::document_to_string(variables);
+
+    operations.push_back(std::move(operation));
+}
+
+std::size_t GraphqlQueryComposer::size() const {
+    return operations.size();
+}
+
+std::string GraphqlQueryComposer::create_request_body() const {
+    std::vector<std::string> parameters;
+    std::vector<std::string> selections;
+    std::vector<std::string> fragments;
+
+    rapidjson::Document document(rapidjson::kObjectType);
+    auto& allocator = document.GetAllocator();
+    rapidjson::Value variables(rapidjson::kObjectType);
+
+    for (const auto& operation: operations) {
+        parameters.insert(parameters.end(), operation.parameters.begin(), operation.parameters.end());
+        selections.push_back(operation.selection);
+        if (!operation.fragments.empty()) {
+            fragments.push_back(operation.fragments);
+        }
+
+        rapidjson::Document operation_variables;
+        operation_variables.Parse(operation.variables.c_str(), operation.variables.size());
+        for (auto& member: operation_variables.GetObject()) {
+            variables.AddMember(rapidjson::Value(member.name, allocator),
+                                rapidjson::Value(member.value, allocator),
+                                allocator);
+        }
+    }
+
+    std::string query("query");
+    if (!parameters.empty()) {
+        query.append("(").append(enjin::utils::join(", ", parameters)).append(")");
+    }
+    query.append(" {").append(enjin::utils::join(" ", selections)).append("}");
+    if (!fragments.empty()) {
+        query.append(" ").append(enjin::utils::join(" ", fragments));
+    }
+
+    document.AddMember("query",
+                       rapidjson::Value(query.c_str(), static_cast<rapidjson::SizeType>(query.size()), allocator),
+                       allocator);
+    document.AddMember("variables", variables, allocator);
+
+    return utils::document_to_string(document);
+}
+
+std::vector<std::string> GraphqlQueryComposer::split_response(const std::string& response_body) const {
+    rapidjson::Document document;
+    if (!json::parse_document(document, response_body) || !document.IsObject()) {
+        throw std::runtime_error("Response to composed query is not a JSON object");
+    }
+
+    const rapidjson::Value* data = document.HasMember("data") && document["data"].IsObject()
+                                   ? &document["data"]
+                                   : nullptr;
+    const rapidjson::Value* errors = document.HasMember("errors") && document["errors"].IsArray()
+                                     ? &document["errors"]
+                                     : nullptr;
+
+    std::vector<std::string> results;
+    results.reserve(operations.size());
+
+    for (std::size_t i = 0; i < operations.size(); i++) {
+        std::string alias = create_alias(i);
+        rapidjson::Document part(rapidjson::kObjectType);
+        auto& allocator = part.GetAllocator();
+
+        rapidjson::Value part_data(rapidjson::kObjectType);
+        if (data != nullptr && data->HasMember(alias.c_str())) {
+            part_data.AddMember("result", rapidjson::Value((*data)[alias.c_str()], allocator), allocator);
+        } else {
+            part_data.AddMember("result", rapidjson::Value(), allocator);
+        }
+        part.AddMember("data", part_data, allocator);
+
+        if (errors != nullptr) {
+            rapidjson::Value part_errors(rapidjson::kArrayType);
+            for (const auto& error: errors->GetArray()) {
+                bool has_path = error.IsObject()
+                                && error.HasMember("path")
+                                && error["path"].IsArray()
+                                && !error["path"].Empty();
+                if (has_path && !(error["path"][0].IsString() && alias == error["path"][0].GetString())) {
+                    continue;
+                }
+
+                rapidjson::Value part_error(error, allocator);
+                if (has_path) {
+                    part_error["path"][0].SetString("result");
+                }
+                part_errors.PushBack(part_error, allocator);
+            }
+
+            if (!part_errors.Empty()) {
+                part.AddMember("errors", part_errors, allocator);
+            }
+        }
+
+        results.push_back(utils::document_to_string(part));
+    }
+
+    return results;
+}
+
+std::string GraphqlQueryComposer::create_alias(std::size_t index) {
+    return "op" + std::to_string(index);
+}
+
+}
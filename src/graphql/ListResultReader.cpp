@@ -0,0 +1,337 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ListResultReader.hpp"
+
+#include "JsonParseLimiter.hpp"
+#include <string_view>
+#include <utility>
+
+using namespace enjin::sdk::graphql;
+using namespace rapidjson;
+
+ListResultReader::ListResultReader(ItemHandler item_handler,
+                                   ValueHandler cursor_handler,
+                                   ValueHandler errors_handler)
+        : item_handler(std::move(item_handler)),
+          cursor_handler(std::move(cursor_handler)),
+          errors_handler(std::move(errors_handler)),
+          allocator(value_buffer, ValueBufferSize) {
+}
+
+bool ListResultReader::read(const std::string& json) {
+    is_recording = false;
+
+    return read_text(json);
+}
+
+bool ListResultReader::read(const std::shared_ptr<const std::string>& json) {
+    recorder = json::JsonSourceRecorder(json, 0);
+    is_recording = true;
+
+    return read_text(*json);
+}
+
+bool ListResultReader::has_items() const {
+    return is_result_array || (is_result_object && has_cursor && has_items_array);
+}
+
+bool ListResultReader::is_paginated() const {
+    return is_result_object && has_cursor;
+}
+
+bool ListResultReader::Null() {
+    return add_scalar();
+}
+
+bool ListResultReader::Bool(bool b) {
+    return add_scalar(b);
+}
+
+bool ListResultReader::Int(int i) {
+    return add_scalar(i);
+}
+
+bool ListResultReader::Uint(unsigned u) {
+    return add_scalar(u);
+}
+
+bool ListResultReader::Int64(int64_t i) {
+    return add_scalar(i);
+}
+
+bool ListResultReader::Uint64(uint64_t u) {
+    return add_scalar(u);
+}
+
+bool ListResultReader::Double(double d) {
+    return add_scalar(d);
+}
+
+bool ListResultReader::String(const char* str, SizeType length, bool) {
+    return add_scalar(str, length, allocator);
+}
+
+bool ListResultReader::read_text(const std::string& json) {
+    if (!json::is_within_json_byte_limit(json.size())) {
+        return false;
+    }
+
+    json::JsonParseLimiter<ListResultReader> limiter(*this);
+    Reader reader;
+    StringStream text_stream(json.c_str());
+
+    stream = &text_stream;
+    const bool is_valid = !reader.Parse(text_stream, limiter).IsError();
+    stream = nullptr;
+
+    return is_valid;
+}
+
+bool ListResultReader::StartObject() {
+    if (!is_capturing) {
+        switch (const Slot slot = get_next_slot()) {
+            case Slot::Root:
+                frames.push_back({Role::Root});
+                return true;
+            case Slot::Data:
+                frames.push_back({Role::Data});
+                return true;
+            case Slot::Result:
+                is_result_object = true;
+                frames.push_back({Role::ResultObject});
+                return true;
+            case Slot::Cursor:
+                has_cursor = true;
+                [[fallthrough]];
+            case Slot::Errors:
+            case Slot::Item:
+                capture_slot = slot;
+                is_capturing = true;
+                break;
+            default:
+                frames.push_back({Role::Skipped});
+                return true;
+        }
+    }
+
+    if (is_recording_item()) {
+        recorder.start_object(stream->Tell());
+    }
+
+    capture_depth++;
+    return true;
+}
+
+bool ListResultReader::Key(const char* str, SizeType length, bool) {
+    if (is_capturing) {
+        if (is_recording_item()) {
+            recorder.key(std::string_view(str, length));
+        }
+
+        values.emplace_back(str, length, allocator);
+        return true;
+    }
+
+    const std::string_view key(str, length);
+    Field& field = frames.back().field;
+
+    if (key == "data") {
+        field = Field::Data;
+    } else if (key == "errors") {
+        field = Field::Errors;
+    } else if (key == "result") {
+        field = Field::Result;
+    } else if (key == "items") {
+        field = Field::Items;
+    } else if (key == "cursor") {
+        field = Field::Cursor;
+    } else {
+        field = Field::Other;
+    }
+
+    return true;
+}
+
+bool ListResultReader::EndObject(SizeType member_count) {
+    if (!is_capturing) {
+        frames.pop_back();
+        return true;
+    }
+
+    Value object(kObjectType);
+    const auto first = values.end() - static_cast<std::ptrdiff_t>(member_count) * 2;
+    for (auto it = first; it != values.end(); it += 2) {
+        object.AddMember(*it, *(it + 1), allocator);
+    }
+
+    values.erase(first, values.end());
+    values.push_back(std::move(object));
+    capture_depth--;
+
+    if (is_recording_item()) {
+        recorder.end(stream->Tell());
+    }
+
+    return deliver_if_complete();
+}
+
+bool ListResultReader::StartArray() {
+    if (!is_capturing) {
+        switch (const Slot slot = get_next_slot()) {
+            case Slot::Root:
+                // Not a GraphQL response
+                return false;
+            case Slot::Result:
+                is_result_array = true;
+                frames.push_back({Role::ResultArray});
+                return true;
+            case Slot::Items:
+                has_items_array = true;
+                frames.push_back({Role::Items});
+                return true;
+            case Slot::Errors:
+            case Slot::Item:
+                capture_slot = slot;
+                is_capturing = true;
+                break;
+            default:
+                frames.push_back({Role::Skipped});
+                return true;
+        }
+    }
+
+    if (is_recording_item()) {
+        recorder.start_array(stream->Tell());
+    }
+
+    capture_depth++;
+    return true;
+}
+
+bool ListResultReader::EndArray(SizeType element_count) {
+    if (!is_capturing) {
+        frames.pop_back();
+        return true;
+    }
+
+    Value array(kArrayType);
+    array.Reserve(element_count, allocator);
+    const auto first = values.end() - static_cast<std::ptrdiff_t>(element_count);
+    for (auto it = first; it != values.end(); it++) {
+        array.PushBack(*it, allocator);
+    }
+
+    values.erase(first, values.end());
+    values.push_back(std::move(array));
+    capture_depth--;
+
+    if (is_recording_item()) {
+        recorder.end(stream->Tell());
+    }
+
+    return deliver_if_complete();
+}
+
+ListResultReader::Slot ListResultReader::get_next_slot() const {
+    if (frames.empty()) {
+        return Slot::Root;
+    }
+
+    const Frame& parent = frames.back();
+
+    switch (parent.role) {
+        case Role::Root:
+            if (parent.field == Field::Data) {
+                return Slot::Data;
+            } else if (parent.field == Field::Errors) {
+                return Slot::Errors;
+            }
+
+            return Slot::Other;
+        case Role::Data:
+            return parent.field == Field::Result
+                   ? Slot::Result
+                   : Slot::Other;
+        case Role::ResultObject:
+            if (parent.field == Field::Items) {
+                return Slot::Items;
+            } else if (parent.field == Field::Cursor) {
+                return Slot::Cursor;
+            }
+
+            return Slot::Other;
+        case Role::ResultArray:
+        case Role::Items:
+            return Slot::Item;
+        default:
+            return Slot::Other;
+    }
+}
+
+bool ListResultReader::is_recording_item() const {
+    return is_recording && capture_slot == Slot::Item;
+}
+
+template<class... Args>
+bool ListResultReader::add_scalar(Args&&... args) {
+    if (!is_capturing) {
+        const Slot slot = get_next_slot();
+
+        if (slot == Slot::Root) {
+            // Not a GraphQL response
+            return false;
+        } else if (slot != Slot::Errors && slot != Slot::Item) {
+            return true;
+        }
+
+        capture_slot = slot;
+        is_capturing = true;
+    }
+
+    values.emplace_back(std::forward<Args>(args)...);
+
+    return deliver_if_complete();
+}
+
+bool ListResultReader::deliver_if_complete() {
+    if (capture_depth > 0) {
+        return true;
+    }
+
+    const Value& value = values.back();
+
+    switch (capture_slot) {
+        case Slot::Item:
+            item_handler(value, is_recording && value.IsObject() ? &recorder.get_source(0) : nullptr);
+            break;
+        case Slot::Cursor:
+            cursor_handler(value);
+            break;
+        case Slot::Errors:
+            errors_handler(value);
+            break;
+        default:
+            break;
+    }
+
+    // Keeps the capacity of the stack and the first block of the allocator for the next value
+    values.clear();
+    allocator.Clear();
+    recorder.clear();
+    is_capturing = false;
+
+    return true;
+}
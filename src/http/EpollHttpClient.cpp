@@ -0,0 +1,1402 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/EpollHttpClient.hpp"
+
+#include "enjinsdk/EnumUtils.hpp"
+#include "enjinsdk/HttpHeaders.hpp"
+#include "enjinsdk_utils/StringUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <netdb.h>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifndef ENJINSDK_INCLUDE_EPOLL_TLS
+#define ENJINSDK_INCLUDE_EPOLL_TLS 0
+#endif
+
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+#include "openssl/err.h"
+#include "openssl/ssl.h"
+#include "openssl/x509.h"
+#endif
+
+using namespace enjin::sdk::http;
+using namespace enjin::sdk::utils;
+using namespace enjin::utils;
+
+class EpollHttpClient::Impl final {
+public:
+    Impl() = delete;
+
+    Impl(std::string base_uri, std::size_t max_connections)
+            : base_uri(std::move(base_uri)),
+              max_connections(std::max<std::size_t>(max_connections, 1)) {
+        parse_base_uri();
+    }
+
+    ~Impl() {
+        stop();
+
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        if (ssl_ctx != nullptr) {
+            SSL_CTX_free(ssl_ctx);
+        }
+#endif
+    }
+
+    void start() {
+        std::lock_guard<std::mutex> guard(state_mutex);
+        if (open) {
+            return;
+        }
+
+        resolve_host();
+        create_tls_context();
+
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0) {
+            throw std::runtime_error(system_error_message("Unable to create epoll instance"));
+        }
+
+        wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (wake_fd < 0) {
+            const std::string message = system_error_message("Unable to create event file descriptor");
+            close(epoll_fd);
+            throw std::runtime_error(message);
+        }
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.ptr = nullptr;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &event);
+
+        stopping = false;
+        open = true;
+        loop_thread = std::thread([this]() {
+            run();
+        });
+    }
+
+    void stop() {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        if (!open) {
+            return;
+        }
+
+        stopping = true;
+        wake();
+        lock.unlock();
+
+        if (loop_thread.joinable()) {
+            loop_thread.join();
+        }
+
+        lock.lock();
+        close(wake_fd);
+        close(epoll_fd);
+        wake_fd = -1;
+        epoll_fd = -1;
+        open = false;
+    }
+
+    std::future<HttpResponse> send_request(HttpRequest request) {
+        auto pending = std::make_unique<PendingRequest>();
+        std::future<HttpResponse> future = pending->promise.get_future();
+
+        try {
+            validate_request_method(request);
+            validate_request_path_query_fragment(request);
+            validate_request_content_type(request);
+            validate_request_body(request);
+
+            pending->path = request.get_path_query_fragment().value();
+            pending->data = serialize_request(request);
+            pending->idempotent = request.is_idempotent();
+        } catch (...) {
+            pending->promise.set_exception(std::current_exception());
+            return future;
+        }
+
+        std::unique_lock<std::mutex> lock(state_mutex);
+        if (!open || stopping) {
+            lock.unlock();
+            pending->promise.set_exception(std::make_exception_ptr(std::runtime_error("HTTP client is not open")));
+            return future;
+        }
+
+        in_flight_count++;
+        submitted.push_back(std::move(pending));
+        wake();
+        lock.unlock();
+
+        log_request(request);
+
+        return future;
+    }
+
+    [[nodiscard]] const std::string& get_base_uri() const {
+        return base_uri;
+    }
+
+    [[nodiscard]] std::size_t get_in_flight_count() const {
+        return in_flight_count;
+    }
+
+    [[nodiscard]] bool is_open() const {
+        std::lock_guard<std::mutex> guard(state_mutex);
+        return open;
+    }
+
+    void set_default_request_header(std::string key, std::string value) {
+        std::lock_guard<std::mutex> guard(default_headers_mutex);
+        default_headers.emplace(std::move(key), std::move(value));
+    }
+
+    void set_logger(HttpLogLevel level, std::shared_ptr<LoggerProvider> logger_provider) {
+        std::lock_guard<std::mutex> guard(logging_mutex);
+        log_level = level;
+        Impl::logger_provider = std::move(logger_provider);
+    }
+
+    void set_timeouts(std::chrono::milliseconds connect_timeout,
+                      std::chrono::milliseconds read_timeout,
+                      std::chrono::milliseconds write_timeout) {
+        Impl::connect_timeout = connect_timeout.count();
+        Impl::read_timeout = read_timeout.count();
+        Impl::write_timeout = write_timeout.count();
+    }
+
+private:
+    /// \brief Request waiting to be sent or waiting for its response.
+    struct PendingRequest {
+        std::string data;
+        std::string path;
+        std::promise<HttpResponse> promise;
+        std::chrono::steady_clock::time_point begin;
+        bool idempotent = false;
+    };
+
+    /// \brief Progress of reading a response from a connection.
+    enum class BodyMode {
+        ContentLength,
+        Chunked,
+        UntilClose,
+    };
+
+    /// \brief Non-blocking socket together with the request it is currently serving.
+    struct Connection {
+        int fd = -1;
+        uint32_t events = 0;
+        bool connected = false;
+        bool reused = false;
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        SSL* ssl = nullptr;
+        bool handshaken = false;
+#endif
+        std::unique_ptr<PendingRequest> request;
+        std::size_t written = 0;
+        std::chrono::steady_clock::time_point deadline;
+
+        // The entry of the deadline queue for this connection, which may be earlier than its deadline after the
+        // request made progress
+        std::uint64_t deadline_sequence = 0;
+        std::chrono::steady_clock::time_point queued_deadline;
+
+        // Response parsing
+        std::string in;
+        bool headers_parsed = false;
+        bool keep_alive = true;
+        unsigned short status = 0;
+        std::map<std::string, std::string> headers;
+        BodyMode body_mode = BodyMode::UntilClose;
+        std::size_t body_start = 0;
+        std::size_t content_length = 0;
+        std::size_t chunk_pos = 0;
+        std::string body;
+
+        void reset() {
+            request.reset();
+            written = 0;
+            deadline_sequence = 0;
+            in.clear();
+            headers_parsed = false;
+            keep_alive = true;
+            status = 0;
+            headers.clear();
+            body_mode = BodyMode::UntilClose;
+            body_start = 0;
+            content_length = 0;
+            chunk_pos = 0;
+            body.clear();
+        }
+
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        ~Connection() {
+            if (ssl != nullptr) {
+                SSL_free(ssl);
+            }
+        }
+#endif
+    };
+
+    /// \brief The outcome of reading from or writing to a connection.
+    enum class IoResult {
+        Progress,
+        WantRead,
+        WantWrite,
+        Closed,
+        Failed,
+    };
+
+    /// \brief Entry of the deadline queue, which is stale once its connection is closed, finishes its request or queues
+    /// another entry.
+    struct DeadlineEntry {
+        std::chrono::steady_clock::time_point deadline;
+        std::uint64_t sequence = 0;
+        int fd = -1;
+
+        bool operator>(const DeadlineEntry& rhs) const {
+            return deadline > rhs.deadline;
+        }
+    };
+
+    /// \brief The result of attempting to parse the buffered input of a connection.
+    enum class ParseResult {
+        Incomplete,
+        Complete,
+        Invalid,
+    };
+
+    static constexpr std::size_t MaxEvents = 256;
+    static constexpr std::size_t MaxHeaderSize = 64 * 1024;
+    static constexpr std::size_t ReadBufferSize = 16 * 1024;
+
+    const std::string base_uri;
+    const std::size_t max_connections;
+
+    // Parsed from the base URI
+    bool tls = false;
+    std::string host;
+    std::string port;
+    std::string host_header;
+    std::string base_path;
+
+    sockaddr_storage address{};
+    socklen_t address_length = 0;
+
+    bool open = false;
+    bool stopping = false;
+    std::map<std::string, std::string> default_headers;
+    HttpLogLevel log_level = HttpLogLevel::None;
+    std::shared_ptr<LoggerProvider> logger_provider;
+
+    int epoll_fd = -1;
+    int wake_fd = -1;
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+    SSL_CTX* ssl_ctx = nullptr;
+#endif
+    std::thread loop_thread;
+    std::vector<std::unique_ptr<PendingRequest>> submitted;
+    std::atomic<std::size_t> in_flight_count = 0;
+    std::atomic<std::chrono::milliseconds::rep> connect_timeout = DefaultConnectTimeout.count();
+    std::atomic<std::chrono::milliseconds::rep> read_timeout = DefaultReadTimeout.count();
+    std::atomic<std::chrono::milliseconds::rep> write_timeout = DefaultWriteTimeout.count();
+
+    // Owned by the event loop thread
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    std::vector<Connection*> idle_connections;
+    std::deque<std::unique_ptr<PendingRequest>> waiting;
+    std::priority_queue<DeadlineEntry, std::vector<DeadlineEntry>, std::greater<>> deadlines;
+    std::uint64_t last_deadline_sequence = 0;
+
+    // Mutexes
+    mutable std::mutex default_headers_mutex;
+    mutable std::mutex logging_mutex;
+    mutable std::mutex state_mutex;
+
+    void run() {
+        // OpenSSL writes to sockets without MSG_NOSIGNAL, so a write to a connection the server closed raises SIGPIPE
+        // on this thread unless it is blocked, in which case the write fails with EPIPE instead
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        std::vector<epoll_event> events(MaxEvents);
+
+        while (true) {
+            const int count = epoll_wait(epoll_fd,
+                                         events.data(),
+                                         static_cast<int>(events.size()),
+                                         get_wait_timeout());
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                log_error(system_error_message("Event loop failed to wait for events"));
+                break;
+            }
+
+            bool woken = false;
+            for (int i = 0; i < count; i++) {
+                auto* connection = static_cast<Connection*>(events[i].data.ptr);
+                if (connection == nullptr) {
+                    woken = true;
+                } else {
+                    handle_event(connection);
+                }
+            }
+
+            if (woken && !drain_submitted()) {
+                break;
+            }
+
+            expire_connections();
+            dispatch_waiting();
+        }
+
+        shut_down_loop();
+    }
+
+    /// \brief Moves submitted requests to the waiting queue.
+    /// \return False if the event loop is stopping.
+    bool drain_submitted() {
+        eventfd_t value;
+        eventfd_read(wake_fd, &value);
+
+        std::lock_guard<std::mutex> guard(state_mutex);
+        for (auto& request: submitted) {
+            request->begin = std::chrono::steady_clock::now();
+            waiting.push_back(std::move(request));
+        }
+        submitted.clear();
+
+        return !stopping;
+    }
+
+    void dispatch_waiting() {
+        while (!waiting.empty()) {
+            Connection* connection;
+            if (!idle_connections.empty()) {
+                connection = idle_connections.back();
+                idle_connections.pop_back();
+            } else if (connections.size() < max_connections) {
+                try {
+                    connection = open_connection();
+                } catch (const std::exception& e) {
+                    fail_request(pop_waiting(), e.what());
+                    continue;
+                }
+            } else {
+                break;
+            }
+
+            connection->request = pop_waiting();
+            arm_deadline(connection);
+            if (connection->connected) {
+                set_events(connection, EPOLLOUT);
+                handle_writable(connection);
+            }
+        }
+    }
+
+    std::unique_ptr<PendingRequest> pop_waiting() {
+        std::unique_ptr<PendingRequest> request = std::move(waiting.front());
+        waiting.pop_front();
+        return request;
+    }
+
+    Connection* open_connection() {
+        const int fd = socket(address.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            throw std::runtime_error(system_error_message("Unable to create socket"));
+        }
+
+        const int result = connect(fd, reinterpret_cast<const sockaddr*>(&address), address_length);
+        if (result < 0 && errno != EINPROGRESS) {
+            const std::string message = system_error_message("Unable to connect");
+            close(fd);
+            throw std::runtime_error(message);
+        }
+
+        auto connection = std::make_unique<Connection>();
+        connection->fd = fd;
+        connection->events = EPOLLOUT;
+        connection->connected = result == 0;
+
+        try {
+            start_tls(connection.get());
+        } catch (const std::exception&) {
+            close(fd);
+            throw;
+        }
+
+        epoll_event event{};
+        event.events = connection->events;
+        event.data.ptr = connection.get();
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            const std::string message = system_error_message("Unable to register socket");
+            close(fd);
+            throw std::runtime_error(message);
+        }
+
+        Connection* ptr = connection.get();
+        connections.emplace(fd, std::move(connection));
+        return ptr;
+    }
+
+    void close_connection(Connection* connection) {
+        idle_connections.erase(std::remove(idle_connections.begin(), idle_connections.end(), connection),
+                               idle_connections.end());
+
+        const int fd = connection->fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        close(fd);
+        connections.erase(fd);
+    }
+
+    void set_events(Connection* connection, uint32_t events) {
+        if (connection->events == events) {
+            return;
+        }
+
+        epoll_event event{};
+        event.events = events;
+        event.data.ptr = connection;
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, connection->fd, &event);
+        connection->events = events;
+    }
+
+    void handle_event(Connection* connection) {
+        if (connection->request == nullptr) {
+            handle_idle_event(connection);
+        } else if (!connection->connected
+                   || !is_handshake_done(connection)
+                   || connection->written < connection->request->data.size()) {
+            handle_writable(connection);
+        } else {
+            handle_readable(connection);
+        }
+    }
+
+    void handle_idle_event(Connection* connection) {
+        // Idle connections only become ready when the server closes them, or when the server of a TLS connection sends
+        // a message which carries no data, such as a session ticket
+        char buffer[ReadBufferSize];
+        std::size_t received = 0;
+        std::string error;
+        if (read_some(connection, buffer, sizeof(buffer), received, error) != IoResult::WantRead) {
+            close_connection(connection);
+        }
+    }
+
+    void handle_writable(Connection* connection) {
+        if (!connection->connected) {
+            int error = 0;
+            socklen_t length = sizeof(error);
+            getsockopt(connection->fd, SOL_SOCKET, SO_ERROR, &error, &length);
+            if (error != 0) {
+                fail_connection(connection, "Unable to connect: " + std::string(std::strerror(error)));
+                return;
+            }
+
+            connection->connected = true;
+            arm_deadline(connection);
+        }
+
+        if (!is_handshake_done(connection) && !continue_handshake(connection)) {
+            return;
+        }
+
+        while (connection->written < connection->request->data.size()) {
+            std::size_t sent = 0;
+            std::string error;
+            switch (write_some(connection, sent, error)) {
+                case IoResult::Progress:
+                    connection->written += sent;
+                    arm_deadline(connection);
+                    break;
+                case IoResult::WantRead:
+                    set_events(connection, EPOLLIN | EPOLLRDHUP);
+                    return;
+                case IoResult::WantWrite:
+                    set_events(connection, EPOLLOUT);
+                    return;
+                case IoResult::Closed:
+                    fail_connection(connection, "Unable to write request: Connection was closed");
+                    return;
+                case IoResult::Failed:
+                default:
+                    fail_connection(connection, "Unable to write request: " + error);
+                    return;
+            }
+        }
+
+        set_events(connection, EPOLLIN | EPOLLRDHUP);
+    }
+
+    void handle_readable(Connection* connection) {
+        char buffer[ReadBufferSize];
+        bool eof = false;
+        bool blocked = false;
+
+        while (!eof && !blocked) {
+            std::size_t received = 0;
+            std::string error;
+            switch (read_some(connection, buffer, sizeof(buffer), received, error)) {
+                case IoResult::Progress:
+                    connection->in.append(buffer, received);
+                    arm_deadline(connection);
+                    break;
+                case IoResult::Closed:
+                    eof = true;
+                    break;
+                case IoResult::WantRead:
+                    set_events(connection, EPOLLIN | EPOLLRDHUP);
+                    blocked = true;
+                    break;
+                case IoResult::WantWrite:
+                    set_events(connection, EPOLLIN | EPOLLRDHUP | EPOLLOUT);
+                    blocked = true;
+                    break;
+                case IoResult::Failed:
+                default:
+                    fail_connection(connection, "Unable to read response: " + error);
+                    return;
+            }
+        }
+
+        switch (parse_response(connection)) {
+            case ParseResult::Complete:
+                complete_request(connection);
+                return;
+            case ParseResult::Invalid:
+                fail_connection(connection, "Received malformed HTTP response");
+                return;
+            case ParseResult::Incomplete:
+                break;
+        }
+
+        if (!eof) {
+            return;
+        } else if (connection->headers_parsed && connection->body_mode == BodyMode::UntilClose) {
+            connection->body = connection->in.substr(connection->body_start);
+            connection->keep_alive = false;
+            complete_request(connection);
+        } else {
+            fail_connection(connection, "Connection was closed before the response was received");
+        }
+    }
+
+    /// \brief Reads the next part of the response from the connection.
+    /// \param connection The connection.
+    /// \param buffer The buffer to read into.
+    /// \param size The size of the buffer.
+    /// \param count Set to the number of bytes read, if any were.
+    /// \param error Set to the cause of the failure, if reading failed.
+    /// \return The result.
+    static IoResult read_some(Connection* connection,
+                              char* buffer,
+                              std::size_t size,
+                              std::size_t& count,
+                              std::string& error) {
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        if (connection->ssl != nullptr) {
+            ERR_clear_error();
+            const int result = SSL_read(connection->ssl, buffer, static_cast<int>(size));
+            if (result > 0) {
+                count = static_cast<std::size_t>(result);
+                return IoResult::Progress;
+            }
+
+            return get_tls_io_result(connection, result, error);
+        }
+#endif
+
+        while (true) {
+            const ssize_t received = recv(connection->fd, buffer, size, 0);
+            if (received > 0) {
+                count = static_cast<std::size_t>(received);
+                return IoResult::Progress;
+            } else if (received == 0) {
+                return IoResult::Closed;
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return IoResult::WantRead;
+            } else if (errno != EINTR) {
+                error = std::strerror(errno);
+                return IoResult::Failed;
+            }
+        }
+    }
+
+    /// \brief Writes the next part of the request of the connection.
+    /// \param connection The connection.
+    /// \param count Set to the number of bytes written, if any were.
+    /// \param error Set to the cause of the failure, if writing failed.
+    /// \return The result.
+    static IoResult write_some(Connection* connection, std::size_t& count, std::string& error) {
+        const std::string& data = connection->request->data;
+        const char* remaining = data.data() + connection->written;
+        const std::size_t remaining_size = data.size() - connection->written;
+
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        if (connection->ssl != nullptr) {
+            ERR_clear_error();
+            const int result = SSL_write(connection->ssl,
+                                         remaining,
+                                         static_cast<int>(std::min<std::size_t>(remaining_size,
+                                                                                std::numeric_limits<int>::max())));
+            if (result > 0) {
+                count = static_cast<std::size_t>(result);
+                return IoResult::Progress;
+            }
+
+            return get_tls_io_result(connection, result, error);
+        }
+#endif
+
+        while (true) {
+            const ssize_t sent = send(connection->fd, remaining, remaining_size, MSG_NOSIGNAL);
+            if (sent >= 0) {
+                count = static_cast<std::size_t>(sent);
+                return IoResult::Progress;
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return IoResult::WantWrite;
+            } else if (errno != EINTR) {
+                error = std::strerror(errno);
+                return IoResult::Failed;
+            }
+        }
+    }
+
+    void create_tls_context() {
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        if (!tls || ssl_ctx != nullptr) {
+            return;
+        }
+
+        ssl_ctx = SSL_CTX_new(TLS_client_method());
+        if (ssl_ctx == nullptr) {
+            throw std::runtime_error("Unable to create TLS context");
+        }
+
+        SSL_CTX_set_min_proto_version(ssl_ctx, TLS1_2_VERSION);
+        SSL_CTX_set_default_verify_paths(ssl_ctx);
+        SSL_CTX_set_verify(ssl_ctx, SSL_VERIFY_PEER, nullptr);
+#ifdef SSL_OP_IGNORE_UNEXPECTED_EOF
+        // Servers commonly close connections without a close_notify alert, which is treated as the end of the response
+        SSL_CTX_set_options(ssl_ctx, SSL_OP_IGNORE_UNEXPECTED_EOF);
+#endif
+#endif
+    }
+
+    /// \brief Prepares the TLS connection over the socket of the connection, if the base URI is HTTPS. The handshake
+    /// is driven by continue_handshake() once the socket is connected.
+    /// \param connection The connection.
+    void start_tls([[maybe_unused]] Connection* connection) {
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        if (!tls) {
+            return;
+        }
+
+        connection->ssl = SSL_new(ssl_ctx);
+        if (connection->ssl == nullptr) {
+            throw std::runtime_error("Unable to create TLS connection");
+        }
+
+        SSL_set_mode(connection->ssl, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+        SSL_set_tlsext_host_name(connection->ssl, host.c_str());
+        SSL_set1_host(connection->ssl, host.c_str());
+        SSL_set_fd(connection->ssl, connection->fd);
+        SSL_set_connect_state(connection->ssl);
+#endif
+    }
+
+    static bool is_handshake_done([[maybe_unused]] const Connection* connection) {
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        return connection->ssl == nullptr || connection->handshaken;
+#else
+        return true;
+#endif
+    }
+
+    /// \brief Advances the TLS handshake of the connection.
+    /// \param connection The connection.
+    /// \return Whether the handshake is done. The connection is failed if the handshake failed.
+    bool continue_handshake([[maybe_unused]] Connection* connection) {
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+        ERR_clear_error();
+        const int result = SSL_do_handshake(connection->ssl);
+        if (result == 1) {
+            connection->handshaken = true;
+            arm_deadline(connection);
+            return true;
+        }
+
+        std::string error;
+        switch (get_tls_io_result(connection, result, error)) {
+            case IoResult::WantRead:
+                set_events(connection, EPOLLIN | EPOLLRDHUP);
+                return false;
+            case IoResult::WantWrite:
+                set_events(connection, EPOLLOUT);
+                return false;
+            case IoResult::Closed:
+                error = "Connection was closed";
+                break;
+            default:
+                break;
+        }
+
+        const long verify_result = SSL_get_verify_result(connection->ssl);
+        if (verify_result != X509_V_OK) {
+            error = X509_verify_cert_error_string(verify_result);
+        }
+
+        fail_connection(connection, "TLS handshake with '" + host + "' failed: " + error);
+#endif
+        return false;
+    }
+
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+    static IoResult get_tls_io_result(Connection* connection, int result, std::string& error) {
+        switch (SSL_get_error(connection->ssl, result)) {
+            case SSL_ERROR_WANT_READ:
+                return IoResult::WantRead;
+            case SSL_ERROR_WANT_WRITE:
+                return IoResult::WantWrite;
+            case SSL_ERROR_ZERO_RETURN:
+                return IoResult::Closed;
+            case SSL_ERROR_SYSCALL:
+                if (ERR_peek_error() == 0) {
+                    // OpenSSL 1.1.1 reports a connection closed without a close_notify alert with a result of zero
+                    if (result == 0) {
+                        return IoResult::Closed;
+                    }
+
+                    error = std::strerror(errno);
+                    return IoResult::Failed;
+                }
+
+                break;
+            default:
+                break;
+        }
+
+        const unsigned long code = ERR_get_error();
+        if (code == 0) {
+            error = "TLS error";
+        } else {
+            char buffer[256];
+            ERR_error_string_n(code, buffer, sizeof(buffer));
+            error = buffer;
+        }
+
+        return IoResult::Failed;
+    }
+#endif
+
+    ParseResult parse_response(Connection* connection) {
+        if (!connection->headers_parsed) {
+            const std::size_t end = connection->in.find("\r\n\r\n");
+            if (end == std::string::npos) {
+                return connection->in.size() > MaxHeaderSize ? ParseResult::Invalid : ParseResult::Incomplete;
+            } else if (!parse_head(connection, end)) {
+                return ParseResult::Invalid;
+            }
+        }
+
+        switch (connection->body_mode) {
+            case BodyMode::ContentLength:
+                if (connection->in.size() - connection->body_start < connection->content_length) {
+                    return ParseResult::Incomplete;
+                }
+
+                connection->body = connection->in.substr(connection->body_start, connection->content_length);
+                return ParseResult::Complete;
+            case BodyMode::Chunked:
+                return parse_chunks(connection);
+            case BodyMode::UntilClose:
+            default:
+                return ParseResult::Incomplete;
+        }
+    }
+
+    static bool parse_head(Connection* connection, std::size_t end) {
+        const std::string head = connection->in.substr(0, end);
+        connection->body_start = end + 4;
+        connection->headers_parsed = true;
+
+        std::size_t line_end = head.find("\r\n");
+        const std::string status_line = head.substr(0, line_end);
+
+        // Status line, e.g. "HTTP/1.1 200 OK"
+        const std::size_t first_space = status_line.find(' ');
+        if (status_line.compare(0, 5, "HTTP/") != 0 || first_space == std::string::npos) {
+            return false;
+        }
+
+        try {
+            connection->status = static_cast<unsigned short>(std::stoi(status_line.substr(first_space + 1, 3)));
+        } catch (const std::exception&) {
+            return false;
+        }
+
+        connection->keep_alive = status_line.compare(0, 8, "HTTP/1.0") != 0;
+
+        // Headers
+        bool has_content_length = false;
+        while (line_end != std::string::npos) {
+            const std::size_t line_start = line_end + 2;
+            line_end = head.find("\r\n", line_start);
+            const std::string line = head.substr(line_start, line_end == std::string::npos
+                                                             ? std::string::npos
+                                                             : line_end - line_start);
+
+            const std::size_t colon = line.find(':');
+            if (colon == std::string::npos) {
+                continue;
+            }
+
+            const std::string name = trim(line.substr(0, colon));
+            const std::string value = trim(line.substr(colon + 1));
+            const std::string lower_name = to_lower(name);
+            const std::string lower_value = to_lower(value);
+
+            if (lower_name == "content-length") {
+                try {
+                    connection->content_length = std::stoul(value);
+                } catch (const std::exception&) {
+                    return false;
+                }
+
+                has_content_length = true;
+            } else if (lower_name == "transfer-encoding" && lower_value.find("chunked") != std::string::npos) {
+                connection->body_mode = BodyMode::Chunked;
+            } else if (lower_name == "connection") {
+                if (lower_value == "close") {
+                    connection->keep_alive = false;
+                } else if (lower_value == "keep-alive") {
+                    connection->keep_alive = true;
+                }
+            }
+
+            connection->headers.emplace(name, value);
+        }
+
+        if (connection->body_mode == BodyMode::Chunked) {
+            connection->chunk_pos = connection->body_start;
+        } else if (has_content_length) {
+            connection->body_mode = BodyMode::ContentLength;
+        } else if (connection->status == 204 || connection->status == 304 || connection->status < 200) {
+            connection->body_mode = BodyMode::ContentLength;
+            connection->content_length = 0;
+        }
+
+        return true;
+    }
+
+    static ParseResult parse_chunks(Connection* connection) {
+        const std::string& in = connection->in;
+
+        while (true) {
+            const std::size_t size_end = in.find("\r\n", connection->chunk_pos);
+            if (size_end == std::string::npos) {
+                return ParseResult::Incomplete;
+            }
+
+            std::size_t size;
+            try {
+                // Chunk extensions following a ';' are ignored by std::stoul
+                size = std::stoul(in.substr(connection->chunk_pos, size_end - connection->chunk_pos), nullptr, 16);
+            } catch (const std::exception&) {
+                return ParseResult::Invalid;
+            }
+
+            const std::size_t data_start = size_end + 2;
+            if (size == 0) {
+                // Last chunk, followed by optional trailers and an empty line
+                if (in.compare(data_start, 2, "\r\n") == 0) {
+                    return ParseResult::Complete;
+                }
+
+                return in.find("\r\n\r\n", size_end) == std::string::npos
+                       ? ParseResult::Incomplete
+                       : ParseResult::Complete;
+            } else if (in.size() < data_start + size + 2) {
+                return ParseResult::Incomplete;
+            }
+
+            connection->body.append(in, data_start, size);
+            connection->chunk_pos = data_start + size + 2;
+        }
+    }
+
+    void complete_request(Connection* connection) {
+        std::unique_ptr<PendingRequest> request = std::move(connection->request);
+
+        auto builder = HttpResponse::builder();
+        for (auto& [key, value]: connection->headers) {
+            builder.add_header(key, value);
+        }
+
+        HttpResponse response = builder.code(connection->status)
+                                       .body(std::move(connection->body))
+                                       .build();
+
+        const auto rtt = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()
+                                                                               - request->begin);
+        log_response(request->path, response, rtt);
+
+        const bool keep_alive = connection->keep_alive;
+        connection->reset();
+        if (keep_alive) {
+            connection->reused = true;
+            idle_connections.push_back(connection);
+        } else {
+            close_connection(connection);
+        }
+
+        in_flight_count--;
+        request->promise.set_value(std::move(response));
+    }
+
+    void fail_connection(Connection* connection, const std::string& message, bool may_retry = true) {
+        std::unique_ptr<PendingRequest> request = std::move(connection->request);
+        const bool retry = may_retry && connection->reused && connection->in.empty();
+        close_connection(connection);
+
+        if (request == nullptr) {
+            return;
+        } else if (retry && request->idempotent) {
+            // The server closed the keep-alive connection before it was reused, so the request is sent again. This ends
+            // once the request is sent over a new connection, as those are never retried. Requests which are not
+            // idempotent fail instead, as the server may have processed them before closing the connection.
+            waiting.push_front(std::move(request));
+            return;
+        }
+
+        fail_request(std::move(request), message);
+    }
+
+    /// \brief Sets the deadline of the connection for the step its request is at, which restarts whenever the request
+    /// makes progress.
+    /// \param connection The connection.
+    void arm_deadline(Connection* connection) {
+        std::chrono::milliseconds::rep timeout;
+        if (!connection->connected || !is_handshake_done(connection)) {
+            timeout = connect_timeout;
+        } else if (connection->written < connection->request->data.size()) {
+            timeout = write_timeout;
+        } else {
+            timeout = read_timeout;
+        }
+
+        connection->deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+        // A later deadline is left for the queued entry to find once it expires, so that progress on a request does
+        // not push an entry each time
+        if (connection->deadline_sequence == 0 || connection->deadline < connection->queued_deadline) {
+            queue_deadline(connection);
+        }
+    }
+
+    void queue_deadline(Connection* connection) {
+        connection->deadline_sequence = ++last_deadline_sequence;
+        connection->queued_deadline = connection->deadline;
+        deadlines.push(DeadlineEntry{connection->deadline, connection->deadline_sequence, connection->fd});
+    }
+
+    /// \brief Returns the connection a deadline entry was queued for.
+    /// \param entry The entry.
+    /// \return The connection, or null if the entry is stale or the connection has no request.
+    Connection* find_deadline_connection(const DeadlineEntry& entry) const {
+        auto it = connections.find(entry.fd);
+        if (it == connections.end() || it->second->deadline_sequence != entry.sequence) {
+            return nullptr;
+        }
+
+        Connection* connection = it->second.get();
+        return connection->request != nullptr ? connection : nullptr;
+    }
+
+    /// \brief Fails the requests of the connections whose deadlines have passed.
+    void expire_connections() {
+        const auto now = std::chrono::steady_clock::now();
+
+        while (!deadlines.empty() && deadlines.top().deadline <= now) {
+            Connection* connection = find_deadline_connection(deadlines.top());
+            deadlines.pop();
+            if (connection == nullptr) {
+                continue;
+            }
+
+            connection->deadline_sequence = 0;
+            if (connection->deadline > now) {
+                // The request made progress since the entry was queued
+                queue_deadline(connection);
+            } else if (!connection->connected) {
+                fail_connection(connection, "Timed out connecting", false);
+            } else if (!is_handshake_done(connection)) {
+                fail_connection(connection, "Timed out during TLS handshake", false);
+            } else if (connection->written < connection->request->data.size()) {
+                fail_connection(connection, "Timed out writing request", false);
+            } else {
+                fail_connection(connection, "Timed out reading response", false);
+            }
+        }
+    }
+
+    /// \brief Returns how long the event loop may wait for events before the nearest deadline passes.
+    /// \return The time in milliseconds, or -1 if no request has a deadline.
+    int get_wait_timeout() {
+        while (!deadlines.empty() && find_deadline_connection(deadlines.top()) == nullptr) {
+            deadlines.pop();
+        }
+
+        if (deadlines.empty()) {
+            return -1;
+        }
+
+        const auto nearest = deadlines.top().deadline;
+        const auto now = std::chrono::steady_clock::now();
+        if (nearest <= now) {
+            return 0;
+        }
+
+        // Rounds up so that the loop does not wake just before the deadline and wait again
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(nearest - now).count();
+        return static_cast<int>(std::min<std::chrono::milliseconds::rep>(remaining, std::numeric_limits<int>::max()));
+    }
+
+    void fail_request(std::unique_ptr<PendingRequest> request, const std::string& message) {
+        log_error(message);
+        in_flight_count--;
+        request->promise.set_exception(std::make_exception_ptr(std::runtime_error(message)));
+    }
+
+    void shut_down_loop() {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        for (auto& request: submitted) {
+            waiting.push_back(std::move(request));
+        }
+        submitted.clear();
+        lock.unlock();
+
+        while (!waiting.empty()) {
+            fail_request(pop_waiting(), "HTTP client was stopped");
+        }
+
+        for (auto& entry: connections) {
+            Connection* connection = entry.second.get();
+            if (connection->request != nullptr) {
+                fail_request(std::move(connection->request), "HTTP client was stopped");
+            }
+
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, connection->fd, nullptr);
+            close(connection->fd);
+        }
+
+        connections.clear();
+        idle_connections.clear();
+        deadlines = {};
+    }
+
+    // Expects the state mutex to be held by the caller so that the descriptor is not closed concurrently
+    void wake() {
+        eventfd_write(wake_fd, 1);
+    }
+
+    std::string serialize_request(const HttpRequest& request) {
+        const std::string& body = request.get_body().value();
+
+        std::stringstream ss;
+        ss << EnumUtils::serialize_http_method(request.get_method().value()) << " "
+           << base_path << request.get_path_query_fragment().value() << " HTTP/1.1\r\n"
+           << "Host: " << host_header << "\r\n"
+           << "Content-Length: " << body.size() << "\r\n";
+
+        std::unique_lock<std::mutex> default_headers_lock(default_headers_mutex);
+        for (const auto& [key, value]: default_headers) {
+            if (!request.has_header(key)) {
+                ss << key << ": " << value << "\r\n";
+            }
+        }
+        default_headers_lock.unlock();
+
+        for (const auto& [key, value]: request.get_headers()) {
+            ss << key << ": " << value << "\r\n";
+        }
+
+        ss << "\r\n";
+
+        // Appends the body directly rather than streaming it, which would copy it twice
+        std::string data = ss.str();
+        data.reserve(data.size() + body.size());
+        data.append(body);
+        return data;
+    }
+
+    void parse_base_uri() {
+        static const std::string http_scheme("http://");
+        static const std::string https_scheme("https://");
+
+        std::size_t authority_start;
+        if (base_uri.compare(0, http_scheme.size(), http_scheme) == 0) {
+            authority_start = http_scheme.size();
+        } else if (base_uri.compare(0, https_scheme.size(), https_scheme) == 0) {
+            if (!ENJINSDK_INCLUDE_EPOLL_TLS) {
+                throw std::runtime_error("Base URI for EpollHttpClient uses the 'https' scheme, which requires the SDK "
+                                         "to be built with OpenSSL");
+            }
+
+            tls = true;
+            authority_start = https_scheme.size();
+        } else {
+            throw std::runtime_error("Base URI for EpollHttpClient must use the 'http' or 'https' scheme");
+        }
+
+        const std::size_t path_start = base_uri.find('/', authority_start);
+        const std::string authority = base_uri.substr(authority_start, path_start - authority_start);
+        base_path = path_start == std::string::npos ? "" : base_uri.substr(path_start);
+        if (!base_path.empty() && base_path.back() == '/') {
+            base_path.pop_back();
+        }
+
+        const std::size_t colon = authority.rfind(':');
+        if (colon == std::string::npos || authority.find(']', colon) != std::string::npos) {
+            host = authority;
+            port = tls ? "443" : "80";
+        } else {
+            host = authority.substr(0, colon);
+            port = authority.substr(colon + 1);
+        }
+
+        host_header = authority;
+        if (host.size() > 1 && host.front() == '[' && host.back() == ']') {
+            host = host.substr(1, host.size() - 2);
+        }
+
+        if (host.empty() || port.empty()) {
+            throw std::runtime_error("Base URI for EpollHttpClient is malformed");
+        }
+    }
+
+    void resolve_host() {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo* result = nullptr;
+        const int error = getaddrinfo(host.c_str(), port.c_str(), &hints, &result);
+        if (error != 0 || result == nullptr) {
+            throw std::runtime_error("Unable to resolve host '" + host + "': " + gai_strerror(error));
+        }
+
+        std::memcpy(&address, result->ai_addr, result->ai_addrlen);
+        address_length = result->ai_addrlen;
+        freeaddrinfo(result);
+    }
+
+    void log_error(const std::string& message) {
+        std::lock_guard<std::mutex> guard(logging_mutex);
+        if (logger_provider != nullptr) {
+            logger_provider->log(LogLevel::Error, message);
+        }
+    }
+
+    void log_request(const HttpRequest& request) {
+        std::lock_guard<std::mutex> guard(logging_mutex);
+        if (log_level == HttpLogLevel::None || logger_provider == nullptr) {
+            return;
+        }
+
+        std::stringstream ss;
+
+        const auto method = EnumUtils::serialize_http_method(request.get_method().value());
+        const auto uri = base_uri + request.get_path_query_fragment().value();
+        const auto content_length = request.get_body().value().size();
+
+        // Line
+        if (log_level == HttpLogLevel::Basic) {
+            ss << "--> " << method << " " << uri << " (" << content_length << "-byte body)\n";
+            logger_provider->log(ss.str());
+            return;
+        }
+
+        ss << "--> " << method << " " << uri << "\n";
+
+        // Headers
+        for (const auto& [k, v]: request.get_headers()) {
+            ss << k << ": " << v << "\n";
+        }
+
+        if (log_level == HttpLogLevel::Headers) {
+            ss << "<-- END " << method << "\n";
+            logger_provider->log(ss.str());
+            return;
+        }
+
+        // Body
+        ss << "\n" // Line break between headers and body
+           << request.get_body().value() << "\n"
+           << "<-- END " << method << " (" << content_length << "-byte body)\n";
+        logger_provider->log(ss.str());
+    }
+
+    void log_response(const std::string& path, const HttpResponse& response, std::chrono::milliseconds rtt) {
+        std::lock_guard<std::mutex> guard(logging_mutex);
+        if (log_level == HttpLogLevel::None || logger_provider == nullptr) {
+            return;
+        }
+
+        std::stringstream ss;
+
+        // Line
+        ss << "<-- " << response.get_code().value() << " " << base_uri << path << " (" << rtt.count() << "ms)\n";
+
+        if (log_level == HttpLogLevel::Basic) {
+            logger_provider->log(ss.str());
+            return;
+        }
+
+        // Headers
+        for (const auto& [k, v]: response.get_headers()) {
+            ss << k << ": " << v << "\n";
+        }
+
+        if (log_level == HttpLogLevel::Headers) {
+            ss << "<-- END HTTP\n";
+            logger_provider->log(ss.str());
+            return;
+        }
+
+        // Body
+        ss << "\n"
+           << response.get_body().value_or("") << "\n"
+           << "<-- END HTTP\n";
+        logger_provider->log(ss.str());
+    }
+
+    void validate_request_body(const HttpRequest& req) {
+        if (req.get_body().has_value()) {
+            return;
+        }
+
+        const std::string message("Request does not have a body");
+        log_error(message);
+        throw std::runtime_error(message);
+    }
+
+    void validate_request_content_type(const HttpRequest& req) {
+        if (req.get_content_type().has_value()) {
+            return;
+        }
+
+        const std::string message("Request does not have a content-type header");
+        log_error(message);
+        throw std::runtime_error(message);
+    }
+
+    void validate_request_method(const HttpRequest& req) {
+        if (req.get_method().has_value() && req.get_method().value() == HttpMethod::Post) {
+            return;
+        }
+
+        const std::string message("HTTP method for request is not 'POST'");
+        log_error(message);
+        throw std::runtime_error(message);
+    }
+
+    void validate_request_path_query_fragment(const HttpRequest& req) {
+        if (req.get_path_query_fragment().has_value()) {
+            return;
+        }
+
+        const std::string message("Request does not have a path query fragment");
+        log_error(message);
+        throw std::runtime_error(message);
+    }
+
+    static std::string system_error_message(const std::string& message) {
+        return message + ": " + std::strerror(errno);
+    }
+};
+
+EpollHttpClient::EpollHttpClient(std::string base_uri, std::size_t max_connections)
+        : pimpl(std::make_unique<Impl>(std::move(base_uri), max_connections)) {
+}
+
+EpollHttpClient::~EpollHttpClient() = default;
+
+void EpollHttpClient::start() {
+    pimpl->start();
+}
+
+void EpollHttpClient::stop() {
+    pimpl->stop();
+}
+
+std::future<HttpResponse> EpollHttpClient::send_request(HttpRequest request) {
+    return pimpl->send_request(std::move(request));
+}
+
+const std::string& EpollHttpClient::get_base_uri() const {
+    return pimpl->get_base_uri();
+}
+
+std::size_t EpollHttpClient::get_in_flight_count() const {
+    return pimpl->get_in_flight_count();
+}
+
+bool EpollHttpClient::is_open() const {
+    return pimpl->is_open();
+}
+
+void EpollHttpClient::set_default_request_header(std::string key, std::string value) {
+    pimpl->set_default_request_header(std::move(key), std::move(value));
+}
+
+void EpollHttpClient::set_logger(HttpLogLevel level, std::shared_ptr<LoggerProvider> logger_provider) {
+    pimpl->set_logger(level, std::move(logger_provider));
+}
+
+void EpollHttpClient::set_timeouts(std::chrono::milliseconds connect_timeout,
+                                   std::chrono::milliseconds read_timeout,
+                                   std::chrono::milliseconds write_timeout) {
+    pimpl->set_timeouts(connect_timeout, read_timeout, write_timeout);
+}
@@ -0,0 +1,1235 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/Http2Client.hpp"
+
+#include "enjinsdk/EnumUtils.hpp"
+#include "enjinsdk_utils/StringUtils.hpp"
+#include "nghttp2/nghttp2.h"
+#include "openssl/err.h"
+#include "openssl/ssl.h"
+#include "openssl/x509.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <netdb.h>
+#include <optional>
+#include <poll.h>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace enjin::sdk::http;
+using namespace enjin::sdk::utils;
+using namespace enjin::utils;
+
+class Http2Client::Impl final {
+public:
+    Impl() = delete;
+
+    explicit Impl(std::string base_uri) : base_uri(std::move(base_uri)) {
+        parse_base_uri();
+    }
+
+    ~Impl() {
+        stop();
+
+        if (ssl_ctx != nullptr) {
+            SSL_CTX_free(ssl_ctx);
+        }
+    }
+
+    void start() {
+        std::lock_guard<std::mutex> guard(state_mutex);
+        if (open) {
+            return;
+        }
+
+        if (pipe(wake_fds) < 0) {
+            throw std::runtime_error(system_error_message("Unable to create wake pipe"));
+        }
+
+        set_non_blocking(wake_fds[0]);
+        set_non_blocking(wake_fds[1]);
+
+        stopping = false;
+        open = true;
+        loop_thread = std::thread([this]() {
+            run();
+        });
+    }
+
+    void stop() {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        if (!open) {
+            return;
+        }
+
+        stopping = true;
+        wake();
+        lock.unlock();
+
+        if (loop_thread.joinable()) {
+            loop_thread.join();
+        }
+
+        lock.lock();
+        close(wake_fds[0]);
+        close(wake_fds[1]);
+        wake_fds[0] = -1;
+        wake_fds[1] = -1;
+        open = false;
+    }
+
+    std::future<HttpResponse> send_request(HttpRequest request) {
+        auto pending = std::make_unique<PendingRequest>();
+        std::future<HttpResponse> future = pending->promise.get_future();
+
+        try {
+            validate_request_method(request);
+            validate_request_path_query_fragment(request);
+            validate_request_content_type(request);
+            validate_request_body(request);
+
+            log_request(request);
+
+            pending->path = request.get_path_query_fragment().value();
+            pending->headers = create_headers(request);
+            pending->body = request.take_body().value();
+        } catch (...) {
+            pending->promise.set_exception(std::current_exception());
+            return future;
+        }
+
+        std::unique_lock<std::mutex> lock(state_mutex);
+        if (!open || stopping) {
+            lock.unlock();
+            pending->promise.set_exception(std::make_exception_ptr(std::runtime_error("HTTP client is not open")));
+            return future;
+        }
+
+        in_flight_count++;
+        submitted.push_back(std::move(pending));
+        wake();
+        lock.unlock();
+
+        return future;
+    }
+
+    [[nodiscard]] const std::string& get_base_uri() const {
+        return base_uri;
+    }
+
+    [[nodiscard]] std::size_t get_connection_count() const {
+        return connection_count;
+    }
+
+    [[nodiscard]] std::size_t get_in_flight_count() const {
+        return in_flight_count;
+    }
+
+    [[nodiscard]] bool is_open() const {
+        std::lock_guard<std::mutex> guard(state_mutex);
+        return open;
+    }
+
+    void set_default_request_header(std::string key, std::string value) {
+        std::lock_guard<std::mutex> guard(default_headers_mutex);
+        default_headers.emplace(std::move(key), std::move(value));
+    }
+
+    void set_logger(HttpLogLevel level, std::shared_ptr<LoggerProvider> logger_provider) {
+        std::lock_guard<std::mutex> guard(logging_mutex);
+        log_level = level;
+        Impl::logger_provider = std::move(logger_provider);
+    }
+
+    void set_timeouts(std::chrono::milliseconds connect_timeout,
+                      std::chrono::milliseconds read_timeout,
+                      std::chrono::milliseconds request_timeout) {
+        Impl::connect_timeout = connect_timeout.count();
+        Impl::read_timeout = read_timeout.count();
+        Impl::request_timeout = request_timeout.count();
+    }
+
+private:
+    /// \brief Request waiting to be submitted or waiting for its response.
+    struct PendingRequest {
+        std::string path;
+        std::vector<std::pair<std::string, std::string>> headers;
+        std::string body;
+        std::size_t body_offset = 0;
+        std::promise<HttpResponse> promise;
+        std::chrono::steady_clock::time_point begin;
+
+        // Timeouts
+        std::uint64_t id = 0;
+        int32_t stream_id = 0;
+        bool expired = false;
+        std::chrono::steady_clock::time_point last_activity;
+        std::chrono::milliseconds read_timeout{};
+        std::chrono::milliseconds request_timeout{};
+
+        // Response
+        unsigned short status = 0;
+        std::map<std::string, std::string> response_headers;
+        std::string response_body;
+    };
+
+    /// \brief The result of a read from or write to the transport.
+    enum class IoResult {
+        Done,
+        WouldBlock,
+        Closed,
+        Error,
+    };
+
+    /// \brief The state of the connection to the server.
+    enum class ConnectionState {
+        Closed,
+        Connecting,
+        Handshaking,
+        Open,
+    };
+
+    /// \brief Entry of the deadline heap, which may be stale if the request completed or its deadline was extended.
+    struct DeadlineEntry {
+        std::chrono::steady_clock::time_point deadline;
+        std::uint64_t id = 0;
+
+        bool operator>(const DeadlineEntry& rhs) const {
+            return deadline > rhs.deadline;
+        }
+    };
+
+    static constexpr std::size_t ReadBufferSize = 16 * 1024;
+    static constexpr int32_t StreamWindowSize = 1 << 20;
+    static constexpr int32_t ConnectionWindowSize = 1 << 24;
+
+    const std::string base_uri;
+
+    // Parsed from the base URI
+    bool tls = false;
+    std::string host;
+    std::string port;
+    std::string authority;
+    std::string base_path;
+
+    bool open = false;
+    bool stopping = false;
+    std::map<std::string, std::string> default_headers;
+    HttpLogLevel log_level = HttpLogLevel::None;
+    std::shared_ptr<LoggerProvider> logger_provider;
+
+    int wake_fds[2] = {-1, -1};
+    std::thread loop_thread;
+    std::vector<std::unique_ptr<PendingRequest>> submitted;
+    std::atomic<std::size_t> connection_count = 0;
+    std::atomic<std::size_t> in_flight_count = 0;
+    std::atomic<std::chrono::milliseconds::rep> connect_timeout = DefaultConnectTimeout.count();
+    std::atomic<std::chrono::milliseconds::rep> read_timeout = DefaultReadTimeout.count();
+    std::atomic<std::chrono::milliseconds::rep> request_timeout = DefaultRequestTimeout.count();
+
+    // Owned by the event loop thread
+    int fd = -1;
+    ConnectionState connection_state = ConnectionState::Closed;
+    std::vector<std::pair<sockaddr_storage, socklen_t>> addresses;
+    std::size_t next_address = 0;
+    std::chrono::steady_clock::time_point connect_deadline;
+    bool handshake_wants_write = false;
+    SSL_CTX* ssl_ctx = nullptr;
+    SSL* ssl = nullptr;
+    nghttp2_session* session = nullptr;
+    bool session_exhausted = false;
+    std::string out;
+    std::size_t out_offset = 0;
+    std::deque<std::unique_ptr<PendingRequest>> waiting;
+    std::unordered_map<int32_t, std::unique_ptr<PendingRequest>> streams;
+    std::priority_queue<DeadlineEntry, std::vector<DeadlineEntry>, std::greater<>> deadlines;
+    std::unordered_map<std::uint64_t, PendingRequest*> timed_requests;
+    std::uint64_t last_request_id = 0;
+
+    // Mutexes
+    mutable std::mutex default_headers_mutex;
+    mutable std::mutex logging_mutex;
+    mutable std::mutex state_mutex;
+
+    void run() {
+        // OpenSSL writes to sockets without MSG_NOSIGNAL, so a write to a connection the server closed raises SIGPIPE
+        // on this thread unless it is blocked, in which case the write fails with EPIPE instead
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        while (take_submitted()) {
+            expire_requests();
+
+            if (connection_state == ConnectionState::Closed && !waiting.empty()) {
+                try {
+                    open_connection();
+                } catch (const std::exception& e) {
+                    abandon_connection(e.what());
+                    continue;
+                }
+            }
+
+            if (session != nullptr) {
+                submit_waiting();
+
+                if (!flush()) {
+                    close_session("Unable to write to the HTTP/2 connection");
+                    continue;
+                } else if (nghttp2_session_want_read(session) == 0 && nghttp2_session_want_write(session) == 0) {
+                    close_session("HTTP/2 connection was closed");
+                    continue;
+                } else if (session_exhausted && streams.empty()) {
+                    // No more stream IDs are available, so the waiting requests are sent over a new connection
+                    close_session();
+                    continue;
+                }
+            }
+
+            poll_events();
+        }
+
+        close_session("HTTP client was stopped");
+        while (!waiting.empty()) {
+            fail_request(pop_waiting(), "HTTP client was stopped");
+        }
+
+        deadlines = {};
+    }
+
+    /// \brief Moves submitted requests to the waiting queue.
+    /// \return False if the event loop is stopping.
+    bool take_submitted() {
+        std::lock_guard<std::mutex> guard(state_mutex);
+        for (auto& request: submitted) {
+            request->begin = std::chrono::steady_clock::now();
+            request->id = ++last_request_id;
+            request->read_timeout = std::chrono::milliseconds(read_timeout);
+            request->request_timeout = std::chrono::milliseconds(request_timeout);
+            timed_requests.emplace(request->id, request.get());
+            deadlines.push({get_deadline(*request), request->id});
+            waiting.push_back(std::move(request));
+        }
+        submitted.clear();
+
+        return !stopping;
+    }
+
+    void poll_events() {
+        pollfd fds[2]{};
+        fds[0].fd = wake_fds[0];
+        fds[0].events = POLLIN;
+
+        nfds_t count = 1;
+        if (connection_state != ConnectionState::Closed) {
+            fds[1].fd = fd;
+            fds[1].events = get_poll_events();
+            count = 2;
+        }
+
+        if (poll(fds, count, get_poll_timeout()) < 0) {
+            if (errno != EINTR) {
+                log_error(system_error_message("Event loop failed to poll"));
+            }
+
+            return;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            char buffer[64];
+            while (read(wake_fds[0], buffer, sizeof(buffer)) > 0) {
+            }
+        }
+
+        if (count < 2 || fds[1].revents == 0) {
+            return;
+        } else if (session == nullptr) {
+            try {
+                continue_connecting();
+            } catch (const std::exception& e) {
+                abandon_connection(e.what());
+            }
+        } else if (fds[1].revents & (POLLIN | POLLHUP | POLLERR)) {
+            receive();
+        }
+    }
+
+    short get_poll_events() {
+        switch (connection_state) {
+            case ConnectionState::Connecting:
+                return POLLOUT;
+            case ConnectionState::Handshaking:
+                return handshake_wants_write ? POLLOUT : POLLIN;
+            case ConnectionState::Open:
+                return out_offset < out.size() || nghttp2_session_want_write(session) != 0
+                       ? POLLIN | POLLOUT
+                       : POLLIN;
+            case ConnectionState::Closed:
+            default:
+                return 0;
+        }
+    }
+
+    /// \brief Returns the time to wait for events until the nearest deadline, discarding entries of the deadline heap
+    /// for requests which are no longer waiting for a response.
+    int get_poll_timeout() {
+        while (!deadlines.empty() && timed_requests.find(deadlines.top().id) == timed_requests.end()) {
+            deadlines.pop();
+        }
+
+        std::optional<std::chrono::steady_clock::time_point> nearest;
+        if (!deadlines.empty()) {
+            nearest = deadlines.top().deadline;
+        }
+
+        if (connection_state == ConnectionState::Connecting || connection_state == ConnectionState::Handshaking) {
+            nearest = nearest.has_value() ? std::min(*nearest, connect_deadline) : connect_deadline;
+        }
+
+        if (!nearest.has_value()) {
+            return -1;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (*nearest <= now) {
+            return 0;
+        }
+
+        // Rounds up so that the loop does not wake just before the deadline and wait again
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*nearest - now).count();
+        return static_cast<int>(std::min<std::chrono::milliseconds::rep>(remaining, std::numeric_limits<int>::max()));
+    }
+
+    static std::chrono::steady_clock::time_point get_deadline(const PendingRequest& request) {
+        const auto request_deadline = request.begin + request.request_timeout;
+        if (request.stream_id == 0) {
+            return request_deadline;
+        }
+
+        return std::min(request_deadline, request.last_activity + request.read_timeout);
+    }
+
+    /// \brief Fails the connection attempt and the requests waiting for it if it exceeded the connect timeout, and
+    /// fails the requests which exceeded their read or request timeouts.
+    void expire_requests() {
+        const auto now = std::chrono::steady_clock::now();
+
+        if ((connection_state == ConnectionState::Connecting || connection_state == ConnectionState::Handshaking)
+            && connect_deadline <= now) {
+            abandon_connection("Timed out connecting to '" + authority + "'");
+        }
+
+        while (!deadlines.empty() && deadlines.top().deadline <= now) {
+            const std::uint64_t id = deadlines.top().id;
+            deadlines.pop();
+
+            auto iter = timed_requests.find(id);
+            if (iter == timed_requests.end()) {
+                continue;
+            }
+
+            PendingRequest* request = iter->second;
+            const auto deadline = get_deadline(*request);
+            if (deadline > now) {
+                // The stream received or sent data since the entry was queued
+                deadlines.push({deadline, id});
+            } else if (request->begin + request->request_timeout <= now) {
+                expire_request(request, "HTTP/2 request timed out");
+            } else {
+                expire_request(request, "Timed out waiting for HTTP/2 response");
+            }
+        }
+    }
+
+    void expire_request(PendingRequest* request, const std::string& message) {
+        if (request->stream_id == 0) {
+            auto iter = std::find_if(waiting.begin(),
+                                     waiting.end(),
+                                     [request](const std::unique_ptr<PendingRequest>& waiting_request) {
+                                         return waiting_request.get() == request;
+                                     });
+            std::unique_ptr<PendingRequest> owned = std::move(*iter);
+            waiting.erase(iter);
+            fail_request(std::move(owned), message);
+            return;
+        }
+
+        // The request is kept by its stream until the stream is closed, as the session may still read its body
+        reject(*request, message);
+        request->expired = true;
+        nghttp2_submit_rst_stream(session, NGHTTP2_FLAG_NONE, request->stream_id, NGHTTP2_CANCEL);
+    }
+
+    void receive() {
+        uint8_t buffer[ReadBufferSize];
+
+        while (session != nullptr) {
+            std::size_t length = 0;
+            switch (read_some(buffer, sizeof(buffer), length)) {
+                case IoResult::Done:
+                    break;
+                case IoResult::WouldBlock:
+                    return;
+                case IoResult::Closed:
+                    close_session("HTTP/2 connection was closed by the server");
+                    return;
+                case IoResult::Error:
+                default:
+                    close_session("Unable to read from the HTTP/2 connection");
+                    return;
+            }
+
+            const ssize_t result = nghttp2_session_mem_recv(session, buffer, length);
+            if (result < 0) {
+                close_session("HTTP/2 protocol error: " + std::string(nghttp2_strerror(static_cast<int>(result))));
+                return;
+            }
+        }
+    }
+
+    /// \brief Writes the frames queued by the session to the transport.
+    /// \return False if the transport failed.
+    bool flush() {
+        while (true) {
+            if (out_offset == out.size()) {
+                out.clear();
+                out_offset = 0;
+
+                const uint8_t* data = nullptr;
+                const ssize_t length = nghttp2_session_mem_send(session, &data);
+                if (length < 0) {
+                    return false;
+                } else if (length == 0) {
+                    return true;
+                }
+
+                out.assign(reinterpret_cast<const char*>(data), static_cast<std::size_t>(length));
+            }
+
+            std::size_t written = 0;
+            switch (write_some(out.data() + out_offset, out.size() - out_offset, written)) {
+                case IoResult::Done:
+                    out_offset += written;
+                    break;
+                case IoResult::WouldBlock:
+                    return true;
+                case IoResult::Closed:
+                case IoResult::Error:
+                default:
+                    return false;
+            }
+        }
+    }
+
+    void submit_waiting() {
+        while (!waiting.empty() && !session_exhausted) {
+            PendingRequest* request = waiting.front().get();
+
+            std::vector<nghttp2_nv> nva;
+            nva.reserve(request->headers.size());
+            for (auto& [name, value]: request->headers) {
+                nva.push_back(make_nv(name, value));
+            }
+
+            nghttp2_data_provider data_provider{};
+            data_provider.source.ptr = request;
+            data_provider.read_callback = read_body_callback;
+
+            const int32_t stream_id = nghttp2_submit_request(session,
+                                                             nullptr,
+                                                             nva.data(),
+                                                             nva.size(),
+                                                             &data_provider,
+                                                             request);
+            if (stream_id == NGHTTP2_ERR_STREAM_ID_NOT_AVAILABLE) {
+                session_exhausted = true;
+            } else if (stream_id < 0) {
+                fail_request(pop_waiting(), "Unable to submit HTTP/2 request: " + std::string(nghttp2_strerror(stream_id)));
+            } else {
+                // The read timeout may make the deadline of the stream earlier than that of the waiting request
+                request->stream_id = stream_id;
+                request->last_activity = std::chrono::steady_clock::now();
+                deadlines.push({get_deadline(*request), request->id});
+                streams.emplace(stream_id, pop_waiting());
+            }
+        }
+    }
+
+    std::unique_ptr<PendingRequest> pop_waiting() {
+        std::unique_ptr<PendingRequest> request = std::move(waiting.front());
+        waiting.pop_front();
+        return request;
+    }
+
+    /// \brief Resolves the host and starts connecting to it without blocking. The connection is driven by
+    /// continue_connecting() once the socket becomes ready.
+    void open_connection() {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo* resolved = nullptr;
+        const int error = getaddrinfo(host.c_str(), port.c_str(), &hints, &resolved);
+        if (error != 0 || resolved == nullptr) {
+            throw std::runtime_error("Unable to resolve host '" + host + "': " + gai_strerror(error));
+        }
+
+        addresses.clear();
+        for (addrinfo* address = resolved; address != nullptr; address = address->ai_next) {
+            sockaddr_storage storage{};
+            std::memcpy(&storage, address->ai_addr, address->ai_addrlen);
+            addresses.emplace_back(storage, address->ai_addrlen);
+        }
+
+        freeaddrinfo(resolved);
+
+        next_address = 0;
+        connect_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(connect_timeout);
+        connect_next_address();
+    }
+
+    void connect_next_address() {
+        while (next_address < addresses.size()) {
+            const auto& [address, length] = addresses[next_address++];
+
+            fd = socket(address.ss_family, SOCK_STREAM, 0);
+            if (fd < 0) {
+                continue;
+            }
+
+            set_non_blocking(fd);
+            if (connect(fd, reinterpret_cast<const sockaddr*>(&address), length) == 0 || errno == EINPROGRESS) {
+                connection_state = ConnectionState::Connecting;
+                return;
+            }
+
+            close(fd);
+            fd = -1;
+        }
+
+        throw std::runtime_error("Unable to connect to '" + authority + "'");
+    }
+
+    void continue_connecting() {
+        if (connection_state == ConnectionState::Connecting) {
+            int error = 0;
+            socklen_t length = sizeof(error);
+            getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length);
+            if (error != 0) {
+                close(fd);
+                fd = -1;
+                connection_state = ConnectionState::Closed;
+                connect_next_address();
+                return;
+            } else if (!tls) {
+                open_session();
+                return;
+            }
+
+            start_tls();
+            connection_state = ConnectionState::Handshaking;
+        }
+
+        ERR_clear_error();
+        const int result = SSL_connect(ssl);
+        if (result != 1) {
+            switch (SSL_get_error(ssl, result)) {
+                case SSL_ERROR_WANT_READ:
+                    handshake_wants_write = false;
+                    return;
+                case SSL_ERROR_WANT_WRITE:
+                    handshake_wants_write = true;
+                    return;
+                default:
+                    break;
+            }
+
+            const long verify_result = SSL_get_verify_result(ssl);
+            throw std::runtime_error("TLS handshake with '" + authority + "' failed"
+                                     + (verify_result == X509_V_OK
+                                        ? std::string()
+                                        : ": " + std::string(X509_verify_cert_error_string(verify_result))));
+        }
+
+        const unsigned char* protocol = nullptr;
+        unsigned int protocol_length = 0;
+        SSL_get0_alpn_selected(ssl, &protocol, &protocol_length);
+        if (protocol_length != 2 || std::memcmp(protocol, "h2", 2) != 0) {
+            throw std::runtime_error("Server at '" + authority + "' did not negotiate HTTP/2");
+        }
+
+        open_session();
+    }
+
+    void start_tls() {
+        static const unsigned char alpn[] = {2, 'h', '2'};
+
+        if (ssl_ctx == nullptr) {
+            ssl_ctx = SSL_CTX_new(TLS_client_method());
+            if (ssl_ctx == nullptr) {
+                throw std::runtime_error("Unable to create TLS context");
+            }
+
+            SSL_CTX_set_min_proto_version(ssl_ctx, TLS1_2_VERSION);
+            SSL_CTX_set_default_verify_paths(ssl_ctx);
+            SSL_CTX_set_verify(ssl_ctx, SSL_VERIFY_PEER, nullptr);
+            SSL_CTX_set_alpn_protos(ssl_ctx, alpn, sizeof(alpn));
+        }
+
+        ssl = SSL_new(ssl_ctx);
+        if (ssl == nullptr) {
+            throw std::runtime_error("Unable to create TLS connection");
+        }
+
+        SSL_set_mode(ssl, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+        SSL_set_tlsext_host_name(ssl, host.c_str());
+        SSL_set1_host(ssl, host.c_str());
+        SSL_set_fd(ssl, fd);
+        handshake_wants_write = true;
+    }
+
+    void open_session() {
+        nghttp2_session_callbacks* callbacks;
+        nghttp2_session_callbacks_new(&callbacks);
+        nghttp2_session_callbacks_set_on_header_callback(callbacks, on_header_callback);
+        nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks, on_data_chunk_recv_callback);
+        nghttp2_session_callbacks_set_on_stream_close_callback(callbacks, on_stream_close_callback);
+        const int result = nghttp2_session_client_new(&session, callbacks, this);
+        nghttp2_session_callbacks_del(callbacks);
+
+        if (result != 0) {
+            session = nullptr;
+            throw std::runtime_error("Unable to create HTTP/2 session: " + std::string(nghttp2_strerror(result)));
+        }
+
+        const nghttp2_settings_entry settings[] = {
+                {NGHTTP2_SETTINGS_ENABLE_PUSH,         0},
+                {NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, StreamWindowSize},
+        };
+        nghttp2_submit_settings(session, NGHTTP2_FLAG_NONE, settings, std::size(settings));
+        nghttp2_session_set_local_window_size(session, NGHTTP2_FLAG_NONE, 0, ConnectionWindowSize);
+
+        connection_state = ConnectionState::Open;
+        session_exhausted = false;
+        connection_count++;
+    }
+
+    /// \brief Closes the connection, failing the requests sent over it and those waiting for it.
+    /// \param message The message of the failure.
+    void abandon_connection(const std::string& message) {
+        close_session(message);
+        while (!waiting.empty()) {
+            fail_request(pop_waiting(), message);
+        }
+    }
+
+    void close_session(const std::string& message = "") {
+        if (session != nullptr) {
+            nghttp2_session_del(session);
+            session = nullptr;
+        }
+
+        if (ssl != nullptr) {
+            SSL_free(ssl);
+            ssl = nullptr;
+        }
+
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+
+        connection_state = ConnectionState::Closed;
+        out.clear();
+        out_offset = 0;
+
+        for (auto& [stream_id, request]: streams) {
+            if (!request->expired) {
+                fail_request(std::move(request), message);
+            }
+        }
+        streams.clear();
+    }
+
+    IoResult read_some(uint8_t* buffer, std::size_t size, std::size_t& length) {
+        if (ssl != nullptr) {
+            ERR_clear_error();
+            const int result = SSL_read(ssl, buffer, static_cast<int>(size));
+            if (result > 0) {
+                length = static_cast<std::size_t>(result);
+                return IoResult::Done;
+            }
+
+            return ssl_io_result(result);
+        }
+
+        const ssize_t result = recv(fd, buffer, size, 0);
+        if (result > 0) {
+            length = static_cast<std::size_t>(result);
+            return IoResult::Done;
+        } else if (result == 0) {
+            return IoResult::Closed;
+        }
+
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? IoResult::WouldBlock : IoResult::Error;
+    }
+
+    IoResult write_some(const char* data, std::size_t size, std::size_t& written) {
+        if (ssl != nullptr) {
+            ERR_clear_error();
+            const int result = SSL_write(ssl, data, static_cast<int>(size));
+            if (result > 0) {
+                written = static_cast<std::size_t>(result);
+                return IoResult::Done;
+            }
+
+            return ssl_io_result(result);
+        }
+
+        const ssize_t result = send(fd, data, size, MSG_NOSIGNAL);
+        if (result >= 0) {
+            written = static_cast<std::size_t>(result);
+            return IoResult::Done;
+        }
+
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? IoResult::WouldBlock : IoResult::Error;
+    }
+
+    IoResult ssl_io_result(int result) {
+        switch (SSL_get_error(ssl, result)) {
+            case SSL_ERROR_WANT_READ:
+            case SSL_ERROR_WANT_WRITE:
+                return IoResult::WouldBlock;
+            case SSL_ERROR_ZERO_RETURN:
+                return IoResult::Closed;
+            default:
+                return IoResult::Error;
+        }
+    }
+
+    void complete_request(std::unique_ptr<PendingRequest> request) {
+        auto builder = HttpResponse::builder();
+        for (auto& [key, value]: request->response_headers) {
+            builder.add_header(key, value);
+        }
+
+        HttpResponse response = builder.code(request->status)
+                                       .body(std::move(request->response_body))
+                                       .build();
+
+        const auto rtt = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()
+                                                                               - request->begin);
+        log_response(request->path, response, rtt);
+
+        timed_requests.erase(request->id);
+        in_flight_count--;
+        request->promise.set_value(std::move(response));
+    }
+
+    void fail_request(std::unique_ptr<PendingRequest> request, const std::string& message) {
+        reject(*request, message);
+    }
+
+    void reject(PendingRequest& request, const std::string& message) {
+        log_error(message);
+        timed_requests.erase(request.id);
+        in_flight_count--;
+        request.promise.set_exception(std::make_exception_ptr(std::runtime_error(message)));
+    }
+
+    // Expects the state mutex to be held by the caller so that the descriptor is not closed concurrently
+    void wake() {
+        const char value = 1;
+        [[maybe_unused]] const ssize_t result = write(wake_fds[1], &value, 1);
+    }
+
+    std::vector<std::pair<std::string, std::string>> create_headers(const HttpRequest& request) {
+        std::vector<std::pair<std::string, std::string>> headers{
+                {":method",    EnumUtils::serialize_http_method(request.get_method().value())},
+                {":scheme",    tls ? "https" : "http"},
+                {":authority", authority},
+                {":path",      base_path + request.get_path_query_fragment().value()},
+        };
+
+        std::map<std::string, std::string> merged;
+
+        std::unique_lock<std::mutex> default_headers_lock(default_headers_mutex);
+        for (const auto& [key, value]: default_headers) {
+            merged.emplace(to_lower(key), value);
+        }
+        default_headers_lock.unlock();
+
+        for (const auto& [key, value]: request.get_headers()) {
+            merged[to_lower(key)] = value;
+        }
+
+        for (auto& [key, value]: merged) {
+            // Connection-specific headers are not allowed in HTTP/2
+            if (key == "connection" || key == "host" || key == "keep-alive" || key == "transfer-encoding") {
+                continue;
+            }
+
+            headers.emplace_back(key, std::move(value));
+        }
+
+        headers.emplace_back("content-length", std::to_string(request.get_body().value().size()));
+        return headers;
+    }
+
+    void parse_base_uri() {
+        static const std::string http_scheme("http://");
+        static const std::string https_scheme("https://");
+
+        std::size_t authority_start;
+        if (base_uri.compare(0, https_scheme.size(), https_scheme) == 0) {
+            tls = true;
+            authority_start = https_scheme.size();
+        } else if (base_uri.compare(0, http_scheme.size(), http_scheme) == 0) {
+            authority_start = http_scheme.size();
+        } else {
+            throw std::runtime_error("Base URI for Http2Client must use either the 'http' or 'https' scheme");
+        }
+
+        const std::size_t path_start = base_uri.find('/', authority_start);
+        authority = base_uri.substr(authority_start, path_start - authority_start);
+        base_path = path_start == std::string::npos ? "" : base_uri.substr(path_start);
+        if (!base_path.empty() && base_path.back() == '/') {
+            base_path.pop_back();
+        }
+
+        const std::size_t colon = authority.rfind(':');
+        if (colon == std::string::npos || authority.find(']', colon) != std::string::npos) {
+            host = authority;
+            port = tls ? "443" : "80";
+        } else {
+            host = authority.substr(0, colon);
+            port = authority.substr(colon + 1);
+        }
+
+        if (host.size() > 1 && host.front() == '[' && host.back() == ']') {
+            host = host.substr(1, host.size() - 2);
+        }
+
+        if (host.empty() || port.empty()) {
+            throw std::runtime_error("Base URI for Http2Client is malformed");
+        }
+    }
+
+    void log_error(const std::string& message) {
+        std::lock_guard<std::mutex> guard(logging_mutex);
+        if (logger_provider != nullptr) {
+            logger_provider->log(LogLevel::Error, message);
+        }
+    }
+
+    void log_request(const HttpRequest& request) {
+        std::lock_guard<std::mutex> guard(logging_mutex);
+        if (log_level == HttpLogLevel::None || logger_provider == nullptr) {
+            return;
+        }
+
+        std::stringstream ss;
+
+        const auto method = EnumUtils::serialize_http_method(request.get_method().value());
+        const auto uri = base_uri + request.get_path_query_fragment().value();
+        const auto content_length = request.get_body().value().size();
+
+        // Line
+        if (log_level == HttpLogLevel::Basic) {
+            ss << "--> " << method << " " << uri << " (" << content_length << "-byte body)\n";
+            logger_provider->log(ss.str());
+            return;
+        }
+
+        ss << "--> " << method << " " << uri << "\n";
+
+        // Headers
+        for (const auto& [k, v]: request.get_headers()) {
+            ss << k << ": " << v << "\n";
+        }
+
+        if (log_level == HttpLogLevel::Headers) {
+            ss << "<-- END " << method << "\n";
+            logger_provider->log(ss.str());
+            return;
+        }
+
+        // Body
+        ss << "\n" // Line break between headers and body
+           << request.get_body().value() << "\n"
+           << "<-- END " << method << " (" << content_length << "-byte body)\n";
+        logger_provider->log(ss.str());
+    }
+
+    void log_response(const std::string& path, const HttpResponse& response, std::chrono::milliseconds rtt) {
+        std::lock_guard<std::mutex> guard(logging_mutex);
+        if (log_level == HttpLogLevel::None || logger_provider == nullptr) {
+            return;
+        }
+
+        std::stringstream ss;
+
+        // Line
+        ss << "<-- " << response.get_code().value() << " " << base_uri << path << " (" << rtt.count() << "ms)\n";
+
+        if (log_level == HttpLogLevel::Basic) {
+            logger_provider->log(ss.str());
+            return;
+        }
+
+        // Headers
+        for (const auto& [k, v]: response.get_headers()) {
+            ss << k << ": " << v << "\n";
+        }
+
+        if (log_level == HttpLogLevel::Headers) {
+            ss << "<-- END HTTP\n";
+            logger_provider->log(ss.str());
+            return;
+        }
+
+        // Body
+        ss << "\n"
+           << response.get_body().value_or("") << "\n"
+           << "<-- END HTTP\n";
+        logger_provider->log(ss.str());
+    }
+
+    void validate_request_body(const HttpRequest& req) {
+        if (req.get_body().has_value()) {
+            return;
+        }
+
+        const std::string message("Request does not have a body");
+        log_error(message);
+        throw std::runtime_error(message);
+    }
+
+    void validate_request_content_type(const HttpRequest& req) {
+        if (req.get_content_type().has_value()) {
+            return;
+        }
+
+        const std::string message("Request does not have a content-type header");
+        log_error(message);
+        throw std::runtime_error(message);
+    }
+
+    void validate_request_method(const HttpRequest& req) {
+        if (req.get_method().has_value() && req.get_method().value() == HttpMethod::Post) {
+            return;
+        }
+
+        const std::string message("HTTP method for request is not 'POST'");
+        log_error(message);
+        throw std::runtime_error(message);
+    }
+
+    void validate_request_path_query_fragment(const HttpRequest& req) {
+        if (req.get_path_query_fragment().has_value()) {
+            return;
+        }
+
+        const std::string message("Request does not have a path query fragment");
+        log_error(message);
+        throw std::runtime_error(message);
+    }
+
+    static nghttp2_nv make_nv(const std::string& name, const std::string& value) {
+        return {
+                reinterpret_cast<uint8_t*>(const_cast<char*>(name.data())),
+                reinterpret_cast<uint8_t*>(const_cast<char*>(value.data())),
+                name.size(),
+                value.size(),
+                NGHTTP2_NV_FLAG_NONE,
+        };
+    }
+
+    static void set_non_blocking(int descriptor) {
+        fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL, 0) | O_NONBLOCK);
+    }
+
+    static std::string system_error_message(const std::string& message) {
+        return message + ": " + std::strerror(errno);
+    }
+
+    static ssize_t read_body_callback(nghttp2_session*,
+                                      int32_t,
+                                      uint8_t* buf,
+                                      size_t length,
+                                      uint32_t* data_flags,
+                                      nghttp2_data_source* source,
+                                      void*) {
+        auto* request = static_cast<PendingRequest*>(source->ptr);
+        request->last_activity = std::chrono::steady_clock::now();
+
+        const std::size_t remaining = request->body.size() - request->body_offset;
+        const std::size_t count = std::min(length, remaining);
+        std::memcpy(buf, request->body.data() + request->body_offset, count);
+        request->body_offset += count;
+
+        if (request->body_offset == request->body.size()) {
+            *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+        }
+
+        return static_cast<ssize_t>(count);
+    }
+
+    static int on_header_callback(nghttp2_session* session,
+                                  const nghttp2_frame* frame,
+                                  const uint8_t* name,
+                                  size_t name_length,
+                                  const uint8_t* value,
+                                  size_t value_length,
+                                  uint8_t,
+                                  void*) {
+        if (frame->hd.type != NGHTTP2_HEADERS) {
+            return 0;
+        }
+
+        auto* request = static_cast<PendingRequest*>(nghttp2_session_get_stream_user_data(session,
+                                                                                          frame->hd.stream_id));
+        if (request == nullptr) {
+            return 0;
+        }
+
+        request->last_activity = std::chrono::steady_clock::now();
+
+        const std::string header_name(reinterpret_cast<const char*>(name), name_length);
+        const std::string header_value(reinterpret_cast<const char*>(value), value_length);
+        if (header_name == ":status") {
+            request->status = static_cast<unsigned short>(std::stoi(header_value));
+        } else {
+            request->response_headers.emplace(header_name, header_value);
+        }
+
+        return 0;
+    }
+
+    static int on_data_chunk_recv_callback(nghttp2_session* session,
+                                           uint8_t,
+                                           int32_t stream_id,
+                                           const uint8_t* data,
+                                           size_t length,
+                                           void*) {
+        auto* request = static_cast<PendingRequest*>(nghttp2_session_get_stream_user_data(session, stream_id));
+        if (request != nullptr) {
+            request->last_activity = std::chrono::steady_clock::now();
+            request->response_body.append(reinterpret_cast<const char*>(data), length);
+        }
+
+        return 0;
+    }
+
+    static int on_stream_close_callback(nghttp2_session*, int32_t stream_id, uint32_t error_code, void* user_data) {
+        auto* impl = static_cast<Impl*>(user_data);
+
+        auto iter = impl->streams.find(stream_id);
+        if (iter == impl->streams.end()) {
+            return 0;
+        }
+
+        std::unique_ptr<PendingRequest> request = std::move(iter->second);
+        impl->streams.erase(iter);
+
+        if (request->expired) {
+            // The request already failed when its stream was reset
+            return 0;
+        } else if (error_code == NGHTTP2_NO_ERROR) {
+            impl->complete_request(std::move(request));
+        } else if (error_code == NGHTTP2_REFUSED_STREAM) {
+            // The server did not process the stream, so it is safe to send it again
+            request->stream_id = 0;
+            request->body_offset = 0;
+            request->status = 0;
+            request->response_headers.clear();
+            request->response_body.clear();
+            impl->waiting.push_front(std::move(request));
+        } else {
+            impl->fail_request(std::move(request),
+                               "HTTP/2 stream was reset: " + std::string(nghttp2_http2_strerror(error_code)));
+        }
+
+        return 0;
+    }
+};
+
+Http2Client::Http2Client(std::string base_uri) : pimpl(std::make_unique<Impl>(std::move(base_uri))) {
+}
+
+Http2Client::~Http2Client() = default;
+
+void Http2Client::start() {
+    pimpl->start();
+}
+
+void Http2Client::stop() {
+    pimpl->stop();
+}
+
+std::future<HttpResponse> Http2Client::send_request(HttpRequest request) {
+    return pimpl->send_request(std::move(request));
+}
+
+const std::string& Http2Client::get_base_uri() const {
+    return pimpl->get_base_uri();
+}
+
+std::size_t Http2Client::get_connection_count() const {
+    return pimpl->get_connection_count();
+}
+
+std::size_t Http2Client::get_in_flight_count() const {
+    return pimpl->get_in_flight_count();
+}
+
+bool Http2Client::is_open() const {
+    return pimpl->is_open();
+}
+
+void Http2Client::set_default_request_header(std::string key, std::string value) {
+    pimpl->set_default_request_header(std::move(key), std::move(value));
+}
+
+void Http2Client::set_logger(HttpLogLevel level, std::shared_ptr<LoggerProvider> logger_provider) {
+    pimpl->set_logger(level, std::move(logger_provider));
+}
+
+void Http2Client::set_timeouts(std::chrono::milliseconds connect_timeout,
+                               std::chrono::milliseconds read_timeout,
+                               std::chrono::milliseconds request_timeout) {
+    pimpl->set_timeouts(connect_timeout, read_timeout, request_timeout);
+}
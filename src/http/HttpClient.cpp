@@ -17,16 +17,24 @@
 
 #include "HttpClient.hpp"
 
+#include "CompressionUtils.hpp"
 #include "httplib.h"
 #include "enjinsdk/EnumUtils.hpp"
+#include "enjinsdk/HttpHeaders.hpp"
 #include "enjinsdk_utils/StringUtils.hpp"
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <iterator>
 #include <map>
 #include <mutex>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 using namespace enjin::sdk::http;
 using namespace enjin::sdk::utils;
@@ -36,7 +44,10 @@ class HttpClient::Impl : public IHttpClient {
 public:
     Impl() = delete;
 
-    explicit Impl(std::string base_uri) : base_uri(std::move(base_uri)) {
+    Impl(std::string base_uri, std::size_t max_connections, std::chrono::milliseconds idle_timeout)
+            : base_uri(std::move(base_uri)),
+              max_connections(std::max<std::size_t>(max_connections, 1)),
+              idle_timeout(idle_timeout) {
     }
 
     ~Impl() override {
@@ -44,58 +55,68 @@ public:
     }
 
     void start() override {
-        if (is_open()) {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        if (open) {
             return;
         }
 
-        http_client = std::make_unique<httplib::Client>(base_uri.c_str());
-        http_client->set_follow_location(true);
-        http_client->set_keep_alive(true);
         open = true;
+        const std::size_t count = std::min(prewarmed_connections, max_connections);
+        if (count > 0) {
+            prewarming = std::async(std::launch::async, [this, count]() {
+                prewarm_connections(count);
+            });
+        }
     }
 
     void stop() override {
-        if (!is_open()) {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        if (!open) {
             return;
         }
 
-        http_client->stop();
         open = false;
-    }
-
-    std::future<HttpResponse> send_request(HttpRequest request) override {
-        return std::async([this, request] {
-            validate_request_method(request);
-            validate_request_path_query_fragment(request);
-            validate_request_content_type(request);
-            validate_request_body(request);
-
-            auto req = httplib::Request();
-            req.path = request.get_path_query_fragment().value();
-            req.method = EnumUtils::serialize_http_method(request.get_method().value());
-            req.headers = create_headers(request);
-            req.body = request.get_body().value();
+        evicted_connections += idle_connections.size();
+        idle_connections.clear();
 
-            log_request(req);
+        // Aborts the requests in-flight, their connections are discarded when checked back in
+        for (httplib::Client* connection: active_connections) {
+            connection->stop();
+        }
+        std::future<void> prewarmed = std::move(prewarming);
+        lock.unlock();
 
-            const auto begin = std::chrono::high_resolution_clock::now();
-            auto res = http_client->send(req);
-            const auto end = std::chrono::high_resolution_clock::now();
+        pool_cv.notify_all();
 
-            log_result(req, res, std::chrono::duration_cast<std::chrono::milliseconds>(end - begin));
+        // Waits for the connections being pre-warmed to be discarded, as they refer to this client
+        if (prewarmed.valid()) {
+            prewarmed.wait();
+        }
+    }
 
-            if (!res) {
-                throw std::runtime_error(error_result_2_string(res));
+    std::future<HttpResponse> send_request(HttpRequest request) override {
+        std::unique_lock<std::mutex> lock(executor_mutex);
+        std::shared_ptr<utils::IExecutor> current_executor = executor;
+        lock.unlock();
+
+        if (current_executor == nullptr) {
+            return std::async([this, request = std::move(request)]() mutable {
+                return send(std::move(request));
+            });
+        } else if (current_executor->is_worker_thread()) {
+            // Sends on the calling worker to avoid parking it on a task queued behind it
+            std::promise<HttpResponse> promise;
+            try {
+                promise.set_value(send(std::move(request)));
+            } catch (...) {
+                promise.set_exception(std::current_exception());
             }
 
-            auto builder = HttpResponse::builder();
-            for (auto& [key, value]: res->headers) {
-                builder.add_header(key, value);
-            }
+            return promise.get_future();
+        }
 
-            return builder.code(res->status)
-                          .body(res->body)
-                          .build();
+        return current_executor->submit([this, request = std::move(request)]() mutable {
+            return send(std::move(request));
         });
     }
 
@@ -103,7 +124,26 @@ public:
         return base_uri;
     }
 
+    [[nodiscard]] std::optional<CompressionStats> get_compression_stats() const override {
+        std::lock_guard<std::mutex> guard(compression_mutex);
+        return compression_stats;
+    }
+
+    [[nodiscard]] std::optional<ConnectionPoolStats> get_connection_pool_stats() const override {
+        std::lock_guard<std::mutex> guard(pool_mutex);
+
+        ConnectionPoolStats stats;
+        stats.max_connections = max_connections;
+        stats.active_connections = active_connections.size();
+        stats.idle_connections = idle_connections.size();
+        stats.waiting_requests = waiting_requests;
+        stats.created_connections = created_connections;
+        stats.evicted_connections = evicted_connections;
+        return stats;
+    }
+
     [[nodiscard]] bool is_open() const override {
+        std::lock_guard<std::mutex> guard(pool_mutex);
         return open;
     }
 
@@ -112,25 +152,421 @@ public:
         default_headers.emplace(std::move(key), std::move(value));
     }
 
+    void set_executor(std::shared_ptr<utils::IExecutor> executor) {
+        std::lock_guard<std::mutex> guard(executor_mutex);
+        Impl::executor = std::move(executor);
+    }
+
     void set_logger(HttpLogLevel level, std::shared_ptr<utils::LoggerProvider> logger_provider) override {
         std::lock_guard<std::mutex> guard(logging_mutex);
         log_level = level;
         Impl::logger_provider = std::move(logger_provider);
     }
 
+    void set_prewarmed_connections(std::size_t count) {
+        std::lock_guard<std::mutex> guard(pool_mutex);
+        prewarmed_connections = count;
+    }
+
+    void set_request_compression(bool enabled, std::size_t threshold) {
+        std::lock_guard<std::mutex> guard(compression_mutex);
+        compress_requests = enabled;
+        compression_threshold = threshold;
+    }
+
 private:
+    /// \brief Keep-alive connection resting in the pool.
+    struct IdleConnection {
+        std::unique_ptr<httplib::Client> client;
+        std::chrono::steady_clock::time_point last_used;
+    };
+
+    /// \brief Returns a checked out connection to the pool once it goes out of scope.
+    class ConnectionLease {
+    public:
+        ConnectionLease(Impl& owner, std::unique_ptr<httplib::Client> client)
+                : owner(owner),
+                  client(std::move(client)) {
+        }
+
+        ConnectionLease(const ConnectionLease&) = delete;
+
+        ~ConnectionLease() {
+            owner.checkin(std::move(client), reusable);
+        }
+
+        httplib::Client& operator*() const {
+            return *client;
+        }
+
+        httplib::Client* operator->() const {
+            return client.get();
+        }
+
+        /// \brief Marks the connection as broken so that it is discarded rather than reused.
+        void discard() {
+            reusable = false;
+        }
+
+        ConnectionLease& operator=(const ConnectionLease&) = delete;
+
+    private:
+        Impl& owner;
+        std::unique_ptr<httplib::Client> client;
+        bool reusable = true;
+    };
+
+    /// \brief Holds the TLS sessions negotiated with the host so that new connections resume them with an abbreviated
+    /// handshake.
+    /// \remarks A TLS 1.3 session is handed to one connection only, as OpenSSL treats its ticket as single use, while a
+    /// TLS 1.2 session is shared by every connection.
+    class TlsSessionCache {
+    public:
+        TlsSessionCache() = default;
+
+        TlsSessionCache(const TlsSessionCache&) = delete;
+
+        ~TlsSessionCache() {
+            for (SSL_SESSION* session: sessions) {
+                SSL_SESSION_free(session);
+            }
+        }
+
+        /// \brief Installs the cache on the SSL context of a connection.
+        void attach(SSL_CTX* ctx) {
+            SSL_CTX_set_ex_data(ctx, ex_data_index(), this);
+            SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+            SSL_CTX_sess_set_new_cb(ctx, on_new_session);
+            SSL_CTX_set_info_callback(ctx, on_info);
+        }
+
+        TlsSessionCache& operator=(const TlsSessionCache&) = delete;
+
+    private:
+        std::mutex mutex;
+        std::deque<SSL_SESSION*> sessions; // The most recent session is at the back
+
+        /// \brief The maximum number of sessions held, which is enough for the tickets a server usually issues to a
+        /// few connections.
+        static constexpr std::size_t MaxSessions = 8;
+
+        /// \brief Takes the most recent resumable session.
+        /// \return The session, which the caller must free, or null if there is none.
+        SSL_SESSION* take() {
+            std::lock_guard<std::mutex> guard(mutex);
+            while (!sessions.empty()) {
+                SSL_SESSION* session = sessions.back();
+                if (SSL_SESSION_is_resumable(session) && SSL_SESSION_get_protocol_version(session) < TLS1_3_VERSION) {
+                    SSL_SESSION_up_ref(session);
+                    return session;
+                }
+
+                sessions.pop_back();
+                if (SSL_SESSION_is_resumable(session)) {
+                    return session;
+                }
+
+                SSL_SESSION_free(session);
+            }
+
+            return nullptr;
+        }
+
+        static TlsSessionCache* from(const SSL* ssl) {
+            return static_cast<TlsSessionCache*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), ex_data_index()));
+        }
+
+        // Takes ownership of the session, so returns 1 as expected by OpenSSL
+        static int on_new_session(SSL* ssl, SSL_SESSION* new_session) {
+            TlsSessionCache* cache = from(ssl);
+            if (cache == nullptr) {
+                return 0;
+            }
+
+            std::lock_guard<std::mutex> guard(cache->mutex);
+            cache->sessions.push_back(new_session);
+            if (cache->sessions.size() > MaxSessions) {
+                SSL_SESSION_free(cache->sessions.front());
+                cache->sessions.pop_front();
+            }
+
+            return 1;
+        }
+
+        // Offers a cached session before the client hello is written. The client of cpp-httplib creates the SSL object
+        // and starts the handshake in one step, without a hook in between, so the start of the first handshake of a
+        // connection is the earliest point at which the session can be set. OpenSSL only passes the connection as
+        // const to this callback. Renegotiations are left alone, as setting a session then would replace the one in
+        // use.
+        static void on_info(const SSL* ssl, int where, int) {
+            if ((where & SSL_CB_HANDSHAKE_START) == 0 || SSL_is_server(ssl) || !SSL_in_before(ssl)) {
+                return;
+            }
+
+            TlsSessionCache* cache = from(ssl);
+            if (cache == nullptr) {
+                return;
+            }
+
+            SSL_SESSION* session = cache->take();
+            if (session != nullptr) {
+                SSL_set_session(const_cast<SSL*>(ssl), session);
+                SSL_SESSION_free(session);
+            }
+        }
+
+        static int ex_data_index() {
+            static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+            return index;
+        }
+    };
+
     const std::string base_uri;
+    const std::size_t max_connections;
+    const std::chrono::milliseconds idle_timeout;
 
     bool open = false;
     std::map<std::string, std::string> default_headers;
     HttpLogLevel log_level = HttpLogLevel::None;
 
-    std::unique_ptr<httplib::Client> http_client;
+    // Declared before the pool as the connections refer to it
+    TlsSessionCache tls_session_cache;
+
+    // Connection pool, the most recently used idle connection is at the back
+    std::vector<IdleConnection> idle_connections;
+    std::set<httplib::Client*> active_connections;
+    std::size_t waiting_requests = 0;
+    std::size_t created_connections = 0;
+    std::size_t evicted_connections = 0;
+    std::size_t prewarmed_connections = 0;
+    std::future<void> prewarming;
+    std::condition_variable pool_cv;
+
+    // Compression
+    bool compress_requests = false;
+    std::size_t compression_threshold = DefaultCompressionThreshold;
+    CompressionStats compression_stats;
+
+    std::shared_ptr<utils::IExecutor> executor;
     std::shared_ptr<utils::LoggerProvider> logger_provider;
 
     // Mutexes
+    mutable std::mutex compression_mutex;
     mutable std::mutex default_headers_mutex;
+    mutable std::mutex executor_mutex;
     mutable std::mutex logging_mutex;
+    mutable std::mutex pool_mutex;
+
+    ConnectionLease checkout() {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        evict_idle_connections(std::chrono::steady_clock::now());
+
+        waiting_requests++;
+        pool_cv.wait(lock, [this]() {
+            return !open || !idle_connections.empty() || active_connections.size() < max_connections;
+        });
+        waiting_requests--;
+
+        if (!open) {
+            throw std::runtime_error("HTTP client is not open");
+        }
+
+        std::unique_ptr<httplib::Client> client;
+        if (idle_connections.empty()) {
+            client = create_connection();
+            created_connections++;
+        } else {
+            client = std::move(idle_connections.back().client);
+            idle_connections.pop_back();
+        }
+
+        active_connections.insert(client.get());
+        return {*this, std::move(client)};
+    }
+
+    void checkin(std::unique_ptr<httplib::Client> client, bool reusable) {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        active_connections.erase(client.get());
+
+        const auto now = std::chrono::steady_clock::now();
+        if (open && reusable) {
+            idle_connections.push_back({std::move(client), now});
+        } else {
+            evicted_connections++;
+        }
+
+        evict_idle_connections(now);
+        lock.unlock();
+
+        pool_cv.notify_one();
+    }
+
+    // Expects the pool mutex to be held by the caller
+    void evict_idle_connections(std::chrono::steady_clock::time_point now) {
+        auto expired_end = std::find_if(idle_connections.begin(),
+                                        idle_connections.end(),
+                                        [this, now](const IdleConnection& connection) {
+                                            return now - connection.last_used < idle_timeout;
+                                        });
+
+        evicted_connections += static_cast<std::size_t>(std::distance(idle_connections.begin(), expired_end));
+        idle_connections.erase(idle_connections.begin(), expired_end);
+    }
+
+    std::unique_ptr<httplib::Client> create_connection() {
+        auto client = std::make_unique<httplib::Client>(base_uri.c_str());
+        client->set_follow_location(true);
+        client->set_keep_alive(true);
+
+        SSL_CTX* ctx = client->ssl_context();
+        if (ctx != nullptr) {
+            tls_session_cache.attach(ctx);
+        }
+
+        return client;
+    }
+
+    void prewarm_connections(std::size_t count) {
+        if (count == 0) {
+            return;
+        }
+
+        // Warms the first connection alone so that the others may resume its TLS session
+        prewarm_connection();
+
+        std::vector<std::future<void>> futures;
+        for (std::size_t i = 1; i < count; i++) {
+            futures.push_back(std::async(std::launch::async, [this]() {
+                prewarm_connection();
+            }));
+        }
+
+        for (auto& future: futures) {
+            future.get();
+        }
+    }
+
+    // Connects by sending a HEAD request for the root of the host, as the connection is otherwise only opened by the
+    // first request sent over it
+    void prewarm_connection() {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        if (!open || idle_connections.size() + active_connections.size() >= max_connections) {
+            return;
+        }
+
+        // Checked out like the connection of a request, so that stopping the client aborts it
+        auto client = create_connection();
+        created_connections++;
+        active_connections.insert(client.get());
+        lock.unlock();
+
+        auto res = client->Head("/");
+        if (!res) {
+            log_error("Failed to pre-warm connection: " + error_result_2_string(res));
+        }
+
+        lock.lock();
+        active_connections.erase(client.get());
+        if (open && res) {
+            idle_connections.push_back({std::move(client), std::chrono::steady_clock::now()});
+        } else {
+            evicted_connections++;
+        }
+        lock.unlock();
+
+        pool_cv.notify_one();
+    }
+
+    HttpResponse send(HttpRequest request) {
+        validate_request_method(request);
+        validate_request_path_query_fragment(request);
+        validate_request_content_type(request);
+        validate_request_body(request);
+
+        auto req = httplib::Request();
+        req.path = request.get_path_query_fragment().value();
+        req.method = EnumUtils::serialize_http_method(request.get_method().value());
+        req.headers = create_headers(request);
+        req.body = request.take_body().value();
+
+        log_request(req);
+        compress_request_body(req);
+
+        ConnectionLease connection = checkout();
+
+        const auto begin = std::chrono::high_resolution_clock::now();
+        auto res = connection->send(req);
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        if (res) {
+            decompress_response_body(*res);
+        }
+
+        log_result(req, res, std::chrono::duration_cast<std::chrono::milliseconds>(end - begin));
+
+        if (!res) {
+            connection.discard();
+            throw std::runtime_error(error_result_2_string(res));
+        }
+
+        auto builder = HttpResponse::builder();
+        for (auto& [key, value]: res->headers) {
+            builder.add_header(key, std::move(value));
+        }
+
+        return builder.code(res->status)
+                      .body(std::move(res->body))
+                      .build();
+    }
+
+    void compress_request_body(httplib::Request& req) {
+        std::unique_lock<std::mutex> lock(compression_mutex);
+        if (!compress_requests || req.body.size() < compression_threshold || req.has_header(ContentEncoding)) {
+            return;
+        }
+        lock.unlock();
+
+        std::string compressed = gzip_compress(req.body);
+        if (compressed.size() >= req.body.size()) {
+            return;
+        }
+
+        lock.lock();
+        compression_stats.requests_compressed++;
+        compression_stats.request_bytes_uncompressed += req.body.size();
+        compression_stats.request_bytes_compressed += compressed.size();
+        lock.unlock();
+
+        req.body = std::move(compressed);
+        req.set_header(ContentEncoding, "gzip");
+    }
+
+    void decompress_response_body(httplib::Response& res) {
+        if (!res.has_header(ContentEncoding)) {
+            return;
+        }
+
+        const std::string encoding = res.get_header_value(ContentEncoding);
+        if (!is_supported_content_encoding(encoding)) {
+            return;
+        }
+
+        // Capped at the size of JSON text the response may hold, so that a small, highly compressed body is rejected
+        // before it is inflated in full
+        const std::size_t max_size = enjin::sdk::json::get_json_parse_limits().max_bytes;
+        std::string decompressed = decompress(res.body, encoding, max_size);
+
+        std::unique_lock<std::mutex> lock(compression_mutex);
+        compression_stats.responses_decompressed++;
+        compression_stats.response_bytes_compressed += res.body.size();
+        compression_stats.response_bytes_uncompressed += decompressed.size();
+        lock.unlock();
+
+        // The headers now describe the decompressed body
+        res.body = std::move(decompressed);
+        res.headers.erase(ContentEncoding);
+        res.headers.erase(ContentLength);
+    }
 
     httplib::Headers create_headers(const HttpRequest& request) {
         httplib::Headers headers;
@@ -145,6 +581,12 @@ private:
             headers.emplace(entry.first, entry.second);
         }
 
+        // Compressed responses are requested independently of request compression, as decompressing them is cheap
+        // compared to the bytes saved
+        if (headers.find(AcceptEncoding) == headers.end()) {
+            headers.emplace(AcceptEncoding, "gzip, deflate");
+        }
+
         return headers;
     }
 
@@ -305,7 +747,8 @@ private:
     }
 };
 
-HttpClient::HttpClient(std::string base_uri) : impl(new Impl(std::move(base_uri))) {
+HttpClient::HttpClient(std::string base_uri, std::size_t max_connections, std::chrono::milliseconds idle_timeout)
+        : impl(new Impl(std::move(base_uri), max_connections, idle_timeout)) {
 }
 
 HttpClient::~HttpClient() {
@@ -321,13 +764,21 @@ void HttpClient::stop() {
 }
 
 std::future<HttpResponse> HttpClient::send_request(HttpRequest request) {
-    return impl->send_request(request);
+    return impl->send_request(std::move(request));
 }
 
 const std::string& HttpClient::get_base_uri() const {
     return impl->get_base_uri();
 }
 
+std::optional<CompressionStats> HttpClient::get_compression_stats() const {
+    return impl->get_compression_stats();
+}
+
+std::optional<ConnectionPoolStats> HttpClient::get_connection_pool_stats() const {
+    return impl->get_connection_pool_stats();
+}
+
 bool HttpClient::is_open() const {
     return impl->is_open();
 }
@@ -336,6 +787,18 @@ void HttpClient::set_default_request_header(std::string key, std::string value)
     impl->set_default_request_header(std::move(key), std::move(value));
 }
 
+void HttpClient::set_executor(std::shared_ptr<utils::IExecutor> executor) {
+    impl->set_executor(std::move(executor));
+}
+
 void HttpClient::set_logger(HttpLogLevel level, std::shared_ptr<utils::LoggerProvider> logger_provider) {
     impl->set_logger(level, std::move(logger_provider));
 }
+
+void HttpClient::set_prewarmed_connections(std::size_t count) {
+    impl->set_prewarmed_connections(count);
+}
+
+void HttpClient::set_request_compression(bool enabled, std::size_t threshold) {
+    impl->set_request_compression(enabled, threshold);
+}
@@ -41,6 +41,11 @@ HttpRequest& HttpRequest::set_content_type(std::string content_type) {
     return *this;
 }
 
+HttpRequest& HttpRequest::set_idempotent(bool idempotent) {
+    HttpRequest::idempotent = idempotent;
+    return *this;
+}
+
 HttpRequest& HttpRequest::add_header(std::string name, std::string value) {
     headers.emplace(std::move(name), std::move(value));
     return *this;
@@ -72,6 +77,16 @@ std::optional<std::string> HttpRequest::get_header_value(const std::string& name
            : std::optional<std::string>();
 }
 
+bool HttpRequest::is_idempotent() const noexcept {
+    return idempotent;
+}
+
+std::optional<std::string> HttpRequest::take_body() {
+    std::optional<std::string> taken(std::move(body));
+    body.reset();
+    return taken;
+}
+
 bool HttpRequest::has_header(const std::string& name) const noexcept {
     return headers.find(name) != headers.end();
 }
@@ -80,7 +95,8 @@ bool HttpRequest::operator==(const HttpRequest& rhs) const {
     return method == rhs.method &&
            path_query_fragment == rhs.path_query_fragment &&
            body == rhs.body &&
-           headers == rhs.headers;
+           headers == rhs.headers &&
+           idempotent == rhs.idempotent;
 }
 
 bool HttpRequest::operator!=(const HttpRequest& rhs) const {
@@ -15,6 +15,7 @@
 
 #include "enjinsdk/HttpResponse.hpp"
 
+#include "JsonParser.hpp"
 #include "rapidjson/document.h"
 #include <utility>
 
@@ -38,9 +39,9 @@ bool HttpResponse::is_empty() const {
     }
 
     rapidjson::Document document;
-    document.Parse(body.value().c_str());
 
-    return body.value().empty() || (document.IsObject() && document.ObjectEmpty());
+    return body.value().empty()
+           || (json::parse_document(document, body.value()) && document.IsObject() && document.ObjectEmpty());
 }
 
 const std::optional<unsigned short>& HttpResponse::get_code() const {
@@ -51,6 +52,12 @@ const std::optional<std::string>& HttpResponse::get_body() const {
     return body;
 }
 
+std::optional<std::string> HttpResponse::take_body() {
+    std::optional<std::string> taken(std::move(body));
+    body.reset();
+    return taken;
+}
+
 const std::map<std::string, std::string>& HttpResponse::get_headers() const {
     return headers;
 }
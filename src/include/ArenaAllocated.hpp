@@ -0,0 +1,108 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_ARENAALLOCATED_HPP
+#define ENJINSDK_ARENAALLOCATED_HPP
+
+#include "enjinsdk_export.h"
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace enjin::sdk::models {
+
+/// \brief Base for the implementations of models which allocates them from the arena of the innermost
+/// ModelArenaScope open on the calling thread, or from the global heap if there is none.
+class ENJINSDK_EXPORT ArenaAllocated {
+public:
+    static void* operator new(std::size_t size);
+
+    static void operator delete(void* ptr, std::size_t size) noexcept;
+
+    /// \brief Allocates memory from the arena of the innermost scope open on the calling thread, or from the global
+    /// heap if there is none.
+    /// \param size The number of bytes.
+    /// \return The memory, aligned for any scalar type.
+    static void* allocate(std::size_t size);
+
+    /// \brief Frees memory returned by allocate().
+    /// \param ptr The memory.
+    /// \param size The number of bytes it was allocated with.
+    static void deallocate(void* ptr, std::size_t size) noexcept;
+
+private:
+    /// \brief Header placed before every allocation, keeping the arena it was allocated from alive.
+    struct Header;
+};
+
+/// \brief Stateless allocator which allocates through ArenaAllocated.
+/// \tparam T The type to allocate.
+template<class T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+
+    template<class U>
+    explicit ArenaAllocator(const ArenaAllocator<U>&) noexcept {
+    }
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(ArenaAllocated::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        ArenaAllocated::deallocate(ptr, n * sizeof(T));
+    }
+
+    template<class U>
+    bool operator==(const ArenaAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template<class U>
+    bool operator!=(const ArenaAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+/// \brief Creates the implementation of a model, which copies of the model share until one of them is deserialized.
+/// \tparam T The type of the implementation.
+/// \tparam Args The types of the arguments to construct it with.
+/// \param args The arguments to construct it with.
+/// \return The implementation.
+/// \remarks The implementation is allocated together with its reference count, from the arena of the innermost scope
+/// open on the calling thread if there is one.
+template<class T, class... Args>
+std::shared_ptr<T> make_shared_impl(Args&& ... args) {
+    return std::allocate_shared<T>(ArenaAllocator<T>(), std::forward<Args>(args)...);
+}
+
+/// \brief Returns the implementation of a model with no fields set, which every default constructed instance of the
+/// model shares.
+/// \tparam T The type of the implementation.
+/// \return The implementation.
+/// \remarks The implementation is allocated from the global heap, whatever scope is open. Models replace it with an
+/// implementation of their own when deserialized instead of modifying it.
+template<class T>
+const std::shared_ptr<T>& get_empty_impl() {
+    static const std::shared_ptr<T> impl = std::make_shared<T>();
+    return impl;
+}
+
+}
+
+#endif //ENJINSDK_ARENAALLOCATED_HPP
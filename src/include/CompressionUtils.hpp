@@ -0,0 +1,57 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_COMPRESSIONUTILS_HPP
+#define ENJINSDK_COMPRESSIONUTILS_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/JsonParseLimits.hpp"
+#include <cstddef>
+#include <string>
+
+namespace enjin::sdk::utils {
+
+/// \brief Compresses the data into the gzip format.
+/// \param data The data.
+/// \return The compressed data.
+/// \throws std::runtime_error If the data could not be compressed.
+ENJINSDK_EXPORT
+std::string gzip_compress(const std::string& data);
+
+/// \brief Decompresses the data according to the value of a content-encoding header.
+/// \param data The compressed data.
+/// \param content_encoding The content encoding, either "gzip", "x-gzip" or "deflate". The comparison is
+/// case-insensitive.
+/// \param max_size The maximum size of the decompressed data in bytes, which defaults to the maximum size of a JSON
+/// text. A maximum size of zero is not enforced.
+/// \return The decompressed data.
+/// \throws std::runtime_error If the encoding is not supported, the data is corrupt or the decompressed data exceeds the
+/// maximum size.
+/// \remarks Data encoded as "deflate" may be in either the zlib format or the raw deflate format. Decompression stops
+/// as soon as the maximum size is exceeded, so that a small, highly compressed payload cannot exhaust memory.
+ENJINSDK_EXPORT
+std::string decompress(const std::string& data,
+                       const std::string& content_encoding,
+                       std::size_t max_size = json::get_json_parse_limits().max_bytes);
+
+/// \brief Determines whether a content encoding may be decompressed by decompress().
+/// \param content_encoding The content encoding.
+/// \return Whether the content encoding is supported.
+ENJINSDK_EXPORT
+bool is_supported_content_encoding(const std::string& content_encoding);
+
+}
+
+#endif //ENJINSDK_COMPRESSIONUTILS_HPP
@@ -0,0 +1,138 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_GRAPHQLBATCHER_HPP
+#define ENJINSDK_GRAPHQLBATCHER_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/HttpResponse.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace enjin::sdk::graphql {
+
+/// \brief Collects GraphQL request bodies and sends them together as a single JSON array, then splits the array
+/// response back into a response for each request.
+/// \remarks A batch is sent once it holds the maximum number of requests or once its oldest request has waited for
+/// the maximum delay, whichever happens first. A batch holding a single request is sent as a plain request.
+class ENJINSDK_EXPORT GraphqlBatcher {
+public:
+    /// \brief Function which is passed the outcome of a request in a batch. The future passed is always ready.
+    using Completion = std::function<void(std::shared_future<http::HttpResponse>)>;
+
+    /// \brief Function which schedules the given task to run asynchronously.
+    using Dispatcher = std::function<void(std::function<void()>)>;
+
+    /// \brief Function which sends the given request body to the platform.
+    using Sender = std::function<std::future<http::HttpResponse>(std::string)>;
+
+    GraphqlBatcher() = delete;
+
+    /// \brief Constructs the batcher and starts the thread which sends batches on their deadline.
+    /// \param sender The function for sending request bodies.
+    /// \param dispatcher The function for scheduling the tasks which wait for and split the batch responses.
+    /// \param max_batch_size The maximum number of requests in a batch. At least one request is always allowed.
+    /// \param max_delay The maximum time a request may wait for its batch to be sent.
+    GraphqlBatcher(Sender sender,
+                   Dispatcher dispatcher,
+                   std::size_t max_batch_size,
+                   std::chrono::milliseconds max_delay);
+
+    GraphqlBatcher(const GraphqlBatcher&) = delete;
+
+    GraphqlBatcher(GraphqlBatcher&&) = delete;
+
+    /// \brief Destructor.
+    /// \remarks Sends the requests which are still waiting for their batch.
+    ~GraphqlBatcher();
+
+    /// \brief Adds a request to the current batch.
+    /// \param request_body The serialized request body.
+    /// \param completion The function to pass the outcome of the request to.
+    void enqueue(std::string request_body, Completion completion);
+
+    /// \brief Sends the current batch without waiting for it to fill or for its deadline.
+    void flush();
+
+    /// \brief Returns the number of batches, including those holding a single request, which have been sent.
+    /// \return The number of batches.
+    [[nodiscard]] std::size_t get_batch_count() const;
+
+    /// \brief Returns the maximum number of requests in a batch.
+    /// \return The maximum number of requests.
+    [[nodiscard]] std::size_t get_max_batch_size() const;
+
+    /// \brief Returns the maximum time a request may wait for its batch to be sent.
+    /// \return The maximum delay.
+    [[nodiscard]] std::chrono::milliseconds get_max_delay() const;
+
+    GraphqlBatcher& operator=(const GraphqlBatcher&) = delete;
+
+    GraphqlBatcher& operator=(GraphqlBatcher&&) = delete;
+
+    /// \brief Joins serialized request bodies into the body of a batch request.
+    /// \param request_bodies The request bodies.
+    /// \return The batch request body.
+    [[nodiscard]] static std::string create_batch_body(const std::vector<std::string>& request_bodies);
+
+    /// \brief Splits the response to a batch request into a response for each request in the batch.
+    /// \param response The batch response.
+    /// \param count The number of requests in the batch.
+    /// \return The responses, in the order of the requests in the batch.
+    /// \throws std::runtime_error If the response is an array whose size differs from the number of requests.
+    /// \remarks If the response body is not an array, such as when the platform rejects the batch as a whole, then
+    /// each request is given the whole response.
+    [[nodiscard]] static std::vector<http::HttpResponse> split_batch_response(const http::HttpResponse& response,
+                                                                              std::size_t count);
+
+private:
+    struct Entry {
+        std::string request_body;
+        Completion completion;
+    };
+
+    const Sender sender;
+    const Dispatcher dispatcher;
+    const std::size_t max_batch_size;
+    const std::chrono::milliseconds max_delay;
+
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<Entry> pending;
+    std::chrono::steady_clock::time_point deadline;
+    std::size_t batch_count = 0;
+    bool running = true;
+    std::thread deadline_thread;
+
+    void run_deadlines();
+
+    void send_batch(std::vector<Entry> batch);
+
+    std::vector<Entry> take_pending();
+
+    static void complete(const std::vector<Entry>& batch, const std::exception_ptr& exception);
+};
+
+}
+
+#endif //ENJINSDK_GRAPHQLBATCHER_HPP
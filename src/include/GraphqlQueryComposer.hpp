@@ -0,0 +1,82 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_GRAPHQLQUERYCOMPOSER_HPP
+#define ENJINSDK_GRAPHQLQUERYCOMPOSER_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/GraphqlQueryRegistry.hpp"
+#include "enjinsdk/internal/AbstractGraphqlRequest.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace enjin::sdk::graphql {
+
+/// \brief Merges registered query operations into a single GraphQL document, then splits the response to that document
+/// back into a response for each operation.
+/// \remarks The root field of each operation is aliased and its variables and fragments are renamed with a suffix
+/// unique to the operation, so that operations sharing a template or a fragment do not collide.
+class ENJINSDK_EXPORT GraphqlQueryComposer {
+public:
+    GraphqlQueryComposer() = delete;
+
+    /// \brief Constructs the composer for the templates of a registry.
+    /// \param registry The registry, which must outlive this composer.
+    explicit GraphqlQueryComposer(const GraphqlQueryRegistry& registry);
+
+    ~GraphqlQueryComposer() = default;
+
+    /// \brief Adds a request as the next operation of the document.
+    /// \param request The request.
+    /// \throws std::runtime_error If the template of the request is not registered, is not a query or does not select
+    /// a single root field aliased as "result".
+    void add(const AbstractGraphqlRequest& request);
+
+    /// \brief Returns the number of operations added to this composer.
+    /// \return The number of operations.
+    [[nodiscard]] std::size_t size() const;
+
+    /// \brief Creates the body of the request for the merged document and the merged variables.
+    /// \return The serialized request body.
+    [[nodiscard]] std::string create_request_body() const;
+
+    /// \brief Splits the response to the merged document into a response body for each operation.
+    /// \param response_body The response body.
+    /// \return The response bodies, in the order the operations were added.
+    /// \remarks Each body holds the data of its operation as "result" along with the errors whose path begins at its
+    /// root field, or the errors which have no path.
+    [[nodiscard]] std::vector<std::string> split_response(const std::string& response_body) const;
+
+    /// \brief Returns the alias of the root field of an operation.
+    /// \param index The index of the operation.
+    /// \return The alias.
+    [[nodiscard]] static std::string create_alias(std::size_t index);
+
+private:
+    struct Operation {
+        std::vector<std::string> parameters;
+        std::string selection;
+        std::string fragments;
+        std::string variables;
+    };
+
+    const GraphqlQueryRegistry& registry;
+    std::vector<Operation> operations;
+};
+
+}
+
+#endif //ENJINSDK_GRAPHQLQUERYCOMPOSER_HPP
@@ -23,25 +23,45 @@
 #define ENJINCPPSDK_HTTPCLIENT_HPP
 
 #include "enjinsdk_export.h"
+#include "enjinsdk/CompressionStats.hpp"
+#include "enjinsdk/ConnectionPoolStats.hpp"
+#include "enjinsdk/IExecutor.hpp"
 #include "enjinsdk/IHttpClient.hpp"
 #include "enjinsdk/LoggerProvider.hpp"
+#include <chrono>
+#include <cstddef>
 #include <future>
+#include <memory>
+#include <optional>
 #include <string>
 
 namespace enjin::sdk::http {
 
 /// \brief Built-in HTTP client for this SDK.
+/// \remarks The client advertises support for gzip and deflate encoded responses and transparently decompresses them.
+/// The Accept-Encoding header is sent whether or not request compression is enabled, unless the request or the default
+/// request headers set it, such as to "identity" for opting out. Compression of request bodies is opt-in, see
+/// set_request_compression(). TLS sessions are cached so that connections opened after the first resume a session
+/// rather than doing a full handshake.
 class ENJINSDK_EXPORT HttpClient : public IHttpClient {
 public:
     HttpClient() = delete;
 
     /// \brief Creates the HTTP client with the base URI.
     /// \param base_uri The base URI for the client.
-    explicit HttpClient(std::string base_uri);
+    /// \param max_connections The maximum number of keep-alive connections to the base URI. At least one connection is
+    /// always allowed.
+    /// \param idle_timeout The duration after which an unused connection is evicted from the pool.
+    explicit HttpClient(std::string base_uri,
+                        std::size_t max_connections = DefaultMaxConnections,
+                        std::chrono::milliseconds idle_timeout = DefaultIdleTimeout);
 
     /// \brief Destructor.
     ~HttpClient() override;
 
+    /// \copydoc IHttpClient::start()
+    /// \remarks The pre-warmed connections, if any, are opened in the background, and requests sent before they are
+    /// open use other connections.
     void start() override;
 
     void stop() override;
@@ -52,12 +72,51 @@ public:
     /// \return The URI.
     [[nodiscard]] const std::string& get_base_uri() const;
 
+    /// \copydoc IHttpClient::get_compression_stats()
+    /// \remarks The stats are always present for this client.
+    [[nodiscard]] std::optional<CompressionStats> get_compression_stats() const override;
+
+    /// \copydoc IHttpClient::get_connection_pool_stats()
+    /// \remarks The stats are always present for this client.
+    [[nodiscard]] std::optional<ConnectionPoolStats> get_connection_pool_stats() const override;
+
     [[nodiscard]] bool is_open() const override;
 
     void set_default_request_header(std::string key, std::string value) override;
 
+    /// \brief Sets the executor used to send requests.
+    /// \param executor The executor.
+    /// \remarks Requests sent from a thread owned by the executor are sent on that thread rather than being handed off
+    /// to another worker. If no executor is set, then each request is sent with std::async.
+    void set_executor(std::shared_ptr<utils::IExecutor> executor);
+
     void set_logger(HttpLogLevel level, std::shared_ptr<utils::LoggerProvider> logger_provider) override;
 
+    /// \brief Sets the number of connections opened when this client is started.
+    /// \param count The number of connections, which is capped at the maximum number of connections.
+    /// \remarks Each connection is opened in the background by sending a HEAD request for the root of the host, which
+    /// resolves the host and completes the TCP and TLS handshakes before the first request is sent. The first
+    /// connection is opened before the others so that they may resume its TLS session. Connections which fail to open
+    /// are logged and skipped, and stopping the client aborts those still opening. No connections are opened by
+    /// default.
+    void set_prewarmed_connections(std::size_t count);
+
+    /// \brief Sets whether request bodies are sent gzip compressed.
+    /// \param enabled Whether request compression is enabled.
+    /// \param threshold The size in bytes a request body must reach to be compressed.
+    /// \remarks A body is sent uncompressed if compressing it does not reduce its size or if the request already has a
+    /// content-encoding header. Request compression is disabled by default.
+    void set_request_compression(bool enabled, std::size_t threshold = DefaultCompressionThreshold);
+
+    /// \brief The default size in bytes a request body must reach to be compressed.
+    static constexpr std::size_t DefaultCompressionThreshold = 1024;
+
+    /// \brief The default maximum number of pooled connections.
+    static constexpr std::size_t DefaultMaxConnections = 8;
+
+    /// \brief The default duration after which an unused connection is evicted.
+    static constexpr std::chrono::milliseconds DefaultIdleTimeout = std::chrono::seconds(30);
+
 private:
     class Impl;
 
@@ -0,0 +1,68 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_INTERNEDSTRING_HPP
+#define ENJINSDK_INTERNEDSTRING_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/JsonView.hpp"
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace enjin::sdk::utils {
+
+/// \brief Optional string field of a model, which shares its string with the string intern pool if interning is
+/// enabled.
+class ENJINSDK_EXPORT InternedString final {
+public:
+    /// \brief Constructs an instance without a value.
+    InternedString() = default;
+
+    /// \brief Returns the value of this string.
+    /// \return Optional for the value.
+    [[nodiscard]] const std::optional<std::string>& get() const noexcept;
+
+    /// \brief Clears this string.
+    void reset() noexcept;
+
+    /// \brief Sets this string to the given value, taking it from the string intern pool if interning is enabled.
+    /// \param value The value.
+    void set(std::string_view value);
+
+    /// \brief Tries and set this string with the specified string field.
+    /// \param json The JSON value-object.
+    /// \param key The name of the field.
+    /// \return Whether this action was successful.
+    /// \remarks This string will be cleared if this operation is not successful.
+    bool try_get_field(const json::JsonView& json, const std::string& key);
+
+    /// \remarks Strings taken from the pool are equal if they have the same address, without comparing their values.
+    bool operator==(const InternedString& rhs) const;
+
+    bool operator!=(const InternedString& rhs) const;
+
+    /// \brief String held by the string intern pool.
+    struct PoolEntry;
+
+private:
+    std::optional<std::string> owned;
+    std::shared_ptr<const PoolEntry> shared;
+};
+
+}
+
+#endif //ENJINSDK_INTERNEDSTRING_HPP
@@ -0,0 +1,157 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_JSONPARSELIMITER_HPP
+#define ENJINSDK_JSONPARSELIMITER_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/JsonParseLimits.hpp"
+#include "rapidjson/reader.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace enjin::sdk::json {
+
+/// \brief The limits a JSON text may exceed.
+enum class JsonParseLimit {
+    Bytes,
+    Depth,
+    StringLength,
+    Nodes,
+};
+
+/// \brief Checks the size of a JSON text before it is read, counting the text as rejected if it exceeds the byte limit.
+/// \param size The size of the text in bytes.
+/// \return Whether the text is within the byte limit.
+ENJINSDK_EXPORT
+bool is_within_json_byte_limit(std::size_t size);
+
+/// \brief Counts a JSON text as rejected for exceeding the given limit.
+/// \param limit The limit.
+ENJINSDK_EXPORT
+void record_json_parse_rejection(JsonParseLimit limit);
+
+/// \brief SAX handler which forwards events to another handler while enforcing the JSON parse limits, stopping the
+/// reader at the first event which exceeds one of them.
+/// \tparam Handler The type of the handler to forward events to.
+/// \remarks Since rapidjson's reader only descends into an object or array after its start event has been handled,
+/// enforcing the depth limit here also bounds the recursion of the reader itself.
+template<class Handler>
+class JsonParseLimiter final : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, JsonParseLimiter<Handler>> {
+public:
+    JsonParseLimiter() = delete;
+
+    /// \brief Constructs the limiter for the limits currently set.
+    /// \param handler The handler to forward events to.
+    explicit JsonParseLimiter(Handler& handler) : handler(handler), limits(get_json_parse_limits()) {
+    }
+
+    JsonParseLimiter(const JsonParseLimiter&) = delete;
+
+    JsonParseLimiter(JsonParseLimiter&&) = delete;
+
+    ~JsonParseLimiter() = default;
+
+    // Handler functions called by rapidjson's reader for each event
+
+    bool Null() {
+        return add_node() && handler.Null();
+    }
+
+    bool Bool(bool b) {
+        return add_node() && handler.Bool(b);
+    }
+
+    bool Int(int i) {
+        return add_node() && handler.Int(i);
+    }
+
+    bool Uint(unsigned u) {
+        return add_node() && handler.Uint(u);
+    }
+
+    bool Int64(int64_t i) {
+        return add_node() && handler.Int64(i);
+    }
+
+    bool Uint64(uint64_t u) {
+        return add_node() && handler.Uint64(u);
+    }
+
+    bool Double(double d) {
+        return add_node() && handler.Double(d);
+    }
+
+    bool String(const char* str, rapidjson::SizeType length, bool copy) {
+        return add_node() && check_string(length) && handler.String(str, length, copy);
+    }
+
+    bool StartObject() {
+        return add_node() && enter() && handler.StartObject();
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool copy) {
+        return check_string(length) && handler.Key(str, length, copy);
+    }
+
+    bool EndObject(rapidjson::SizeType member_count) {
+        depth--;
+        return handler.EndObject(member_count);
+    }
+
+    bool StartArray() {
+        return add_node() && enter() && handler.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType element_count) {
+        depth--;
+        return handler.EndArray(element_count);
+    }
+
+    JsonParseLimiter& operator=(const JsonParseLimiter&) = delete;
+
+    JsonParseLimiter& operator=(JsonParseLimiter&&) = delete;
+
+private:
+    Handler& handler;
+    const JsonParseLimits limits;
+    std::size_t depth = 0;
+    std::size_t nodes = 0;
+
+    bool add_node() {
+        return is_within(limits.max_nodes, ++nodes) || reject(JsonParseLimit::Nodes);
+    }
+
+    bool check_string(rapidjson::SizeType length) {
+        return is_within(limits.max_string_length, length) || reject(JsonParseLimit::StringLength);
+    }
+
+    bool enter() {
+        return is_within(limits.max_depth, ++depth) || reject(JsonParseLimit::Depth);
+    }
+
+    static bool is_within(std::size_t limit, std::size_t amount) {
+        return limit == 0 || amount <= limit;
+    }
+
+    static bool reject(JsonParseLimit limit) {
+        record_json_parse_rejection(limit);
+        return false;
+    }
+};
+
+}
+
+#endif //ENJINSDK_JSONPARSELIMITER_HPP
@@ -0,0 +1,56 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_JSONPARSER_HPP
+#define ENJINSDK_JSONPARSER_HPP
+
+#include "enjinsdk_export.h"
+#include "JsonSource.hpp"
+#include "rapidjson/document.h"
+#include <string>
+#include <string_view>
+
+namespace enjin::sdk::json {
+
+// Every function parsing into a document enforces the limits set with set_json_parse_limits() and counts the texts it
+// rejects for exceeding them.
+
+/// \brief Parses JSON text into a document.
+/// \param document The document to parse into. Left unchanged if the text is not valid JSON or exceeds a limit.
+/// \param raw The JSON text.
+/// \return Whether the text was valid JSON within the limits.
+ENJINSDK_EXPORT
+bool parse_document(rapidjson::Document& document, std::string_view raw);
+
+/// \brief Parses JSON text owned by the caller into a document in place.
+/// \param document The document to parse into. Left unchanged if the text is not valid JSON or exceeds a limit.
+/// \param raw The JSON text, which may be overwritten by the parser.
+/// \return Whether the text was valid JSON within the limits.
+/// \remarks Strings in the document may point into the text, so the text must outlive the document.
+ENJINSDK_EXPORT
+bool parse_document_in_situ(rapidjson::Document& document, std::string& raw);
+
+/// \brief Parses the JSON value at a span of a shared text into a document, recording the sources of its objects.
+/// \param document The document to parse into. Left unchanged if the value is not valid JSON or exceeds a limit.
+/// \param recorder The recorder for the sources, which holds the text.
+/// \param span The span of the value within the text.
+/// \return Whether the value was valid JSON within the limits.
+/// \remarks The text is left unchanged, so that spans of it may be parsed again.
+ENJINSDK_EXPORT
+bool parse_document_span(rapidjson::Document& document, JsonSourceRecorder& recorder, JsonSpan span);
+
+}
+
+#endif //ENJINSDK_JSONPARSER_HPP
@@ -0,0 +1,144 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_JSONSOURCE_HPP
+#define ENJINSDK_JSONSOURCE_HPP
+
+#include "enjinsdk_export.h"
+#include "enjinsdk/JsonView.hpp"
+#include "rapidjson/document.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace enjin::sdk::json {
+
+/// \brief Span of a JSON value within the text it was read from.
+struct JsonSpan {
+    /// \brief The offset of the first character of the value.
+    std::size_t offset = 0;
+
+    /// \brief The number of characters of the value.
+    std::size_t length = 0;
+};
+
+/// \brief Text a JSON object was read from, along with the spans of those of its members which are objects or arrays.
+/// \remarks Views handed to models may carry the source of the object they view, which lets a model keep those members
+/// as spans of the shared text and only decode them when they are first accessed.
+class ENJINSDK_EXPORT JsonSource final {
+public:
+    JsonSource() = default;
+
+    /// \brief Constructs the source of an object read from the given text.
+    /// \param text The text.
+    explicit JsonSource(std::shared_ptr<const std::string> text);
+
+    /// \brief Returns the text the object was read from.
+    /// \return The text.
+    [[nodiscard]] const std::shared_ptr<const std::string>& get_text() const;
+
+    /// \brief Tries to get the span of a member of the object which is an object or array.
+    /// \param key The key of the member.
+    /// \param out The span, which is only set if the member was found.
+    /// \return Whether the object has the member and it is an object or array.
+    bool try_get_member(std::string_view key, JsonSpan& out) const;
+
+    /// \brief Adds the span of a member of the object which is an object or array.
+    /// \param key The key of the member.
+    /// \param span The span of its value.
+    void add_member(std::string_view key, JsonSpan span);
+
+    /// \brief Removes the spans of every member, keeping their storage.
+    void clear_members();
+
+    /// \brief Creates a view of a value which carries the given source.
+    /// \param value The value, which must outlive the view.
+    /// \param source The source of the value, which must outlive the view, or null.
+    /// \return The view.
+    static JsonView create_view(const rapidjson::Value& value, const JsonSource* source);
+
+    /// \brief Returns the source carried by a view.
+    /// \param view The view.
+    /// \return The source, or null if the view does not carry one.
+    static const JsonSource* get(const JsonView& view);
+
+private:
+    std::shared_ptr<const std::string> text;
+    std::vector<std::pair<std::string, JsonSpan>> members;
+};
+
+/// \brief Records the sources of the objects at a given depth of a JSON value from the events of a SAX reader.
+/// \remarks Each event is given the position in the text the reader is at after it has read the character starting or
+/// ending an object or array, which is where rapidjson's reader calls the handler for the event.
+class ENJINSDK_EXPORT JsonSourceRecorder final {
+public:
+    JsonSourceRecorder() = default;
+
+    /// \brief Constructs the recorder for a text.
+    /// \param text The text being read.
+    /// \param object_depth The depth of the objects to record the sources of, with the value read being at depth zero.
+    JsonSourceRecorder(std::shared_ptr<const std::string> text, std::size_t object_depth);
+
+    /// \brief Records the start of an object.
+    /// \param position The position just past the opening brace.
+    void start_object(std::size_t position);
+
+    /// \brief Records the start of an array.
+    /// \param position The position just past the opening bracket.
+    void start_array(std::size_t position);
+
+    /// \brief Records the key of a member.
+    /// \param key The key.
+    void key(std::string_view key);
+
+    /// \brief Records the end of an object or array.
+    /// \param position The position just past the closing brace or bracket.
+    void end(std::size_t position);
+
+    /// \brief Returns the text being read.
+    /// \return The text.
+    [[nodiscard]] const std::shared_ptr<const std::string>& get_text() const;
+
+    /// \brief Returns the number of objects recorded since the recorder was constructed or cleared.
+    /// \return The number of objects.
+    [[nodiscard]] std::size_t get_source_count() const;
+
+    /// \brief Returns the source of a recorded object, in the order the objects were started in.
+    /// \param index The index of the object.
+    /// \return The source.
+    [[nodiscard]] const JsonSource& get_source(std::size_t index) const;
+
+    /// \brief Forgets the objects recorded so far, keeping the storage of their sources for the next value read.
+    void clear();
+
+private:
+    std::shared_ptr<const std::string> text;
+    std::size_t object_depth = 0;
+    std::size_t depth = 0;
+    bool is_in_object = false;
+    std::string member_key;
+    std::size_t member_offset = 0;
+    std::vector<JsonSource> sources;
+    std::size_t source_count = 0;
+
+    void start(std::size_t position, bool is_object);
+};
+
+}
+
+#endif //ENJINSDK_JSONSOURCE_HPP
@@ -0,0 +1,156 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_LAZYFIELD_HPP
+#define ENJINSDK_LAZYFIELD_HPP
+
+#include "enjinsdk/IDeserializable.hpp"
+#include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "JsonParser.hpp"
+#include "JsonSource.hpp"
+#include "rapidjson/document.h"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace enjin::sdk::models {
+
+/// \brief Optional model field which keeps its JSON as a span of the text it was read from until it is first accessed.
+/// \tparam T The model type, or a vector of the model type, held by the field.
+/// \remarks The field is only kept undecoded when the object it is read from carries its source, as the items of list
+/// responses do, and is otherwise decoded when read. An undecoded field holds a share of the text, which it releases
+/// once decoded. The field is decoded at most once, even when first accessed from several threads at the same time.
+template<class T>
+class LazyField final {
+public:
+    LazyField() = default;
+
+    LazyField(const LazyField&) = delete;
+
+    LazyField(LazyField&&) = delete;
+
+    ~LazyField() = default;
+
+    /// \brief Returns the value of this field, decoding it if it has not been decoded yet.
+    /// \return The value.
+    [[nodiscard]] const std::optional<T>& get() const {
+        std::call_once(decode_flag, [this]() {
+            decode();
+        });
+
+        return value;
+    }
+
+    /// \brief Reads this field from the given object, keeping the span of its JSON if the object carries its source.
+    /// \param json The JSON object holding the field.
+    /// \param key The name of the field.
+    /// \remarks Must be called before the field is first accessed.
+    void read(const json::JsonView& json, const std::string& key) {
+        const json::JsonSource* source = json::JsonSource::get(json);
+
+        if (source != nullptr && source->try_get_member(key, span)) {
+            text = source->get_text();
+        } else {
+            utils::JsonUtils::try_get_field(json, key, value);
+        }
+    }
+
+    bool operator==(const LazyField& rhs) const {
+        return get() == rhs.get();
+    }
+
+    bool operator!=(const LazyField& rhs) const {
+        return !(*this == rhs);
+    }
+
+    LazyField& operator=(const LazyField&) = delete;
+
+    LazyField& operator=(LazyField&&) = delete;
+
+private:
+    mutable std::once_flag decode_flag;
+    mutable std::shared_ptr<const std::string> text;
+    json::JsonSpan span;
+    mutable std::optional<T> value;
+
+    template<class U>
+    struct is_vector : std::false_type {
+    };
+
+    template<class U>
+    struct is_vector<std::vector<U>> : std::true_type {
+    };
+
+    void decode() const {
+        if (text == nullptr) {
+            return;
+        }
+
+        // The elements of an array field are the objects whose members are kept undecoded in turn
+        json::JsonSourceRecorder recorder(std::move(text), is_vector<T>::value ? 1 : 0);
+        rapidjson::Document document;
+
+        if (json::parse_document_span(document, recorder, span)) {
+            decode(document, recorder);
+        }
+    }
+
+    void decode(const rapidjson::Document& document, const json::JsonSourceRecorder& recorder) const {
+        if constexpr (is_vector<T>::value) {
+            using Element = typename T::value_type;
+
+            if (!document.IsArray()) {
+                return;
+            }
+
+            T elements;
+            elements.reserve(document.Size());
+            std::size_t source_index = 0;
+
+            for (const rapidjson::Value& element: document.GetArray()) {
+                const json::JsonSource* source = element.IsObject()
+                                                 ? &recorder.get_source(source_index++)
+                                                 : nullptr;
+                Element model;
+                static_cast<serialization::IDeserializable&>(model).deserialize(
+                        json::JsonSource::create_view(element, source));
+
+                elements.push_back(std::move(model));
+            }
+
+            value.emplace(std::move(elements));
+        } else {
+            if (!document.IsObject()) {
+                return;
+            }
+
+            T model;
+            static_cast<serialization::IDeserializable&>(model).deserialize(
+                    json::JsonSource::create_view(document, &recorder.get_source(0)));
+
+            value.emplace(std::move(model));
+        }
+    }
+};
+
+}
+
+#endif //ENJINSDK_LAZYFIELD_HPP
@@ -0,0 +1,191 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_LISTRESULTREADER_HPP
+#define ENJINSDK_LISTRESULTREADER_HPP
+
+#include "enjinsdk_export.h"
+#include "JsonSource.hpp"
+#include "rapidjson/document.h"
+#include "rapidjson/reader.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace enjin::sdk::graphql {
+
+/// \brief SAX handler which reads a GraphQL response with a list result, building only the item, cursor or errors
+/// currently being read as a JSON value and handing each to its handler as soon as it is complete.
+/// \remarks The result is read from the "result" field of the data object and may either be an array of items or an
+/// object with an "items" array and a "cursor" object. Everything else in the response is skipped without being
+/// built.
+class ENJINSDK_EXPORT ListResultReader final
+        : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ListResultReader> {
+public:
+    /// \brief Handler for a value read from the response. The value is only valid until the handler returns.
+    using ValueHandler = std::function<void(const rapidjson::Value&)>;
+
+    /// \brief Handler for an item of the result, along with its source if the response is read from a shared text
+    /// and the item is an object. The item and its source are only valid until the handler returns.
+    using ItemHandler = std::function<void(const rapidjson::Value&, const json::JsonSource*)>;
+
+    ListResultReader() = delete;
+
+    /// \brief Constructs the reader with the handlers for the values it reads.
+    /// \param item_handler The handler for each item of the result.
+    /// \param cursor_handler The handler for the cursor of the result.
+    /// \param errors_handler The handler for the errors field of the response.
+    ListResultReader(ItemHandler item_handler, ValueHandler cursor_handler, ValueHandler errors_handler);
+
+    ListResultReader(const ListResultReader&) = delete;
+
+    ListResultReader(ListResultReader&&) = delete;
+
+    /// \brief Default destructor.
+    ~ListResultReader() = default;
+
+    /// \brief Reads the given JSON, handing the values of interest to the handlers as they are read.
+    /// \param json The JSON.
+    /// \return Whether the JSON was a valid JSON object within the JSON parse limits.
+    /// \remarks Values are handed to the handlers before the whole of the JSON has been validated.
+    bool read(const std::string& json);
+
+    /// \brief Reads the given JSON, handing the values of interest to the handlers as they are read along with the
+    /// sources of the items.
+    /// \param json The JSON.
+    /// \return Whether the JSON was a valid JSON object within the JSON parse limits.
+    /// \remarks Values are handed to the handlers before the whole of the JSON has been validated.
+    bool read(const std::shared_ptr<const std::string>& json);
+
+    /// \brief Determines whether the items read make up the result, which is when the result was an array of items
+    /// or an object with both an array of items and a cursor.
+    /// \return Whether the items make up the result.
+    [[nodiscard]] bool has_items() const;
+
+    /// \brief Determines whether the result was an object with a cursor.
+    /// \return Whether the result is paginated.
+    [[nodiscard]] bool is_paginated() const;
+
+    // Handler functions called by rapidjson's reader for each event
+
+    bool Null();
+
+    bool Bool(bool b);
+
+    bool Int(int i);
+
+    bool Uint(unsigned u);
+
+    bool Int64(int64_t i);
+
+    bool Uint64(uint64_t u);
+
+    bool Double(double d);
+
+    bool String(const char* str, rapidjson::SizeType length, bool copy);
+
+    bool StartObject();
+
+    bool Key(const char* str, rapidjson::SizeType length, bool copy);
+
+    bool EndObject(rapidjson::SizeType member_count);
+
+    bool StartArray();
+
+    bool EndArray(rapidjson::SizeType element_count);
+
+    ListResultReader& operator=(const ListResultReader&) = delete;
+
+    ListResultReader& operator=(ListResultReader&&) = delete;
+
+private:
+    enum class Role {
+        Root,
+        Data,
+        ResultObject,
+        ResultArray,
+        Items,
+        Skipped,
+    };
+
+    enum class Field {
+        Data,
+        Errors,
+        Result,
+        Items,
+        Cursor,
+        Other,
+    };
+
+    enum class Slot {
+        Root,
+        Data,
+        Errors,
+        Result,
+        Items,
+        Cursor,
+        Item,
+        Other,
+    };
+
+    struct Frame {
+        Role role;
+        Field field = Field::Other;
+    };
+
+    static constexpr std::size_t ValueBufferSize = 4096;
+
+    ItemHandler item_handler;
+    ValueHandler cursor_handler;
+    ValueHandler errors_handler;
+
+    std::vector<Frame> frames;
+
+    // Values of the value being captured which are still waiting for their object or array to end
+    std::vector<rapidjson::Value> values;
+    alignas(std::max_align_t) char value_buffer[ValueBufferSize];
+    rapidjson::MemoryPoolAllocator<> allocator;
+    Slot capture_slot = Slot::Other;
+    std::size_t capture_depth = 0;
+    bool is_capturing = false;
+
+    bool is_result_array = false;
+    bool is_result_object = false;
+    bool has_items_array = false;
+    bool has_cursor = false;
+
+    // Stream of the JSON being read and the recorder for the sources of its items, if they are recorded
+    const rapidjson::StringStream* stream = nullptr;
+    json::JsonSourceRecorder recorder;
+    bool is_recording = false;
+
+    bool read_text(const std::string& json);
+
+    [[nodiscard]] Slot get_next_slot() const;
+
+    [[nodiscard]] bool is_recording_item() const;
+
+    template<class... Args>
+    bool add_scalar(Args&&... args);
+
+    bool deliver_if_complete();
+};
+
+}
+
+#endif //ENJINSDK_LISTRESULTREADER_HPP
@@ -33,6 +33,8 @@ public:
 
     void deserialize(const std::string& json) override;
 
+    void deserialize(const sdk::json::JsonView& json) override;
+
     /// \brief Returns the user ID of the event.
     /// \return The optional for the user ID.
     [[nodiscard]] const std::optional<std::string>& get_user_id() const;
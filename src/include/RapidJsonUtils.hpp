@@ -19,6 +19,7 @@
 #include "enjinsdk_export.h"
 #include "enjinsdk/IDeserializable.hpp"
 #include "enjinsdk/ISerializable.hpp"
+#include "JsonParser.hpp"
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
@@ -102,7 +103,7 @@ void set_array_member_from_type_vector(rapidjson::Document& document, const std:
 
     for (auto& v: values) {
         rapidjson::Document v_document(&allocator);
-        v_document.Parse(v.serialize().c_str());
+        json::parse_document(v_document, v.serialize());
         arr.PushBack(v_document, allocator);
     }
 
@@ -0,0 +1,42 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_RESULTTABLEUTILS_HPP
+#define ENJINSDK_RESULTTABLEUTILS_HPP
+
+#include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include <optional>
+#include <string>
+
+namespace enjin::sdk::models {
+
+/// \brief Appends the specified field of a JSON object to a column of a result table.
+/// \tparam T The type of the field.
+/// \tparam C The type of the column.
+/// \param item The JSON object.
+/// \param key The name of the field.
+/// \param column The column, to which a row without a value is appended if the object does not have the field.
+template<class T, class C>
+void append_field(const json::JsonView& item, const std::string& key, C& column) {
+    std::optional<T> field;
+    utils::JsonUtils::try_get_field(item, key, field);
+
+    column.push_back(field);
+}
+
+}
+
+#endif //ENJINSDK_RESULTTABLEUTILS_HPP
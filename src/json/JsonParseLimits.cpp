@@ -0,0 +1,97 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/JsonParseLimits.hpp"
+
+#include "JsonParseLimiter.hpp"
+#include <atomic>
+
+namespace {
+
+using namespace enjin::sdk::json;
+
+constexpr JsonParseLimits DefaultLimits{};
+
+// Each limit is read on its own for every text parsed, so they are kept as separate atomics rather than behind a lock
+std::atomic<std::size_t> max_bytes(DefaultLimits.max_bytes);
+std::atomic<std::size_t> max_depth(DefaultLimits.max_depth);
+std::atomic<std::size_t> max_string_length(DefaultLimits.max_string_length);
+std::atomic<std::size_t> max_nodes(DefaultLimits.max_nodes);
+
+std::atomic<std::size_t> too_many_bytes(0);
+std::atomic<std::size_t> too_deep(0);
+std::atomic<std::size_t> string_too_long(0);
+std::atomic<std::size_t> too_many_nodes(0);
+
+}
+
+namespace enjin::sdk::json {
+
+JsonParseLimits get_json_parse_limits() {
+    JsonParseLimits limits;
+    limits.max_bytes = max_bytes.load(std::memory_order_relaxed);
+    limits.max_depth = max_depth.load(std::memory_order_relaxed);
+    limits.max_string_length = max_string_length.load(std::memory_order_relaxed);
+    limits.max_nodes = max_nodes.load(std::memory_order_relaxed);
+
+    return limits;
+}
+
+JsonParseRejectionStats get_json_parse_rejection_stats() {
+    JsonParseRejectionStats stats;
+    stats.too_many_bytes = too_many_bytes.load(std::memory_order_relaxed);
+    stats.too_deep = too_deep.load(std::memory_order_relaxed);
+    stats.string_too_long = string_too_long.load(std::memory_order_relaxed);
+    stats.too_many_nodes = too_many_nodes.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+void set_json_parse_limits(const JsonParseLimits& limits) {
+    max_bytes.store(limits.max_bytes, std::memory_order_relaxed);
+    max_depth.store(limits.max_depth, std::memory_order_relaxed);
+    max_string_length.store(limits.max_string_length, std::memory_order_relaxed);
+    max_nodes.store(limits.max_nodes, std::memory_order_relaxed);
+}
+
+bool is_within_json_byte_limit(std::size_t size) {
+    const std::size_t limit = max_bytes.load(std::memory_order_relaxed);
+
+    if (limit == 0 || size <= limit) {
+        return true;
+    }
+
+    record_json_parse_rejection(JsonParseLimit::Bytes);
+    return false;
+}
+
+void record_json_parse_rejection(JsonParseLimit limit) {
+    switch (limit) {
+        case JsonParseLimit::Bytes:
+            too_many_bytes.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case JsonParseLimit::Depth:
+            too_deep.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case JsonParseLimit::StringLength:
+            string_too_long.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case JsonParseLimit::Nodes:
+            too_many_nodes.fetch_add(1, std::memory_order_relaxed);
+            break;
+    }
+}
+
+}
@@ -0,0 +1,170 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JsonParser.hpp"
+
+#include "JsonParseLimiter.hpp"
+#include "rapidjson/encodedstream.h"
+#include "rapidjson/memorystream.h"
+#include "rapidjson/reader.h"
+
+using namespace enjin::sdk::json;
+using namespace rapidjson;
+
+namespace {
+
+/// Reads JSON text from a stream into a document through the parse limits, leaving the document unchanged if the text
+/// is not valid JSON or exceeds a limit.
+template<unsigned ParseFlags, class Stream>
+bool read_document(Document& document, Stream& stream) {
+    bool is_valid = false;
+    auto generator = [&stream, &is_valid](Document& handler) {
+        JsonParseLimiter<Document> limiter(handler);
+        Reader reader;
+
+        is_valid = !reader.Parse<ParseFlags>(stream, limiter).IsError();
+        return is_valid;
+    };
+
+    document.Populate(generator);
+    return is_valid;
+}
+
+/// Forwards events to a document while recording the sources of its objects, at the positions a stream is at after
+/// each event plus the offset of the stream within its text.
+template<class Stream>
+class SourceRecordingHandler final : public BaseReaderHandler<UTF8<>, SourceRecordingHandler<Stream>> {
+public:
+    SourceRecordingHandler(Document& document, JsonSourceRecorder& recorder, const Stream& stream, std::size_t offset)
+            : document(document),
+              recorder(recorder),
+              stream(stream),
+              offset(offset) {
+    }
+
+    bool Null() {
+        return document.Null();
+    }
+
+    bool Bool(bool b) {
+        return document.Bool(b);
+    }
+
+    bool Int(int i) {
+        return document.Int(i);
+    }
+
+    bool Uint(unsigned u) {
+        return document.Uint(u);
+    }
+
+    bool Int64(int64_t i) {
+        return document.Int64(i);
+    }
+
+    bool Uint64(uint64_t u) {
+        return document.Uint64(u);
+    }
+
+    bool Double(double d) {
+        return document.Double(d);
+    }
+
+    bool String(const char* str, SizeType length, bool copy) {
+        return document.String(str, length, copy);
+    }
+
+    bool StartObject() {
+        recorder.start_object(offset + stream.Tell());
+        return document.StartObject();
+    }
+
+    bool Key(const char* str, SizeType length, bool copy) {
+        recorder.key(std::string_view(str, length));
+        return document.Key(str, length, copy);
+    }
+
+    bool EndObject(SizeType member_count) {
+        recorder.end(offset + stream.Tell());
+        return document.EndObject(member_count);
+    }
+
+    bool StartArray() {
+        recorder.start_array(offset + stream.Tell());
+        return document.StartArray();
+    }
+
+    bool EndArray(SizeType element_count) {
+        recorder.end(offset + stream.Tell());
+        return document.EndArray(element_count);
+    }
+
+private:
+    Document& document;
+    JsonSourceRecorder& recorder;
+    const Stream& stream;
+    const std::size_t offset;
+};
+
+}
+
+namespace enjin::sdk::json {
+
+bool parse_document(Document& document, std::string_view raw) {
+    if (!is_within_json_byte_limit(raw.size())) {
+        return false;
+    }
+
+    MemoryStream memory_stream(raw.data(), raw.size());
+    EncodedInputStream<UTF8<>, MemoryStream> stream(memory_stream);
+
+    return read_document<kParseDefaultFlags>(document, stream);
+}
+
+bool parse_document_in_situ(Document& document, std::string& raw) {
+    if (!is_within_json_byte_limit(raw.size())) {
+        return false;
+    }
+
+    InsituStringStream stream(raw.data());
+
+    return read_document<kParseInsituFlag>(document, stream);
+}
+
+bool parse_document_span(Document& document, JsonSourceRecorder& recorder, JsonSpan span) {
+    if (!is_within_json_byte_limit(span.length)) {
+        return false;
+    }
+
+    MemoryStream memory_stream(recorder.get_text()->data() + span.offset, span.length);
+    EncodedInputStream<UTF8<>, MemoryStream> stream(memory_stream);
+    bool is_valid = false;
+    auto generator = [&recorder, &span, &stream, &is_valid](Document& handler) {
+        SourceRecordingHandler<EncodedInputStream<UTF8<>, MemoryStream>> recording(handler,
+                                                                                   recorder,
+                                                                                   stream,
+                                                                                   span.offset);
+        JsonParseLimiter<decltype(recording)> limiter(recording);
+        Reader reader;
+
+        is_valid = !reader.Parse<kParseDefaultFlags>(stream, limiter).IsError();
+        return is_valid;
+    };
+
+    document.Populate(generator);
+    return is_valid;
+}
+
+}
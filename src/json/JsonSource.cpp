@@ -0,0 +1,128 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JsonSource.hpp"
+
+#include <algorithm>
+
+using namespace enjin::sdk::json;
+
+JsonSource::JsonSource(std::shared_ptr<const std::string> text) : text(std::move(text)) {
+}
+
+const std::shared_ptr<const std::string>& JsonSource::get_text() const {
+    return text;
+}
+
+bool JsonSource::try_get_member(std::string_view key, JsonSpan& out) const {
+    const auto member = std::find_if(members.begin(), members.end(), [key](const auto& member) {
+        return member.first == key;
+    });
+
+    if (member == members.end()) {
+        return false;
+    }
+
+    out = member->second;
+    return true;
+}
+
+void JsonSource::add_member(std::string_view key, JsonSpan span) {
+    members.emplace_back(key, span);
+}
+
+void JsonSource::clear_members() {
+    members.clear();
+}
+
+JsonView JsonSource::create_view(const rapidjson::Value& value, const JsonSource* source) {
+    return {static_cast<const void*>(&value), source};
+}
+
+const JsonSource* JsonSource::get(const JsonView& view) {
+    return view.source;
+}
+
+JsonSourceRecorder::JsonSourceRecorder(std::shared_ptr<const std::string> text, std::size_t object_depth)
+        : text(std::move(text)),
+          object_depth(object_depth) {
+}
+
+void JsonSourceRecorder::start_object(std::size_t position) {
+    start(position, true);
+}
+
+void JsonSourceRecorder::start_array(std::size_t position) {
+    start(position, false);
+}
+
+void JsonSourceRecorder::key(std::string_view key) {
+    if (is_in_object && depth == object_depth + 1) {
+        member_key.assign(key);
+    }
+}
+
+void JsonSourceRecorder::end(std::size_t position) {
+    depth--;
+
+    if (!is_in_object) {
+        return;
+    }
+
+    if (depth == object_depth + 1) {
+        sources[source_count - 1].add_member(member_key, {member_offset, position - member_offset});
+    } else if (depth == object_depth) {
+        is_in_object = false;
+    }
+}
+
+const std::shared_ptr<const std::string>& JsonSourceRecorder::get_text() const {
+    return text;
+}
+
+std::size_t JsonSourceRecorder::get_source_count() const {
+    return source_count;
+}
+
+const JsonSource& JsonSourceRecorder::get_source(std::size_t index) const {
+    return sources[index];
+}
+
+void JsonSourceRecorder::clear() {
+    source_count = 0;
+    depth = 0;
+    is_in_object = false;
+}
+
+void JsonSourceRecorder::start(std::size_t position, bool is_object) {
+    if (depth == object_depth) {
+        is_in_object = is_object;
+
+        if (is_object) {
+            // Reuses the storage of the sources of earlier values read with this recorder
+            if (source_count == sources.size()) {
+                sources.emplace_back(text);
+            } else {
+                sources[source_count].clear_members();
+            }
+
+            source_count++;
+        }
+    } else if (is_in_object && depth == object_depth + 1) {
+        member_offset = position - 1;
+    }
+
+    depth++;
+}
@@ -15,540 +15,514 @@
 
 #include "enjinsdk/JsonValue.hpp"
 
+#include "enjinsdk/JsonView.hpp"
+
+#include "JsonParser.hpp"
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
+#include <functional>
+#include <new>
 #include <utility>
 
 using namespace enjin::sdk::json;
 using namespace rapidjson;
 
-class JsonValue::Impl final {
-public:
-    Impl() = delete;
-
-    explicit Impl(Type type) : document(std::make_unique<Document>(type)) {
-    }
-
-    Impl(const Impl& other) {
-        const Type type = other.document->GetType();
-
-        document = std::make_unique<Document>(type);
-        document->CopyFrom(*other.document, document->GetAllocator());
-    }
-
-    Impl(Impl&&) = default;
+namespace {
 
-    ~Impl() = default;
+/// Size of the buffer backing the allocator which short strings are set with, which they never take memory from.
+constexpr std::size_t InlineAllocatorBufferSize = 256;
 
-    [[nodiscard]] std::set<std::string> get_object_field_keys() const {
-        std::set<std::string> keys;
+/// Copies a node into another, copying every string so that the copy never points into the text a document was
+/// parsed in place from.
+void copy_node(Value& to, const Value& from, Document::AllocatorType& allocator) {
+    switch (from.GetType()) {
+        case kObjectType:
+            to.SetObject();
 
-        if (is_object()) {
-            for (const auto& member: document->GetObject()) {
-                std::string key(member.name.GetString());
-                keys.emplace(std::move(key));
+            for (const auto& member: from.GetObject()) {
+                Value name(member.name.GetString(), member.name.GetStringLength(), allocator);
+                Value value;
+                copy_node(value, member.value, allocator);
+                to.AddMember(name, value, allocator);
             }
-        }
 
-        return keys;
-    }
-
-    [[nodiscard]] bool has_object_field(const std::string& key) const {
-        return is_object() && document->HasMember(key.c_str());
-    }
+            break;
 
-    [[nodiscard]] bool is_array() const {
-        return document->IsArray();
-    }
-
-    [[nodiscard]] bool is_bool() const {
-        return document->IsBool();
-    }
-
-    [[nodiscard]] bool is_double() const {
-        return document->IsDouble();
-    }
-
-    [[nodiscard]] bool is_float() const {
-        return document->IsFloat();
-    }
-
-    [[nodiscard]] bool is_int() const {
-        return document->IsInt();
-    }
-
-    [[nodiscard]] bool is_int64() const {
-        return document->IsInt64();
-    }
-
-    [[nodiscard]] bool is_null() const {
-        return document->IsNull();
-    }
+        case kArrayType:
+            to.SetArray();
+            to.Reserve(from.Size(), allocator);
 
-    [[nodiscard]] bool is_number() const {
-        return document->IsNumber();
-    }
-
-    [[nodiscard]] bool is_object() const {
-        return document->IsObject();
-    }
-
-    [[nodiscard]] bool is_string() const {
-        return document->IsString();
-    }
-
-    [[nodiscard]] std::string to_string() const {
-        StringBuffer buffer;
-        Writer<StringBuffer> writer(buffer);
-        document->Accept(writer);
-
-        return {buffer.GetString()};
-    }
-
-    bool try_clear_array() {
-        if (!is_array()) {
-            return false;
-        }
+            for (const auto& element: from.GetArray()) {
+                Value value;
+                copy_node(value, element, allocator);
+                to.PushBack(value, allocator);
+            }
 
-        document->Clear();
-        return true;
-    }
+            break;
 
-    bool try_clear_object() {
-        if (!is_object()) {
-            return false;
-        }
+        case kStringType:
+            to.SetString(from.GetString(), from.GetStringLength(), allocator);
+            break;
 
-        document->RemoveAllMembers();
-        return true;
+        default:
+            to.CopyFrom(from, allocator);
+            break;
     }
+}
 
-    bool try_get_array(std::vector<JsonValue>& out) const {
-        if (!is_array()) {
-            return false;
-        }
-
-        out.clear();
-
-        for (const auto& v: document->GetArray()) {
-            switch (v.GetType()) {
-                case kArrayType:
-                    out.push_back(create_value_from_array(v));
-                    break;
-
-                case kFalseType:
-                case kTrueType:
-                    out.push_back(create_value_from_bool(v));
-                    break;
-
-                case kNullType:
-                    out.push_back(JsonValue::create_null());
-                    break;
+/// Determines whether a string node holds its characters inside itself rather than pointing to them.
+bool is_held_in_node(const Value& node) {
+    const auto* begin = reinterpret_cast<const char*>(&node);
+    const char* string = node.GetString();
 
-                case kNumberType:
-                    out.push_back(create_value_from_number(v));
-                    break;
+    return !std::less<const char*>()(string, begin) && std::less<const char*>()(string, begin + sizeof(Value));
+}
 
-                case kObjectType:
-                    out.push_back(create_value_from_object(v));
-                    break;
+/// Returns the length of the longest string which rapidjson holds inside the node itself.
+SizeType get_max_inline_string_length() {
+    static const SizeType max_length = [] {
+        alignas(std::max_align_t) char buffer[InlineAllocatorBufferSize];
+        MemoryPoolAllocator<> allocator(buffer, sizeof(buffer));
+        const std::string probe(sizeof(Value), 'x');
 
-                case kStringType:
-                    out.push_back(create_value_from_string(v));
-                    break;
+        SizeType length = 0;
+        while (length < probe.size()) {
+            Value node(probe.c_str(), length + 1, allocator);
+            if (!is_held_in_node(node)) {
+                break;
             }
-        }
-
-        return true;
-    }
 
-    bool try_get_bool(bool& out) const {
-        if (!is_bool()) {
-            return false;
+            length++;
         }
 
-        out = document->GetBool();
-        return true;
-    }
+        return length;
+    }();
 
-    bool try_get_number(double& out) const {
-        if (!is_double()) {
-            return false;
-        }
-
-        out = document->GetDouble();
-        return true;
-    }
+    return max_length;
+}
 
-    bool try_get_number(float& out) const {
-        if (!is_float()) {
+/// Determines whether a node can be held inline by a value, which is when copying it needs no memory.
+bool is_inlinable(const Value& node) {
+    switch (node.GetType()) {
+        case kObjectType:
+        case kArrayType:
             return false;
-        }
 
-        out = document->GetFloat();
-        return true;
-    }
+        case kStringType:
+            return node.GetStringLength() <= get_max_inline_string_length();
 
-    bool try_get_number(int& out) const {
-        if (!is_int()) {
-            return false;
-        }
-
-        out = document->GetInt();
-        return true;
+        default:
+            return true;
     }
+}
 
-    bool try_get_number(long& out) const {
-        if (!is_number()) {
-            return false;
-        }
-
-        out = document->GetInt64();
-        return true;
-    }
-
-    bool try_get_object_field(const std::string& key, JsonValue& out) const {
-        if (!is_object()) {
-            return false;
-        }
-
-        if (document->HasMember(key.c_str())) {
-            Document& outDocument = *out.pimpl->document;
-            const Value& v = document->operator[](key.c_str());
-
-            outDocument.CopyFrom(v, outDocument.GetAllocator());
-        } else {
-            out.pimpl->document = std::make_unique<Document>(kNullType);
-        }
+}
 
-        return true;
-    }
+class JsonValue::Impl final {
+public:
+    Document document;
 
-    bool try_get_string(std::string& out) const {
-        if (!is_string()) {
-            return false;
-        }
+    Impl() = default;
 
-        out = std::string(document->GetString());
-        return true;
+    explicit Impl(Type type) : document(type) {
     }
 
-    bool try_parse_as_object(const std::string& raw) {
-        Document new_document;
-
-        new_document.Parse(raw.c_str());
-        if (!new_document.IsObject()) {
-            return false;
-        }
-
-        document->CopyFrom(new_document, document->GetAllocator());
-        return true;
+    explicit Impl(const Value& node) {
+        copy_node(document, node, document.GetAllocator());
     }
 
-    bool try_remove_object_field(const std::string& key) {
-        if (!is_object()) {
-            return false;
-        }
+    Impl(const Impl&) = delete;
 
-        return document->RemoveMember(key.c_str());
-    }
+    Impl(Impl&&) = delete;
 
-    bool try_set_array_element(const JsonValue& el) {
-        if (!is_array()) {
-            return false;
-        }
+    ~Impl() = default;
 
-        Document::AllocatorType& allocator = document->GetAllocator();
+    Impl& operator=(const Impl&) = delete;
 
-        Value v;
-        v.CopyFrom(*el.pimpl->document, allocator);
+    Impl& operator=(Impl&&) = delete;
 
-        document->PushBack(v, allocator);
-        return true;
+    static Value& get_inline_node(JsonValue& value) {
+        return *std::launder(reinterpret_cast<Value*>(value.inline_node));
     }
 
-    bool try_set_bool(bool value) {
-        if (!is_bool()) {
-            return false;
-        }
-
-        document->SetBool(value);
-        return true;
+    static const Value& get_inline_node(const JsonValue& value) {
+        return *std::launder(reinterpret_cast<const Value*>(value.inline_node));
     }
 
-    bool try_set_number(double value) {
-        if (!is_double()) {
-            return false;
-        }
-
-        document->SetDouble(value);
-        return true;
+    static const Value& get_node(const JsonValue& value) {
+        return value.pimpl
+               ? value.pimpl->document
+               : get_inline_node(value);
     }
 
-    bool try_set_number(float value) {
-        if (!is_float()) {
-            return false;
+    static Value& get_mutable_node(JsonValue& value) {
+        if (value.pimpl) {
+            return get_own_document(value);
         }
 
-        document->SetFloat(value);
-        return true;
+        return get_inline_node(value);
     }
 
-    bool try_set_number(int value) {
-        if (!is_int()) {
-            return false;
+    /// \brief Returns the document of a value for modifying it, first copying the document if other values share it.
+    static Document& get_own_document(JsonValue& value) {
+        if (value.pimpl.use_count() > 1) {
+            value.pimpl = std::make_shared<Impl>(value.pimpl->document);
         }
 
-        document->SetInt(value);
-        return true;
+        return value.pimpl->document;
     }
 
-    bool try_set_number(long value) {
-        if (!is_int64()) {
-            return false;
+    /// \brief Sets a value to a copy of the given node, holding it inline if it can be.
+    static void set_node(JsonValue& value, const Value& node) {
+        if (is_inlinable(node)) {
+            set_inline_node(value, node);
+            value.pimpl.reset();
+        } else {
+            value.pimpl = std::make_shared<Impl>(node);
+            get_inline_node(value).SetNull();
         }
-
-        document->SetInt64(value);
-        return true;
     }
 
-    bool try_set_object_field(const std::string& key, const JsonValue& value) {
-        if (!is_object()) {
-            return false;
-        }
+    /// \brief Sets the inline node of a value to a copy of the given null, boolean, number or short string node.
+    static void set_inline_node(JsonValue& value, const Value& node) {
+        // None of these nodes take memory from the allocator, which is only here to satisfy rapidjson's interface
+        alignas(std::max_align_t) char buffer[InlineAllocatorBufferSize];
+        MemoryPoolAllocator<> allocator(buffer, sizeof(buffer));
+        Value& inline_node = get_inline_node(value);
 
-        Document::AllocatorType& allocator = document->GetAllocator();
-
-        if (document->HasMember(key.c_str())) {
-            document->RemoveMember(key.c_str());
-        }
-
-        Value k(key.c_str(), allocator);
-        Value v;
-        v.CopyFrom(*value.pimpl->document, allocator);
-
-        document->AddMember(std::move(k), std::move(v), allocator);
-        return true;
-    }
-
-    bool try_set_string(const std::string& value) {
-        if (!is_string()) {
-            return false;
+        if (node.IsString()) {
+            inline_node.SetString(node.GetString(), node.GetStringLength(), allocator);
+        } else {
+            inline_node.CopyFrom(node, allocator);
         }
-
-        document->SetString(value.c_str(), document->GetAllocator());
-        return true;
-    }
-
-    bool operator==(const Impl& rhs) const {
-        return *document == *rhs.document;
     }
 
-    bool operator!=(const Impl& rhs) const {
-        return !(*this == rhs);
-    }
-
-    Impl& operator=(const Impl& rhs) {
-        const Type type = rhs.document->GetType();
-
-        document = std::make_unique<Document>(type);
-        document->CopyFrom(*rhs.document, document->GetAllocator());
+    static void set_string(JsonValue& value, const std::string& string) {
+        const auto length = static_cast<SizeType>(string.size());
 
-        return *this;
-    }
-
-private:
-    std::unique_ptr<Document> document;
-
-    static JsonValue create_value_from_array(const Value& value) {
-        JsonValue json_value = JsonValue::create_array();
-
-        Document& document = *json_value.pimpl->document;
-        document.CopyFrom(value, document.GetAllocator());
-        return json_value;
-    }
-
-    static JsonValue create_value_from_bool(const Value& value) {
-        JsonValue json_value = JsonValue::create_bool();
-
-        Document& document = *json_value.pimpl->document;
-        document.CopyFrom(value, document.GetAllocator());
-        return json_value;
-    }
-
-    static JsonValue create_value_from_number(const Value& value) {
-        JsonValue json_value = JsonValue::create_number();
+        if (length <= get_max_inline_string_length()) {
+            set_inline_node(value, Value(string.c_str(), length));
+            value.pimpl.reset();
+            return;
+        }
 
-        Document& document = *json_value.pimpl->document;
-        document.CopyFrom(value, document.GetAllocator());
-        return json_value;
+        auto impl = std::make_shared<Impl>();
+        impl->document.SetString(string.c_str(), length, impl->document.GetAllocator());
+        value.pimpl = std::move(impl);
+        get_inline_node(value).SetNull();
     }
 
-    static JsonValue create_value_from_object(const Value& value) {
-        JsonValue json_value = JsonValue::create_object();
+    static_assert(sizeof(Value) <= InlineNodeSize && alignof(Value) <= 8,
+                  "A rapidjson value does not fit the inline storage of JsonValue.");
+};
 
-        Document& document = *json_value.pimpl->document;
-        document.CopyFrom(value, document.GetAllocator());
-        return json_value;
-    }
+JsonValue::JsonValue() {
+    new(inline_node) Value();
+}
 
-    static JsonValue create_value_from_string(const Value& value) {
-        JsonValue json_value = JsonValue::create_string();
+JsonValue::JsonValue(const JsonValue& other) : pimpl(other.pimpl) {
+    new(inline_node) Value();
 
-        Document& document = *json_value.pimpl->document;
-        document.CopyFrom(value, document.GetAllocator());
-        return json_value;
+    if (!pimpl) {
+        Impl::set_inline_node(*this, Impl::get_inline_node(other));
     }
-};
-
-JsonValue::JsonValue() : pimpl(std::make_unique<Impl>(kNullType)) {
 }
 
-JsonValue::JsonValue(std::unique_ptr<Impl> ptr) : pimpl(std::move(ptr)) {
+JsonValue::JsonValue(JsonValue&& other) noexcept: pimpl(std::move(other.pimpl)) {
+    new(inline_node) Value(std::move(Impl::get_inline_node(other)));
 }
 
-JsonValue::JsonValue(const JsonValue& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+JsonValue::~JsonValue() {
+    Impl::get_inline_node(*this).~Value();
 }
 
-JsonValue::JsonValue(JsonValue&& other) noexcept = default;
+std::set<std::string> JsonValue::get_object_field_keys() const {
+    std::set<std::string> keys;
 
-JsonValue::~JsonValue() = default;
+    if (is_object()) {
+        for (const auto& member: Impl::get_node(*this).GetObject()) {
+            std::string key(member.name.GetString());
+            keys.emplace(std::move(key));
+        }
+    }
 
-std::set<std::string> JsonValue::get_object_field_keys() const {
-    return pimpl->get_object_field_keys();
+    return keys;
 }
 
 bool JsonValue::has_object_field(const std::string& key) const {
-    return pimpl->has_object_field(key);
+    return is_object() && Impl::get_node(*this).HasMember(key.c_str());
 }
 
 bool JsonValue::is_array() const {
-    return pimpl->is_array();
+    return Impl::get_node(*this).IsArray();
 }
 
 bool JsonValue::is_bool() const {
-    return pimpl->is_bool();
+    return Impl::get_node(*this).IsBool();
 }
 
 bool JsonValue::is_double() const {
-    return pimpl->is_double();
+    return Impl::get_node(*this).IsDouble();
 }
 
 bool JsonValue::is_float() const {
-    return pimpl->is_float();
+    return Impl::get_node(*this).IsFloat();
 }
 
 bool JsonValue::is_int() const {
-    return pimpl->is_int();
+    return Impl::get_node(*this).IsInt();
 }
 
 bool JsonValue::is_int64() const {
-    return pimpl->is_int64();
+    return Impl::get_node(*this).IsInt64();
 }
 
 bool JsonValue::is_null() const {
-    return pimpl->is_null();
+    return Impl::get_node(*this).IsNull();
 }
 
 bool JsonValue::is_number() const {
-    return pimpl->is_number();
+    return Impl::get_node(*this).IsNumber();
 }
 
 bool JsonValue::is_object() const {
-    return pimpl->is_object();
+    return Impl::get_node(*this).IsObject();
 }
 
 bool JsonValue::is_string() const {
-    return pimpl->is_string();
+    return Impl::get_node(*this).IsString();
 }
 
 std::string JsonValue::to_string() const {
-    return pimpl->to_string();
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    Impl::get_node(*this).Accept(writer);
+
+    return {buffer.GetString()};
 }
 
 bool JsonValue::try_clear_array() {
-    return pimpl->try_clear_array();
+    if (!is_array()) {
+        return false;
+    }
+
+    Impl::get_own_document(*this).Clear();
+    return true;
 }
 
 bool JsonValue::try_clear_object() {
-    return pimpl->try_clear_object();
+    if (!is_object()) {
+        return false;
+    }
+
+    Impl::get_own_document(*this).RemoveAllMembers();
+    return true;
 }
 
 bool JsonValue::try_get_array(std::vector<JsonValue>& out) const {
-    return pimpl->try_get_array(out);
+    if (!is_array()) {
+        return false;
+    }
+
+    const Value& node = Impl::get_node(*this);
+
+    out.clear();
+    out.reserve(node.Size());
+
+    for (const auto& v: node.GetArray()) {
+        out.push_back(create_from_node(&v));
+    }
+
+    return true;
 }
 
 bool JsonValue::try_get_bool(bool& out) const {
-    return pimpl->try_get_bool(out);
+    if (!is_bool()) {
+        return false;
+    }
+
+    out = Impl::get_node(*this).GetBool();
+    return true;
 }
 
 bool JsonValue::try_get_number(double& out) const {
-    return pimpl->try_get_number(out);
+    if (!is_double()) {
+        return false;
+    }
+
+    out = Impl::get_node(*this).GetDouble();
+    return true;
 }
 
 bool JsonValue::try_get_number(float& out) const {
-    return pimpl->try_get_number(out);
+    if (!is_float()) {
+        return false;
+    }
+
+    out = Impl::get_node(*this).GetFloat();
+    return true;
 }
 
 bool JsonValue::try_get_number(int& out) const {
-    return pimpl->try_get_number(out);
+    if (!is_int()) {
+        return false;
+    }
+
+    out = Impl::get_node(*this).GetInt();
+    return true;
 }
 
 bool JsonValue::try_get_number(long& out) const {
-    return pimpl->try_get_number(out);
+    if (!is_number()) {
+        return false;
+    }
+
+    out = Impl::get_node(*this).GetInt64();
+    return true;
 }
 
 bool JsonValue::try_get_object_field(const std::string& key, JsonValue& out) const {
-    return pimpl->try_get_object_field(key, out);
+    if (!is_object()) {
+        return false;
+    }
+
+    const Value& node = Impl::get_node(*this);
+    auto member = node.FindMember(key.c_str());
+
+    // Copies the field before assigning it, since the out parameter may be this value itself
+    out = member != node.MemberEnd()
+          ? create_from_node(&member->value)
+          : JsonValue();
+
+    return true;
+}
+
+bool JsonValue::try_get_object_field(const std::string& key, JsonView& out) const {
+    return JsonView(*this).try_get_object_field(key, out);
 }
 
 bool JsonValue::try_remove_object_field(const std::string& key) {
-    return pimpl->try_remove_object_field(key);
+    if (!is_object()) {
+        return false;
+    }
+
+    return Impl::get_own_document(*this).RemoveMember(key.c_str());
 }
 
 bool JsonValue::try_get_string(std::string& out) const {
-    return pimpl->try_get_string(out);
+    if (!is_string()) {
+        return false;
+    }
+
+    out = std::string(Impl::get_node(*this).GetString());
+    return true;
 }
 
 bool JsonValue::try_parse_as_object(const std::string& raw) {
-    return pimpl->try_parse_as_object(raw);
+    auto impl = std::make_shared<Impl>();
+
+    if (!parse_document(impl->document, raw) || !impl->document.IsObject()) {
+        return false;
+    }
+
+    // Takes over the parsed document rather than deep copying it
+    pimpl = std::move(impl);
+    Impl::get_inline_node(*this).SetNull();
+    return true;
 }
 
 bool JsonValue::try_set_array_element(const JsonValue& el) {
-    return pimpl->try_set_array_element(el);
+    if (!is_array()) {
+        return false;
+    }
+
+    Document& document = Impl::get_own_document(*this);
+    Document::AllocatorType& allocator = document.GetAllocator();
+
+    Value v;
+    copy_node(v, Impl::get_node(el), allocator);
+
+    document.PushBack(v, allocator);
+    return true;
 }
 
 bool JsonValue::try_set_bool(bool value) {
-    return pimpl->try_set_bool(value);
+    if (!is_bool()) {
+        return false;
+    }
+
+    Impl::get_mutable_node(*this).SetBool(value);
+    return true;
 }
 
 bool JsonValue::try_set_number(double value) {
-    return pimpl->try_set_number(value);
+    if (!is_double()) {
+        return false;
+    }
+
+    Impl::get_mutable_node(*this).SetDouble(value);
+    return true;
 }
 
 bool JsonValue::try_set_number(float value) {
-    return pimpl->try_set_number(value);
+    if (!is_float()) {
+        return false;
+    }
+
+    Impl::get_mutable_node(*this).SetFloat(value);
+    return true;
 }
 
 bool JsonValue::try_set_number(int value) {
-    return pimpl->try_set_number(value);
+    if (!is_int()) {
+        return false;
+    }
+
+    Impl::get_mutable_node(*this).SetInt(value);
+    return true;
 }
 
 bool JsonValue::try_set_number(long value) {
-    return pimpl->try_set_number(value);
+    if (!is_int64()) {
+        return false;
+    }
+
+    Impl::get_mutable_node(*this).SetInt64(value);
+    return true;
 }
 
 bool JsonValue::try_set_object_field(const std::string& key, const JsonValue& value) {
-    return pimpl->try_set_object_field(key, value);
+    if (!is_object()) {
+        return false;
+    }
+
+    Document& document = Impl::get_own_document(*this);
+    Document::AllocatorType& allocator = document.GetAllocator();
+
+    Value k(key.c_str(), static_cast<SizeType>(key.size()), allocator);
+    Value v;
+    copy_node(v, Impl::get_node(value), allocator);
+
+    if (document.HasMember(key.c_str())) {
+        document.RemoveMember(key.c_str());
+    }
+
+    document.AddMember(k, v, allocator);
+    return true;
 }
 
 bool JsonValue::try_set_string(const std::string& value) {
-    return pimpl->try_set_string(value);
+    if (!is_string()) {
+        return false;
+    }
+
+    Impl::set_string(*this, value);
+    return true;
 }
 
 bool JsonValue::operator==(const JsonValue& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return Impl::get_node(*this) == Impl::get_node(rhs);
 }
 
 bool JsonValue::operator!=(const JsonValue& rhs) const {
@@ -556,30 +530,66 @@ bool JsonValue::operator!=(const JsonValue& rhs) const {
 }
 
 JsonValue& JsonValue::operator=(const JsonValue& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    if (this == &rhs) {
+        return *this;
+    }
+
+    if (rhs.pimpl) {
+        Impl::get_inline_node(*this).SetNull();
+    } else {
+        Impl::set_inline_node(*this, Impl::get_inline_node(rhs));
+    }
+
+    pimpl = rhs.pimpl;
     return *this;
 }
 
+const void* JsonValue::get_node() const {
+    return &Impl::get_node(*this);
+}
+
+JsonValue JsonValue::create_from_node(const void* node) {
+    JsonValue value;
+    Impl::set_node(value, *static_cast<const Value*>(node));
+
+    return value;
+}
+
 JsonValue JsonValue::create_array() {
-    return JsonValue(std::make_unique<Impl>(kArrayType));
+    JsonValue value;
+    value.pimpl = std::make_shared<Impl>(kArrayType);
+
+    return value;
 }
 
 JsonValue JsonValue::create_bool() {
-    return JsonValue(std::make_unique<Impl>(kFalseType));
+    JsonValue value;
+    Impl::get_inline_node(value).SetBool(false);
+
+    return value;
 }
 
 JsonValue JsonValue::create_null() {
-    return JsonValue(std::make_unique<Impl>(kNullType));
+    return {};
 }
 
 JsonValue JsonValue::create_number() {
-    return JsonValue(std::make_unique<Impl>(kNumberType));
+    JsonValue value;
+    Impl::get_inline_node(value) = Value(kNumberType);
+
+    return value;
 }
 
 JsonValue JsonValue::create_object() {
-    return JsonValue(std::make_unique<Impl>(kObjectType));
+    JsonValue value;
+    value.pimpl = std::make_shared<Impl>(kObjectType);
+
+    return value;
 }
 
 JsonValue JsonValue::create_string() {
-    return JsonValue(std::make_unique<Impl>(kStringType));
+    JsonValue value;
+    Impl::get_inline_node(value) = Value(kStringType);
+
+    return value;
 }
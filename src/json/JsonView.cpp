@@ -0,0 +1,274 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/JsonView.hpp"
+
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+using namespace enjin::sdk::json;
+using namespace rapidjson;
+
+namespace {
+
+const Value NULL_VALUE;
+
+const Value& as_value(const void* node) {
+    return *static_cast<const Value*>(node);
+}
+
+const Value::Member& as_member(const void* node) {
+    return *static_cast<const Value::Member*>(node);
+}
+
+}
+
+JsonView::ElementIterator::ElementIterator(const void* element) : element(element) {
+}
+
+JsonView JsonView::ElementIterator::operator*() const {
+    return JsonView(element);
+}
+
+JsonView::ElementIterator& JsonView::ElementIterator::operator++() {
+    element = &as_value(element) + 1;
+    return *this;
+}
+
+JsonView::ElementIterator JsonView::ElementIterator::operator++(int) {
+    ElementIterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+bool JsonView::ElementIterator::operator==(const ElementIterator& rhs) const {
+    return element == rhs.element;
+}
+
+bool JsonView::ElementIterator::operator!=(const ElementIterator& rhs) const {
+    return !(*this == rhs);
+}
+
+JsonView::MemberIterator::MemberIterator(const void* member) : member(member) {
+}
+
+JsonMember JsonView::MemberIterator::operator*() const {
+    const Value::Member& m = as_member(member);
+    return JsonMember{std::string_view(m.name.GetString(), m.name.GetStringLength()), JsonView(&m.value)};
+}
+
+JsonView::MemberIterator& JsonView::MemberIterator::operator++() {
+    member = &as_member(member) + 1;
+    return *this;
+}
+
+JsonView::MemberIterator JsonView::MemberIterator::operator++(int) {
+    MemberIterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+bool JsonView::MemberIterator::operator==(const MemberIterator& rhs) const {
+    return member == rhs.member;
+}
+
+bool JsonView::MemberIterator::operator!=(const MemberIterator& rhs) const {
+    return !(*this == rhs);
+}
+
+JsonView::JsonView() : node(&NULL_VALUE) {
+}
+
+JsonView::JsonView(const JsonValue& value) : node(value.get_node()) {
+}
+
+JsonView::JsonView(const void* node) : node(node) {
+}
+
+JsonView::JsonView(const void* node, const JsonSource* source) : node(node), source(source) {
+}
+
+JsonView::Range<JsonView::ElementIterator> JsonView::get_array_elements() const {
+    if (!is_array()) {
+        return {ElementIterator(), ElementIterator()};
+    }
+
+    const Value& value = as_value(node);
+    return {ElementIterator(value.Begin()), ElementIterator(value.End())};
+}
+
+JsonView::Range<JsonView::MemberIterator> JsonView::get_object_members() const {
+    const Value& value = as_value(node);
+    if (!value.IsObject() || value.ObjectEmpty()) {
+        return {MemberIterator(), MemberIterator()};
+    }
+
+    const Value::Member* first = &*value.MemberBegin();
+    return {MemberIterator(first), MemberIterator(first + value.MemberCount())};
+}
+
+bool JsonView::has_object_field(const std::string& key) const {
+    const Value& value = as_value(node);
+    return value.IsObject() && value.HasMember(key.c_str());
+}
+
+bool JsonView::is_array() const {
+    return as_value(node).IsArray();
+}
+
+bool JsonView::is_bool() const {
+    return as_value(node).IsBool();
+}
+
+bool JsonView::is_double() const {
+    return as_value(node).IsDouble();
+}
+
+bool JsonView::is_float() const {
+    return as_value(node).IsFloat();
+}
+
+bool JsonView::is_int() const {
+    return as_value(node).IsInt();
+}
+
+bool JsonView::is_int64() const {
+    return as_value(node).IsInt64();
+}
+
+bool JsonView::is_null() const {
+    return as_value(node).IsNull();
+}
+
+bool JsonView::is_number() const {
+    return as_value(node).IsNumber();
+}
+
+bool JsonView::is_object() const {
+    return as_value(node).IsObject();
+}
+
+bool JsonView::is_string() const {
+    return as_value(node).IsString();
+}
+
+std::size_t JsonView::size() const {
+    const Value& value = as_value(node);
+    if (value.IsArray()) {
+        return value.Size();
+    } else if (value.IsObject()) {
+        return value.MemberCount();
+    }
+
+    return 0;
+}
+
+std::string JsonView::to_string() const {
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    as_value(node).Accept(writer);
+
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
+JsonValue JsonView::to_value() const {
+    return JsonValue::create_from_node(node);
+}
+
+bool JsonView::try_get_bool(bool& out) const {
+    if (!is_bool()) {
+        return false;
+    }
+
+    out = as_value(node).GetBool();
+    return true;
+}
+
+bool JsonView::try_get_number(double& out) const {
+    if (!is_double()) {
+        return false;
+    }
+
+    out = as_value(node).GetDouble();
+    return true;
+}
+
+bool JsonView::try_get_number(float& out) const {
+    if (!is_float()) {
+        return false;
+    }
+
+    out = as_value(node).GetFloat();
+    return true;
+}
+
+bool JsonView::try_get_number(int& out) const {
+    if (!is_int()) {
+        return false;
+    }
+
+    out = as_value(node).GetInt();
+    return true;
+}
+
+bool JsonView::try_get_number(long& out) const {
+    if (!is_number()) {
+        return false;
+    }
+
+    out = as_value(node).GetInt64();
+    return true;
+}
+
+bool JsonView::try_get_object_field(const std::string& key, JsonView& out) const {
+    if (!is_object()) {
+        return false;
+    }
+
+    const Value& value = as_value(node);
+    auto iter = value.FindMember(key.c_str());
+    out = JsonView(iter == value.MemberEnd() ? &NULL_VALUE : &iter->value);
+
+    return true;
+}
+
+bool JsonView::try_get_string(std::string& out) const {
+    if (!is_string()) {
+        return false;
+    }
+
+    const Value& value = as_value(node);
+    out.assign(value.GetString(), value.GetStringLength());
+    return true;
+}
+
+bool JsonView::try_get_string(std::string_view& out) const {
+    if (!is_string()) {
+        return false;
+    }
+
+    const Value& value = as_value(node);
+    out = std::string_view(value.GetString(), value.GetStringLength());
+    return true;
+}
+
+bool JsonView::operator==(const JsonView& rhs) const {
+    return as_value(node) == as_value(rhs.node);
+}
+
+bool JsonView::operator!=(const JsonView& rhs) const {
+    return !(*this == rhs);
+}
@@ -0,0 +1,204 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/JsonWriter.hpp"
+
+#include "enjinsdk/JsonValue.hpp"
+
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include <cstddef>
+#include <memory>
+
+using namespace enjin::sdk::json;
+using namespace rapidjson;
+
+class JsonWriter::Impl final {
+public:
+    Impl() : buffer(acquire_buffer()), writer(*buffer) {
+    }
+
+    Impl(const Impl&) = delete;
+
+    Impl(Impl&&) = delete;
+
+    ~Impl() {
+        if (buffer != &thread_buffer) {
+            return;
+        }
+
+        // Keeps the thread's buffer for the next writer unless an unusually large document has grown it
+        const bool is_oversized = thread_buffer.GetSize() > MaxRetainedBufferSize;
+        thread_buffer.Clear();
+        if (is_oversized) {
+            thread_buffer.ShrinkToFit();
+        }
+
+        thread_buffer_in_use = false;
+    }
+
+    void end_array() {
+        writer.EndArray();
+    }
+
+    void end_object() {
+        writer.EndObject();
+    }
+
+    [[nodiscard]] bool is_complete() const {
+        return writer.IsComplete();
+    }
+
+    void start_array() {
+        writer.StartArray();
+    }
+
+    void start_object() {
+        writer.StartObject();
+    }
+
+    [[nodiscard]] std::string to_string() const {
+        return {buffer->GetString(), buffer->GetSize()};
+    }
+
+    void write_bool(bool value) {
+        writer.Bool(value);
+    }
+
+    void write_key(const std::string& key) {
+        writer.Key(key.c_str(), static_cast<SizeType>(key.size()));
+    }
+
+    void write_null() {
+        writer.Null();
+    }
+
+    void write_number(double value) {
+        writer.Double(value);
+    }
+
+    void write_number(float value) {
+        writer.Double(static_cast<double>(value));
+    }
+
+    void write_number(int value) {
+        writer.Int(value);
+    }
+
+    void write_number(long value) {
+        writer.Int64(value);
+    }
+
+    void write_string(const std::string& value) {
+        writer.String(value.c_str(), static_cast<SizeType>(value.size()));
+    }
+
+    void write_value(const Value& value) {
+        value.Accept(writer);
+    }
+
+    Impl& operator=(const Impl&) = delete;
+
+    Impl& operator=(Impl&&) = delete;
+
+private:
+    std::unique_ptr<StringBuffer> own_buffer;
+    StringBuffer* buffer;
+    Writer<StringBuffer> writer;
+
+    static constexpr std::size_t MaxRetainedBufferSize = 1024 * 1024;
+
+    static thread_local StringBuffer thread_buffer;
+    static thread_local bool thread_buffer_in_use;
+
+    StringBuffer* acquire_buffer() {
+        if (thread_buffer_in_use) {
+            own_buffer = std::make_unique<StringBuffer>();
+            return own_buffer.get();
+        }
+
+        thread_buffer_in_use = true;
+        return &thread_buffer;
+    }
+};
+
+thread_local StringBuffer JsonWriter::Impl::thread_buffer;
+thread_local bool JsonWriter::Impl::thread_buffer_in_use = false;
+
+JsonWriter::JsonWriter() : pimpl(std::make_unique<Impl>()) {
+}
+
+JsonWriter::~JsonWriter() = default;
+
+void JsonWriter::end_array() {
+    pimpl->end_array();
+}
+
+void JsonWriter::end_object() {
+    pimpl->end_object();
+}
+
+bool JsonWriter::is_complete() const {
+    return pimpl->is_complete();
+}
+
+void JsonWriter::start_array() {
+    pimpl->start_array();
+}
+
+void JsonWriter::start_object() {
+    pimpl->start_object();
+}
+
+std::string JsonWriter::to_string() const {
+    return pimpl->to_string();
+}
+
+void JsonWriter::write_bool(bool value) {
+    pimpl->write_bool(value);
+}
+
+void JsonWriter::write_key(const std::string& key) {
+    pimpl->write_key(key);
+}
+
+void JsonWriter::write_null() {
+    pimpl->write_null();
+}
+
+void JsonWriter::write_number(double value) {
+    pimpl->write_number(value);
+}
+
+void JsonWriter::write_number(float value) {
+    pimpl->write_number(value);
+}
+
+void JsonWriter::write_number(int value) {
+    pimpl->write_number(value);
+}
+
+void JsonWriter::write_number(long value) {
+    pimpl->write_number(value);
+}
+
+void JsonWriter::write_string(const std::string& value) {
+    pimpl->write_string(value);
+}
+
+void JsonWriter::write_value(const JsonValue& value) {
+    pimpl->write_value(*static_cast<const Value*>(value.get_node()));
+}
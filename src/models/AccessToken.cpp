@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class AccessToken::Impl final : public IDeserializable {
+class AccessToken::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,16 +33,21 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             token.reset();
             expires_in.reset();
 
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "accessToken", token);
-        JsonUtils::try_get_field(json_object, "expiresIn", expires_in);
+        JsonUtils::try_get_field(json, "accessToken", token);
+        JsonUtils::try_get_field(json, "expiresIn", expires_in);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_token() const {
@@ -65,10 +72,10 @@ private:
     std::optional<long> expires_in;
 };
 
-AccessToken::AccessToken() : pimpl(std::make_unique<Impl>()) {
+AccessToken::AccessToken() : pimpl(get_empty_impl<Impl>()) {
 }
 
-AccessToken::AccessToken(const AccessToken& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+AccessToken::AccessToken(const AccessToken& other) : pimpl(other.pimpl) {
 }
 
 AccessToken::AccessToken(AccessToken&& other) noexcept = default;
@@ -76,6 +83,12 @@ AccessToken::AccessToken(AccessToken&& other) noexcept = default;
 AccessToken::~AccessToken() = default;
 
 void AccessToken::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void AccessToken::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -88,14 +101,14 @@ const std::optional<long>& AccessToken::get_expires_in() const {
 }
 
 bool AccessToken::operator==(const AccessToken& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool AccessToken::operator!=(const AccessToken& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 AccessToken& AccessToken::operator=(const AccessToken& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,16 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
+#include "InternedString.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Asset::Impl final : public IDeserializable {
+class Asset::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +34,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             id.reset();
             name.reset();
             state_data.reset();
@@ -45,18 +53,18 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "id", id);
-        JsonUtils::try_get_field(json_object, "name", name);
-        JsonUtils::try_get_field(json_object, "stateData", state_data);
-        JsonUtils::try_get_field(json_object, "configData", config_data);
-        JsonUtils::try_get_field(json_object, "variantMode", variant_mode);
-        JsonUtils::try_get_field(json_object, "variants", variants);
-        JsonUtils::try_get_field(json_object, "createdAt", created_at);
-        JsonUtils::try_get_field(json_object, "updatedAt", updated_at);
+        id.try_get_field(json, "id");
+        JsonUtils::try_get_field(json, "name", name);
+        JsonUtils::try_get_field(json, "stateData", state_data);
+        JsonUtils::try_get_field(json, "configData", config_data);
+        JsonUtils::try_get_field(json, "variantMode", variant_mode);
+        JsonUtils::try_get_field(json, "variants", variants);
+        JsonUtils::try_get_field(json, "createdAt", created_at);
+        JsonUtils::try_get_field(json, "updatedAt", updated_at);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_id() const {
-        return id;
+        return id.get();
     }
 
     [[nodiscard]] const std::optional<std::string>& get_name() const {
@@ -103,7 +111,7 @@ public:
     }
 
 private:
-    std::optional<std::string> id;
+    InternedString id;
     std::optional<std::string> name;
     std::optional<AssetStateData> state_data;
     std::optional<AssetConfigData> config_data;
@@ -113,10 +121,10 @@ private:
     std::optional<std::string> updated_at;
 };
 
-Asset::Asset() : pimpl(std::make_unique<Impl>()) {
+Asset::Asset() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Asset::Asset(const Asset& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Asset::Asset(const Asset& other) : pimpl(other.pimpl) {
 }
 
 Asset::Asset(Asset&& other) noexcept = default;
@@ -124,6 +132,12 @@ Asset::Asset(Asset&& other) noexcept = default;
 Asset::~Asset() = default;
 
 void Asset::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Asset::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -160,14 +174,14 @@ const std::optional<std::string>& Asset::get_updated_at() const {
 }
 
 bool Asset::operator==(const Asset& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Asset::operator!=(const Asset& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Asset& Asset::operator=(const Asset& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
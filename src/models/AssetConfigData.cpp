@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class AssetConfigData::Impl final : public IDeserializable {
+class AssetConfigData::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             melt_fee_ratio.reset();
             melt_fee_max_ratio.reset();
             melt_value.reset();
@@ -43,12 +50,12 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "meltFeeRatio", melt_fee_ratio);
-        JsonUtils::try_get_field(json_object, "meltFeeMaxRatio", melt_fee_max_ratio);
-        JsonUtils::try_get_field(json_object, "meltValue", melt_value);
-        JsonUtils::try_get_field(json_object, "metadataURI", metadata_uri);
-        JsonUtils::try_get_field(json_object, "transferable", transferable);
-        JsonUtils::try_get_field(json_object, "transferFeeSettings", transfer_fee_settings);
+        JsonUtils::try_get_field(json, "meltFeeRatio", melt_fee_ratio);
+        JsonUtils::try_get_field(json, "meltFeeMaxRatio", melt_fee_max_ratio);
+        JsonUtils::try_get_field(json, "meltValue", melt_value);
+        JsonUtils::try_get_field(json, "metadataURI", metadata_uri);
+        JsonUtils::try_get_field(json, "transferable", transferable);
+        JsonUtils::try_get_field(json, "transferFeeSettings", transfer_fee_settings);
     }
 
     [[nodiscard]] const std::optional<int>& get_melt_fee_ratio() const {
@@ -97,10 +104,10 @@ private:
     std::optional<AssetTransferFeeSettings> transfer_fee_settings;
 };
 
-AssetConfigData::AssetConfigData() : pimpl(std::make_unique<Impl>()) {
+AssetConfigData::AssetConfigData() : pimpl(get_empty_impl<Impl>()) {
 }
 
-AssetConfigData::AssetConfigData(const AssetConfigData& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+AssetConfigData::AssetConfigData(const AssetConfigData& other) : pimpl(other.pimpl) {
 }
 
 AssetConfigData::AssetConfigData(AssetConfigData&& other) noexcept = default;
@@ -108,6 +115,12 @@ AssetConfigData::AssetConfigData(AssetConfigData&& other) noexcept = default;
 AssetConfigData::~AssetConfigData() = default;
 
 void AssetConfigData::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void AssetConfigData::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -136,14 +149,14 @@ const std::optional<AssetTransferFeeSettings>& AssetConfigData::get_transfer_fee
 }
 
 bool AssetConfigData::operator==(const AssetConfigData& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool AssetConfigData::operator!=(const AssetConfigData& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 AssetConfigData& AssetConfigData::operator=(const AssetConfigData& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class AssetStateData::Impl final : public IDeserializable {
+class AssetStateData::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             non_fungible.reset();
             block_height.reset();
             creator.reset();
@@ -46,15 +53,15 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "nonFungible", non_fungible);
-        JsonUtils::try_get_field(json_object, "blockHeight", block_height);
-        JsonUtils::try_get_field(json_object, "creator", creator);
-        JsonUtils::try_get_field(json_object, "firstBlock", first_block);
-        JsonUtils::try_get_field(json_object, "reserve", reserve);
-        JsonUtils::try_get_field(json_object, "supplyModel", supply_model);
-        JsonUtils::try_get_field(json_object, "circulatingSupply", circulating_supply);
-        JsonUtils::try_get_field(json_object, "mintableSupply", mintable_supply);
-        JsonUtils::try_get_field(json_object, "totalSupply", total_supply);
+        JsonUtils::try_get_field(json, "nonFungible", non_fungible);
+        JsonUtils::try_get_field(json, "blockHeight", block_height);
+        JsonUtils::try_get_field(json, "creator", creator);
+        JsonUtils::try_get_field(json, "firstBlock", first_block);
+        JsonUtils::try_get_field(json, "reserve", reserve);
+        JsonUtils::try_get_field(json, "supplyModel", supply_model);
+        JsonUtils::try_get_field(json, "circulatingSupply", circulating_supply);
+        JsonUtils::try_get_field(json, "mintableSupply", mintable_supply);
+        JsonUtils::try_get_field(json, "totalSupply", total_supply);
     }
 
     [[nodiscard]] const std::optional<bool>& get_non_fungible() const {
@@ -121,10 +128,10 @@ private:
     std::optional<std::string> total_supply;
 };
 
-AssetStateData::AssetStateData() : pimpl(std::make_unique<Impl>()) {
+AssetStateData::AssetStateData() : pimpl(get_empty_impl<Impl>()) {
 }
 
-AssetStateData::AssetStateData(const AssetStateData& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+AssetStateData::AssetStateData(const AssetStateData& other) : pimpl(other.pimpl) {
 }
 
 AssetStateData::AssetStateData(AssetStateData&& other) noexcept = default;
@@ -132,6 +139,12 @@ AssetStateData::AssetStateData(AssetStateData&& other) noexcept = default;
 AssetStateData::~AssetStateData() = default;
 
 void AssetStateData::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void AssetStateData::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -172,14 +185,14 @@ const std::optional<std::string>& AssetStateData::get_total_supply() const {
 }
 
 bool AssetStateData::operator==(const AssetStateData& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool AssetStateData::operator!=(const AssetStateData& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 AssetStateData& AssetStateData::operator=(const AssetStateData& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
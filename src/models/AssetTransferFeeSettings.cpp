@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class AssetTransferFeeSettings::Impl final : public IDeserializable {
+class AssetTransferFeeSettings::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             type.reset();
             asset_id.reset();
             value.reset();
@@ -40,9 +47,9 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "type", type);
-        JsonUtils::try_get_field(json_object, "assetId", asset_id);
-        JsonUtils::try_get_field(json_object, "value", value);
+        JsonUtils::try_get_field(json, "type", type);
+        JsonUtils::try_get_field(json, "assetId", asset_id);
+        JsonUtils::try_get_field(json, "value", value);
     }
 
     [[nodiscard]] const std::optional<AssetTransferFeeType>& get_type() const {
@@ -73,11 +80,11 @@ private:
     std::optional<std::string> value;
 };
 
-AssetTransferFeeSettings::AssetTransferFeeSettings() : pimpl(std::make_unique<Impl>()) {
+AssetTransferFeeSettings::AssetTransferFeeSettings() : pimpl(get_empty_impl<Impl>()) {
 }
 
 AssetTransferFeeSettings::AssetTransferFeeSettings(const AssetTransferFeeSettings& other)
-        : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+        : pimpl(other.pimpl) {
 }
 
 AssetTransferFeeSettings::AssetTransferFeeSettings(AssetTransferFeeSettings&& other) noexcept = default;
@@ -85,6 +92,12 @@ AssetTransferFeeSettings::AssetTransferFeeSettings(AssetTransferFeeSettings&& ot
 AssetTransferFeeSettings::~AssetTransferFeeSettings() = default;
 
 void AssetTransferFeeSettings::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void AssetTransferFeeSettings::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -101,14 +114,14 @@ const std::optional<std::string>& AssetTransferFeeSettings::get_value() const {
 }
 
 bool AssetTransferFeeSettings::operator==(const AssetTransferFeeSettings& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool AssetTransferFeeSettings::operator!=(const AssetTransferFeeSettings& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 AssetTransferFeeSettings& AssetTransferFeeSettings::operator=(const AssetTransferFeeSettings& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
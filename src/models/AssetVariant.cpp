@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class AssetVariant::Impl final : public IDeserializable {
+class AssetVariant::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             id.reset();
             asset_id.reset();
             variant_metadata.reset();
@@ -43,12 +50,12 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "id", id);
-        JsonUtils::try_get_field(json_object, "assetId", asset_id);
-        JsonUtils::try_get_field(json_object, "variantMetadata", variant_metadata);
-        JsonUtils::try_get_field(json_object, "usageCount", usage_count);
-        JsonUtils::try_get_field(json_object, "createdAt", created_at);
-        JsonUtils::try_get_field(json_object, "updatedAt", updated_at);
+        JsonUtils::try_get_field(json, "id", id);
+        JsonUtils::try_get_field(json, "assetId", asset_id);
+        JsonUtils::try_get_field(json, "variantMetadata", variant_metadata);
+        JsonUtils::try_get_field(json, "usageCount", usage_count);
+        JsonUtils::try_get_field(json, "createdAt", created_at);
+        JsonUtils::try_get_field(json, "updatedAt", updated_at);
     }
 
     [[nodiscard]] const std::optional<int>& get_id() const {
@@ -97,10 +104,10 @@ private:
     std::optional<std::string> updated_at;
 };
 
-AssetVariant::AssetVariant() : pimpl(std::make_unique<Impl>()) {
+AssetVariant::AssetVariant() : pimpl(get_empty_impl<Impl>()) {
 }
 
-AssetVariant::AssetVariant(const AssetVariant& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+AssetVariant::AssetVariant(const AssetVariant& other) : pimpl(other.pimpl) {
 }
 
 AssetVariant::AssetVariant(AssetVariant&& other) noexcept = default;
@@ -108,6 +115,12 @@ AssetVariant::AssetVariant(AssetVariant&& other) noexcept = default;
 AssetVariant::~AssetVariant() = default;
 
 void AssetVariant::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void AssetVariant::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -136,14 +149,14 @@ const std::optional<std::string>& AssetVariant::get_updated_at() const {
 }
 
 bool AssetVariant::operator==(const AssetVariant& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool AssetVariant::operator!=(const AssetVariant& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 AssetVariant& AssetVariant::operator=(const AssetVariant& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
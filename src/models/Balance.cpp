@@ -17,13 +17,16 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
+#include "InternedString.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Balance::Impl final : public IDeserializable {
+class Balance::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +34,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             id.reset();
             index.reset();
             value.reset();
@@ -42,19 +50,19 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "id", id);
-        JsonUtils::try_get_field(json_object, "index", index);
-        JsonUtils::try_get_field(json_object, "value", value);
-        JsonUtils::try_get_field(json_object, "project", project);
-        JsonUtils::try_get_field(json_object, "wallet", wallet);
+        id.try_get_field(json, "id");
+        index.try_get_field(json, "index");
+        JsonUtils::try_get_field(json, "value", value);
+        JsonUtils::try_get_field(json, "project", project);
+        JsonUtils::try_get_field(json, "wallet", wallet);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_id() const {
-        return id;
+        return id.get();
     }
 
     [[nodiscard]] const std::optional<std::string>& get_index() const {
-        return index;
+        return index.get();
     }
 
     [[nodiscard]] const std::optional<int>& get_value() const {
@@ -82,17 +90,17 @@ public:
     }
 
 private:
-    std::optional<std::string> id;
-    std::optional<std::string> index;
+    InternedString id;
+    InternedString index;
     std::optional<int> value;
     std::optional<Project> project;
     std::optional<Wallet> wallet;
 };
 
-Balance::Balance() : pimpl(std::make_unique<Impl>()) {
+Balance::Balance() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Balance::Balance(const Balance& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Balance::Balance(const Balance& other) : pimpl(other.pimpl) {
 }
 
 Balance::Balance(Balance&& other) noexcept = default;
@@ -100,6 +108,12 @@ Balance::Balance(Balance&& other) noexcept = default;
 Balance::~Balance() = default;
 
 void Balance::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Balance::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -124,14 +138,14 @@ const std::optional<Wallet>& Balance::get_wallet() const {
 }
 
 bool Balance::operator==(const Balance& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Balance::operator!=(const Balance& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Balance& enjin::sdk::models::Balance::operator=(const Balance& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
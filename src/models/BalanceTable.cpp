@@ -0,0 +1,120 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "enjinsdk/models/BalanceTable.hpp"
+
+#include "ResultTableUtils.hpp"
+#include <string_view>
+
+using namespace enjin::sdk::json;
+using namespace enjin::sdk::models;
+
+class ResultTable<Balance>::Impl final {
+public:
+    Impl() = default;
+
+    ~Impl() = default;
+
+    void append(const JsonView& item) {
+        append_field<std::string_view>(item, "id", ids);
+        append_field<std::string_view>(item, "index", indices);
+        append_field<int>(item, "value", values);
+    }
+
+    void clear() {
+        ids.clear();
+        indices.clear();
+        values.clear();
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        return ids.size();
+    }
+
+    [[nodiscard]] const StringColumn& get_ids() const {
+        return ids;
+    }
+
+    [[nodiscard]] const StringColumn& get_indices() const {
+        return indices;
+    }
+
+    [[nodiscard]] const Column<int>& get_values() const {
+        return values;
+    }
+
+    bool operator==(const Impl& rhs) const {
+        return ids == rhs.ids
+               && indices == rhs.indices
+               && values == rhs.values;
+    }
+
+    bool operator!=(const Impl& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    StringColumn ids;
+    StringColumn indices;
+    Column<int> values;
+};
+
+ResultTable<Balance>::ResultTable() : pimpl(std::make_unique<Impl>()) {
+}
+
+ResultTable<Balance>::ResultTable(const ResultTable& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+}
+
+ResultTable<Balance>::ResultTable(ResultTable&& other) noexcept = default;
+
+ResultTable<Balance>::~ResultTable() = default;
+
+void ResultTable<Balance>::append(const JsonView& item) {
+    pimpl->append(item);
+}
+
+void ResultTable<Balance>::clear() {
+    pimpl->clear();
+}
+
+std::size_t ResultTable<Balance>::size() const {
+    return pimpl->size();
+}
+
+const StringColumn& ResultTable<Balance>::get_ids() const {
+    return pimpl->get_ids();
+}
+
+const StringColumn& ResultTable<Balance>::get_indices() const {
+    return pimpl->get_indices();
+}
+
+const Column<int>& ResultTable<Balance>::get_values() const {
+    return pimpl->get_values();
+}
+
+bool ResultTable<Balance>::operator==(const ResultTable& rhs) const {
+    return *pimpl == *rhs.pimpl;
+}
+
+bool ResultTable<Balance>::operator!=(const ResultTable& rhs) const {
+    return *pimpl != *rhs.pimpl;
+}
+
+ResultTable<Balance>& ResultTable<Balance>::operator=(const ResultTable& rhs) {
+    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    return *this;
+}
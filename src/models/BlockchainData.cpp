@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class BlockchainData::Impl final : public IDeserializable {
+class BlockchainData::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             encoded_data.reset();
             signed_transaction.reset();
             signed_backup_transaction.reset();
@@ -44,13 +51,13 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "encodedData", encoded_data);
-        JsonUtils::try_get_field(json_object, "signedTransaction", signed_transaction);
-        JsonUtils::try_get_field(json_object, "signedBackupTransaction", signed_backup_transaction);
-        JsonUtils::try_get_field(json_object, "signedCancelTransaction", signed_cancel_transaction);
-        JsonUtils::try_get_field(json_object, "receipt", receipt);
-        JsonUtils::try_get_field(json_object, "error", error);
-        JsonUtils::try_get_field(json_object, "nonce", nonce);
+        JsonUtils::try_get_field(json, "encodedData", encoded_data);
+        JsonUtils::try_get_field(json, "signedTransaction", signed_transaction);
+        JsonUtils::try_get_field(json, "signedBackupTransaction", signed_backup_transaction);
+        JsonUtils::try_get_field(json, "signedCancelTransaction", signed_cancel_transaction);
+        JsonUtils::try_get_field(json, "receipt", receipt);
+        JsonUtils::try_get_field(json, "error", error);
+        JsonUtils::try_get_field(json, "nonce", nonce);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_encoded_data() const {
@@ -105,10 +112,10 @@ private:
     std::optional<std::string> nonce;
 };
 
-BlockchainData::BlockchainData() : pimpl(std::make_unique<Impl>()) {
+BlockchainData::BlockchainData() : pimpl(get_empty_impl<Impl>()) {
 }
 
-BlockchainData::BlockchainData(const BlockchainData& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+BlockchainData::BlockchainData(const BlockchainData& other) : pimpl(other.pimpl) {
 }
 
 BlockchainData::BlockchainData(BlockchainData&& other) noexcept = default;
@@ -116,6 +123,12 @@ BlockchainData::BlockchainData(BlockchainData&& other) noexcept = default;
 BlockchainData::~BlockchainData() = default;
 
 void BlockchainData::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void BlockchainData::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -148,14 +161,14 @@ const std::optional<std::string>& BlockchainData::get_nonce() const {
 }
 
 bool BlockchainData::operator==(const BlockchainData& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool BlockchainData::operator!=(const BlockchainData& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 BlockchainData& BlockchainData::operator=(const BlockchainData& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Contracts::Impl final : public IDeserializable {
+class Contracts::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             enj.reset();
             crypto_items.reset();
             platform_registry.reset();
@@ -41,10 +48,10 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "enj", enj);
-        JsonUtils::try_get_field(json_object, "cryptoItems", crypto_items);
-        JsonUtils::try_get_field(json_object, "platformRegistry", platform_registry);
-        JsonUtils::try_get_field(json_object, "supplyModels", supply_models);
+        JsonUtils::try_get_field(json, "enj", enj);
+        JsonUtils::try_get_field(json, "cryptoItems", crypto_items);
+        JsonUtils::try_get_field(json, "platformRegistry", platform_registry);
+        JsonUtils::try_get_field(json, "supplyModels", supply_models);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_enj() const {
@@ -81,10 +88,10 @@ private:
     std::optional<SupplyModels> supply_models;
 };
 
-Contracts::Contracts() : pimpl(std::make_unique<Impl>()) {
+Contracts::Contracts() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Contracts::Contracts(const Contracts& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Contracts::Contracts(const Contracts& other) : pimpl(other.pimpl) {
 }
 
 Contracts::Contracts(Contracts&& other) noexcept = default;
@@ -92,6 +99,12 @@ Contracts::Contracts(Contracts&& other) noexcept = default;
 Contracts::~Contracts() = default;
 
 void Contracts::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Contracts::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -112,14 +125,14 @@ const std::optional<SupplyModels>& Contracts::get_supply_models() const {
 }
 
 bool Contracts::operator==(const Contracts& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Contracts::operator!=(const Contracts& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Contracts& Contracts::operator=(const Contracts& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
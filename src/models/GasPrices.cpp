@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class GasPrices::Impl final : public IDeserializable {
+class GasPrices::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             safe_low.reset();
             average.reset();
             fast.reset();
@@ -41,10 +48,10 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "safeLow", safe_low);
-        JsonUtils::try_get_field(json_object, "average", average);
-        JsonUtils::try_get_field(json_object, "fast", fast);
-        JsonUtils::try_get_field(json_object, "fastest", fastest);
+        JsonUtils::try_get_field(json, "safeLow", safe_low);
+        JsonUtils::try_get_field(json, "average", average);
+        JsonUtils::try_get_field(json, "fast", fast);
+        JsonUtils::try_get_field(json, "fastest", fastest);
     }
 
     [[nodiscard]] const std::optional<float>& get_safe_low() const {
@@ -81,10 +88,10 @@ private:
     std::optional<float> fastest;
 };
 
-GasPrices::GasPrices() : pimpl(std::make_unique<Impl>()) {
+GasPrices::GasPrices() : pimpl(get_empty_impl<Impl>()) {
 }
 
-GasPrices::GasPrices(const GasPrices& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+GasPrices::GasPrices(const GasPrices& other) : pimpl(other.pimpl) {
 }
 
 GasPrices::GasPrices(GasPrices&& other) noexcept = default;
@@ -92,6 +99,12 @@ GasPrices::GasPrices(GasPrices&& other) noexcept = default;
 GasPrices::~GasPrices() = default;
 
 void GasPrices::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void GasPrices::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -112,14 +125,14 @@ const std::optional<float>& GasPrices::get_fastest() const {
 }
 
 bool GasPrices::operator==(const GasPrices& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool GasPrices::operator!=(const GasPrices& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 GasPrices& GasPrices::operator=(const GasPrices& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
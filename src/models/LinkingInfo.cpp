@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class LinkingInfo::Impl final : public IDeserializable {
+class LinkingInfo::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,16 +33,21 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             code.reset();
             qr.reset();
 
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "code", code);
-        JsonUtils::try_get_field(json_object, "qr", qr);
+        JsonUtils::try_get_field(json, "code", code);
+        JsonUtils::try_get_field(json, "qr", qr);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_code() const {
@@ -65,10 +72,10 @@ private:
     std::optional<std::string> qr;
 };
 
-LinkingInfo::LinkingInfo() : pimpl(std::make_unique<Impl>()) {
+LinkingInfo::LinkingInfo() : pimpl(get_empty_impl<Impl>()) {
 }
 
-LinkingInfo::LinkingInfo(const LinkingInfo& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+LinkingInfo::LinkingInfo(const LinkingInfo& other) : pimpl(other.pimpl) {
 }
 
 LinkingInfo::LinkingInfo(LinkingInfo&& other) noexcept = default;
@@ -76,6 +83,12 @@ LinkingInfo::LinkingInfo(LinkingInfo&& other) noexcept = default;
 LinkingInfo::~LinkingInfo() = default;
 
 void LinkingInfo::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void LinkingInfo::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -88,14 +101,14 @@ const std::optional<std::string>& LinkingInfo::get_qr() const {
 }
 
 bool LinkingInfo::operator==(const LinkingInfo& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool LinkingInfo::operator!=(const LinkingInfo& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 LinkingInfo& LinkingInfo::operator=(const LinkingInfo& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -16,6 +16,7 @@
 #include "enjinsdk/models/MintInput.hpp"
 
 #include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include <utility>
 
 using namespace enjin::sdk::json;
@@ -30,7 +31,19 @@ public:
     ~Impl() override = default;
 
     [[nodiscard]] std::string serialize() const override {
-        return to_json().to_string();
+        JsonWriter writer;
+        serialize(writer);
+
+        return writer.to_string();
+    }
+
+    void serialize(JsonWriter& writer) const override {
+        writer.start_object();
+
+        JsonUtils::try_write_field(writer, "to", to_opt);
+        JsonUtils::try_write_field(writer, "value", value_opt);
+
+        writer.end_object();
     }
 
     void set_to(std::string address) {
@@ -78,6 +91,10 @@ std::string MintInput::serialize() const {
     return pimpl->serialize();
 }
 
+void MintInput::serialize(JsonWriter& writer) const {
+    pimpl->serialize(writer);
+}
+
 MintInput& MintInput::set_to(std::string address) {
     pimpl->set_to(std::move(address));
     return *this;
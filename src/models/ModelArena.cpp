@@ -0,0 +1,136 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/models/ModelArena.hpp"
+
+#include "ArenaAllocated.hpp"
+#include <new>
+#include <utility>
+
+using namespace enjin::sdk::models;
+
+class ModelArena::Impl final {
+public:
+    Impl(std::size_t initial_size, std::pmr::memory_resource* upstream)
+            : resource(initial_size > 0
+                       ? std::pmr::monotonic_buffer_resource(initial_size, upstream)
+                       : std::pmr::monotonic_buffer_resource(upstream)) {
+    }
+
+    ~Impl() = default;
+
+    void* allocate(std::size_t size) {
+        void* ptr = resource.allocate(size, alignof(std::max_align_t));
+        allocated_bytes += size;
+
+        return ptr;
+    }
+
+    void deallocate(void* ptr, std::size_t size) noexcept {
+        resource.deallocate(ptr, size, alignof(std::max_align_t));
+    }
+
+    [[nodiscard]] std::size_t get_allocated_bytes() const noexcept {
+        return allocated_bytes;
+    }
+
+private:
+    std::pmr::monotonic_buffer_resource resource;
+    std::size_t allocated_bytes = 0;
+};
+
+struct alignas(std::max_align_t) ArenaAllocated::Header {
+    std::shared_ptr<ModelArena::Impl> arena;
+};
+
+ModelArena::ModelArena(std::size_t initial_size, std::pmr::memory_resource* upstream)
+        : pimpl(std::make_shared<Impl>(initial_size, upstream)) {
+}
+
+ModelArena::~ModelArena() = default;
+
+std::shared_ptr<ModelArena::Impl>& ModelArena::current() noexcept {
+    thread_local std::shared_ptr<Impl> arena;
+
+    return arena;
+}
+
+ModelArenaScope::ModelArenaScope(const ModelArena& arena)
+        : previous(std::exchange(ModelArena::current(), arena.pimpl)) {
+}
+
+ModelArenaScope::~ModelArenaScope() {
+    ModelArena::current() = std::move(previous);
+}
+
+PagedModelArenaScope::PagedModelArenaScope(std::size_t items_per_arena, std::pmr::memory_resource* upstream)
+        : previous(std::exchange(ModelArena::current(), nullptr)),
+          upstream(upstream),
+          items_per_arena(items_per_arena > 0 ? items_per_arena : 1) {
+}
+
+PagedModelArenaScope::~PagedModelArenaScope() {
+    ModelArena::current() = std::move(previous);
+}
+
+void PagedModelArenaScope::begin_item() {
+    std::shared_ptr<ModelArena::Impl>& arena = ModelArena::current();
+
+    if (arena == nullptr || items_in_arena == items_per_arena) {
+        const std::size_t initial_size = arena != nullptr
+                                         ? arena->get_allocated_bytes()
+                                         : 0;
+        arena = std::make_shared<ModelArena::Impl>(initial_size, upstream);
+        items_in_arena = 0;
+    }
+
+    items_in_arena++;
+}
+
+void* ArenaAllocated::operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void ArenaAllocated::operator delete(void* ptr, std::size_t size) noexcept {
+    deallocate(ptr, size);
+}
+
+void* ArenaAllocated::allocate(std::size_t size) {
+    const std::shared_ptr<ModelArena::Impl>& arena = ModelArena::current();
+    const std::size_t total = sizeof(Header) + size;
+    void* block = arena != nullptr
+                  ? arena->allocate(total)
+                  : ::operator new(total);
+
+    auto* header = new(block) Header{arena};
+
+    return header + 1;
+}
+
+void ArenaAllocated::deallocate(void* ptr, std::size_t size) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    auto* header = static_cast<Header*>(ptr) - 1;
+    std::shared_ptr<ModelArena::Impl> arena = std::move(header->arena);
+    header->~Header();
+
+    if (arena != nullptr) {
+        arena->deallocate(header, sizeof(Header) + size);
+    } else {
+        ::operator delete(header);
+    }
+}
@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Notifications::Impl final : public IDeserializable {
+class Notifications::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,14 +33,19 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             pusher.reset();
 
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "pusher", pusher);
+        JsonUtils::try_get_field(json, "pusher", pusher);
     }
 
     [[nodiscard]] const std::optional<Pusher>& get_pusher() const {
@@ -57,10 +64,10 @@ private:
     std::optional<Pusher> pusher;
 };
 
-Notifications::Notifications() : pimpl(std::make_unique<Impl>()) {
+Notifications::Notifications() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Notifications::Notifications(const Notifications& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Notifications::Notifications(const Notifications& other) : pimpl(other.pimpl) {
 }
 
 Notifications::Notifications(Notifications&& other) noexcept = default;
@@ -68,6 +75,12 @@ Notifications::Notifications(Notifications&& other) noexcept = default;
 Notifications::~Notifications() = default;
 
 void Notifications::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Notifications::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -76,14 +89,14 @@ const std::optional<Pusher>& Notifications::get_pusher() const {
 }
 
 bool Notifications::operator==(const Notifications& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Notifications::operator!=(const Notifications& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Notifications& Notifications::operator=(const Notifications& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class PaginationCursor::Impl final : public IDeserializable {
+class PaginationCursor::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             total.reset();
             per_page.reset();
             current_page.reset();
@@ -45,14 +52,14 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "total", total);
-        JsonUtils::try_get_field(json_object, "perPage", per_page);
-        JsonUtils::try_get_field(json_object, "currentPage", current_page);
-        JsonUtils::try_get_field(json_object, "hasPages", has_pages);
-        JsonUtils::try_get_field(json_object, "from", from);
-        JsonUtils::try_get_field(json_object, "to", to);
-        JsonUtils::try_get_field(json_object, "lastPage", last_page);
-        JsonUtils::try_get_field(json_object, "hasMorePages", has_more_pages);
+        JsonUtils::try_get_field(json, "total", total);
+        JsonUtils::try_get_field(json, "perPage", per_page);
+        JsonUtils::try_get_field(json, "currentPage", current_page);
+        JsonUtils::try_get_field(json, "hasPages", has_pages);
+        JsonUtils::try_get_field(json, "from", from);
+        JsonUtils::try_get_field(json, "to", to);
+        JsonUtils::try_get_field(json, "lastPage", last_page);
+        JsonUtils::try_get_field(json, "hasMorePages", has_more_pages);
     }
 
     [[nodiscard]] const std::optional<int>& get_total() const {
@@ -113,10 +120,10 @@ private:
     std::optional<bool> has_more_pages;
 };
 
-PaginationCursor::PaginationCursor() : pimpl(std::make_unique<Impl>()) {
+PaginationCursor::PaginationCursor() : pimpl(get_empty_impl<Impl>()) {
 }
 
-PaginationCursor::PaginationCursor(const PaginationCursor& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+PaginationCursor::PaginationCursor(const PaginationCursor& other) : pimpl(other.pimpl) {
 }
 
 PaginationCursor::PaginationCursor(PaginationCursor&& other) noexcept = default;
@@ -124,6 +131,12 @@ PaginationCursor::PaginationCursor(PaginationCursor&& other) noexcept = default;
 PaginationCursor::~PaginationCursor() = default;
 
 void PaginationCursor::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void PaginationCursor::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -160,14 +173,14 @@ const std::optional<bool>& PaginationCursor::get_has_more_pages() const {
 }
 
 bool PaginationCursor::operator==(const PaginationCursor& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool PaginationCursor::operator!=(const PaginationCursor& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 PaginationCursor& PaginationCursor::operator=(const PaginationCursor& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
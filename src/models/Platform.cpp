@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Platform::Impl final : public IDeserializable {
+class Platform::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             id.reset();
             name.reset();
             network.reset();
@@ -42,11 +49,11 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "id", id);
-        JsonUtils::try_get_field(json_object, "name", name);
-        JsonUtils::try_get_field(json_object, "network", network);
-        JsonUtils::try_get_field(json_object, "contracts", contracts);
-        JsonUtils::try_get_field(json_object, "notifications", notifications);
+        JsonUtils::try_get_field(json, "id", id);
+        JsonUtils::try_get_field(json, "name", name);
+        JsonUtils::try_get_field(json, "network", network);
+        JsonUtils::try_get_field(json, "contracts", contracts);
+        JsonUtils::try_get_field(json, "notifications", notifications);
     }
 
     [[nodiscard]] const std::optional<int>& get_id() const {
@@ -89,10 +96,10 @@ private:
     std::optional<Notifications> notifications;
 };
 
-Platform::Platform() : pimpl(std::make_unique<Impl>()) {
+Platform::Platform() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Platform::Platform(const Platform& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Platform::Platform(const Platform& other) : pimpl(other.pimpl) {
 }
 
 Platform::Platform(Platform&& other) noexcept = default;
@@ -100,6 +107,12 @@ Platform::Platform(Platform&& other) noexcept = default;
 Platform::~Platform() = default;
 
 void Platform::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Platform::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -124,14 +137,14 @@ const std::optional<Notifications>& Platform::get_notifications() const {
 }
 
 bool Platform::operator==(const Platform& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Platform::operator!=(const Platform& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Platform& Platform::operator=(const Platform& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
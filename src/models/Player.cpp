@@ -17,13 +17,16 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
+#include "LazyField.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Player::Impl final : public IDeserializable {
+class Player::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,22 +34,25 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             id.reset();
-            linking_info.reset();
-            wallet.reset();
             created_at.reset();
             updated_at.reset();
 
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "id", id);
-        JsonUtils::try_get_field(json_object, "linkingInfo", linking_info);
-        JsonUtils::try_get_field(json_object, "wallet", wallet);
-        JsonUtils::try_get_field(json_object, "createdAt", created_at);
-        JsonUtils::try_get_field(json_object, "updatedAt", updated_at);
+        JsonUtils::try_get_field(json, "id", id);
+        linking_info.read(json, "linkingInfo");
+        wallet.read(json, "wallet");
+        JsonUtils::try_get_field(json, "createdAt", created_at);
+        JsonUtils::try_get_field(json, "updatedAt", updated_at);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_id() const {
@@ -54,11 +60,11 @@ public:
     }
 
     [[nodiscard]] const std::optional<LinkingInfo>& get_linking_info() const {
-        return linking_info;
+        return linking_info.get();
     }
 
     [[nodiscard]] const std::optional<Wallet>& get_wallet() const {
-        return wallet;
+        return wallet.get();
     }
 
     [[nodiscard]] const std::optional<std::string>& get_created_at() const {
@@ -83,16 +89,16 @@ public:
 
 private:
     std::optional<std::string> id;
-    std::optional<LinkingInfo> linking_info;
-    std::optional<Wallet> wallet;
+    LazyField<LinkingInfo> linking_info;
+    LazyField<Wallet> wallet;
     std::optional<std::string> created_at;
     std::optional<std::string> updated_at;
 };
 
-Player::Player() : pimpl(std::make_unique<Impl>()) {
+Player::Player() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Player::Player(const Player& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Player::Player(const Player& other) : pimpl(other.pimpl) {
 }
 
 Player::Player(Player&& other) noexcept = default;
@@ -100,6 +106,12 @@ Player::Player(Player&& other) noexcept = default;
 Player::~Player() = default;
 
 void Player::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Player::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -124,14 +136,14 @@ const std::optional<std::string>& Player::get_updated_at() const {
 }
 
 bool Player::operator==(const Player& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Player::operator!=(const Player& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Player& enjin::sdk::models::Player::operator=(const Player& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,16 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
+#include "InternedString.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Project::Impl final : public IDeserializable {
+class Project::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +34,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             uuid.reset();
             name.reset();
             description.reset();
@@ -43,16 +51,16 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "uuid", uuid);
-        JsonUtils::try_get_field(json_object, "name", name);
-        JsonUtils::try_get_field(json_object, "description", description);
-        JsonUtils::try_get_field(json_object, "image", image);
-        JsonUtils::try_get_field(json_object, "createdAt", created_at);
-        JsonUtils::try_get_field(json_object, "updatedAt", updated_at);
+        uuid.try_get_field(json, "uuid");
+        JsonUtils::try_get_field(json, "name", name);
+        JsonUtils::try_get_field(json, "description", description);
+        JsonUtils::try_get_field(json, "image", image);
+        JsonUtils::try_get_field(json, "createdAt", created_at);
+        JsonUtils::try_get_field(json, "updatedAt", updated_at);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_uuid() const {
-        return uuid;
+        return uuid.get();
     }
 
     [[nodiscard]] const std::optional<std::string>& get_name() const {
@@ -89,7 +97,7 @@ public:
     }
 
 private:
-    std::optional<std::string> uuid;
+    InternedString uuid;
     std::optional<std::string> name;
     std::optional<std::string> description;
     std::optional<std::string> image;
@@ -97,10 +105,10 @@ private:
     std::optional<std::string> updated_at;
 };
 
-Project::Project() : pimpl(std::make_unique<Impl>()) {
+Project::Project() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Project::Project(const Project& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Project::Project(const Project& other) : pimpl(other.pimpl) {
 }
 
 Project::Project(Project&& other) noexcept = default;
@@ -108,6 +116,12 @@ Project::Project(Project&& other) noexcept = default;
 Project::~Project() = default;
 
 void Project::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Project::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -136,14 +150,14 @@ const std::optional<std::string>& Project::get_updated_at() const {
 }
 
 bool Project::operator==(const Project& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Project::operator!=(const Project& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Project& Project::operator=(const Project& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Pusher::Impl final : public IDeserializable {
+class Pusher::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             key.reset();
             pusher_namespace.reset();
             channels.reset();
@@ -41,10 +48,10 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "key", key);
-        JsonUtils::try_get_field(json_object, "namespace", pusher_namespace);
-        JsonUtils::try_get_field(json_object, "channels", channels);
-        JsonUtils::try_get_field(json_object, "options", options);
+        JsonUtils::try_get_field(json, "key", key);
+        JsonUtils::try_get_field(json, "namespace", pusher_namespace);
+        JsonUtils::try_get_field(json, "channels", channels);
+        JsonUtils::try_get_field(json, "options", options);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_key() const {
@@ -82,6 +89,12 @@ private:
 };
 
 void Pusher::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Pusher::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -102,17 +115,17 @@ const std::optional<PusherOptions>& Pusher::get_options() const {
 }
 
 bool Pusher::operator==(const Pusher& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Pusher::operator!=(const Pusher& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
-Pusher::Pusher() : pimpl(std::make_unique<Impl>()) {
+Pusher::Pusher() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Pusher::Pusher(const Pusher& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Pusher::Pusher(const Pusher& other) : pimpl(other.pimpl) {
 }
 
 Pusher::Pusher(Pusher&& other) noexcept = default;
@@ -120,6 +133,6 @@ Pusher::Pusher(Pusher&& other) noexcept = default;
 Pusher::~Pusher() = default;
 
 Pusher& Pusher::operator=(const Pusher& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class PusherChannels::Impl final : public IDeserializable {
+class PusherChannels::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             project.reset();
             player.reset();
             asset.reset();
@@ -41,10 +48,10 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "project", project);
-        JsonUtils::try_get_field(json_object, "player", player);
-        JsonUtils::try_get_field(json_object, "asset", asset);
-        JsonUtils::try_get_field(json_object, "wallet", wallet);
+        JsonUtils::try_get_field(json, "project", project);
+        JsonUtils::try_get_field(json, "player", player);
+        JsonUtils::try_get_field(json, "asset", asset);
+        JsonUtils::try_get_field(json, "wallet", wallet);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_project() const {
@@ -81,10 +88,10 @@ private:
     std::optional<std::string> wallet;
 };
 
-PusherChannels::PusherChannels() : pimpl(std::make_unique<Impl>()) {
+PusherChannels::PusherChannels() : pimpl(get_empty_impl<Impl>()) {
 }
 
-PusherChannels::PusherChannels(const PusherChannels& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+PusherChannels::PusherChannels(const PusherChannels& other) : pimpl(other.pimpl) {
 }
 
 PusherChannels::PusherChannels(PusherChannels&& other) noexcept = default;
@@ -92,6 +99,12 @@ PusherChannels::PusherChannels(PusherChannels&& other) noexcept = default;
 PusherChannels::~PusherChannels() = default;
 
 void PusherChannels::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void PusherChannels::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -112,14 +125,14 @@ const std::optional<std::string>& PusherChannels::get_wallet() const {
 }
 
 bool PusherChannels::operator==(const PusherChannels& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool PusherChannels::operator!=(const PusherChannels& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 PusherChannels& PusherChannels::operator=(const PusherChannels& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class PusherOptions::Impl final : public IDeserializable {
+class PusherOptions::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,16 +33,21 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             cluster.reset();
             encrypted.reset();
 
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "cluster", cluster);
-        JsonUtils::try_get_field(json_object, "encrypted", encrypted);
+        JsonUtils::try_get_field(json, "cluster", cluster);
+        JsonUtils::try_get_field(json, "encrypted", encrypted);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_cluster() const {
@@ -65,10 +72,10 @@ private:
     std::optional<bool> encrypted;
 };
 
-PusherOptions::PusherOptions() : pimpl(std::make_unique<Impl>()) {
+PusherOptions::PusherOptions() : pimpl(get_empty_impl<Impl>()) {
 }
 
-PusherOptions::PusherOptions(const PusherOptions& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+PusherOptions::PusherOptions(const PusherOptions& other) : pimpl(other.pimpl) {
 }
 
 PusherOptions::PusherOptions(PusherOptions&& other) noexcept = default;
@@ -76,6 +83,12 @@ PusherOptions::PusherOptions(PusherOptions&& other) noexcept = default;
 PusherOptions::~PusherOptions() = default;
 
 void PusherOptions::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void PusherOptions::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -88,14 +101,14 @@ const std::optional<bool>& PusherOptions::get_encrypted() const {
 }
 
 bool PusherOptions::operator==(const PusherOptions& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool PusherOptions::operator!=(const PusherOptions& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 PusherOptions& PusherOptions::operator=(const PusherOptions& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
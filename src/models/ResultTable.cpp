@@ -0,0 +1,157 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/models/ResultTable.hpp"
+
+#include <bitset>
+
+using namespace enjin::sdk::models;
+
+namespace {
+
+constexpr std::size_t BitsPerWord = 64;
+
+}
+
+void PresenceBitmap::push_back(bool is_present) {
+    if (rows % BitsPerWord == 0) {
+        words.push_back(0);
+    }
+
+    if (is_present) {
+        words.back() |= std::uint64_t(1) << (rows % BitsPerWord);
+    }
+
+    rows++;
+}
+
+void PresenceBitmap::clear() noexcept {
+    words.clear();
+    rows = 0;
+}
+
+std::size_t PresenceBitmap::count() const noexcept {
+    std::size_t count = 0;
+    for (std::uint64_t word: words) {
+        count += std::bitset<BitsPerWord>(word).count();
+    }
+
+    return count;
+}
+
+const std::vector<std::uint64_t>& PresenceBitmap::get_words() const noexcept {
+    return words;
+}
+
+std::size_t PresenceBitmap::size() const noexcept {
+    return rows;
+}
+
+bool PresenceBitmap::test(std::size_t row) const noexcept {
+    return (words[row / BitsPerWord] >> (row % BitsPerWord)) & 1;
+}
+
+bool PresenceBitmap::operator==(const PresenceBitmap& rhs) const {
+    return rows == rhs.rows
+           && words == rhs.words;
+}
+
+bool PresenceBitmap::operator!=(const PresenceBitmap& rhs) const {
+    return !(*this == rhs);
+}
+
+StringColumn::StringColumn(const StringColumn& other) : codes(other.codes), presence(other.presence) {
+    // Rebuilt rather than copied since the dictionary and lookup view the strings owned by the other column
+    for (std::string_view value: other.dictionary) {
+        intern(value);
+    }
+}
+
+void StringColumn::push_back(std::optional<std::string_view> value) {
+    codes.push_back(value.has_value() ? intern(value.value()) : 0);
+    presence.push_back(value.has_value());
+}
+
+void StringColumn::clear() noexcept {
+    codes.clear();
+    codes_by_string.clear();
+    dictionary.clear();
+    strings.clear();
+    presence.clear();
+}
+
+std::optional<std::string_view> StringColumn::get(std::size_t row) const {
+    if (!presence.test(row)) {
+        return std::nullopt;
+    }
+
+    return dictionary[codes[row]];
+}
+
+const std::vector<std::uint32_t>& StringColumn::get_codes() const noexcept {
+    return codes;
+}
+
+const std::vector<std::string_view>& StringColumn::get_dictionary() const noexcept {
+    return dictionary;
+}
+
+const PresenceBitmap& StringColumn::get_presence() const noexcept {
+    return presence;
+}
+
+std::size_t StringColumn::size() const noexcept {
+    return codes.size();
+}
+
+bool StringColumn::operator==(const StringColumn& rhs) const {
+    if (size() != rhs.size()) {
+        return false;
+    }
+
+    for (std::size_t row = 0; row < size(); row++) {
+        if (get(row) != rhs.get(row)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool StringColumn::operator!=(const StringColumn& rhs) const {
+    return !(*this == rhs);
+}
+
+StringColumn& StringColumn::operator=(const StringColumn& rhs) {
+    if (this != &rhs) {
+        *this = StringColumn(rhs);
+    }
+
+    return *this;
+}
+
+std::uint32_t StringColumn::intern(std::string_view value) {
+    auto it = codes_by_string.find(value);
+    if (it != codes_by_string.end()) {
+        return it->second;
+    }
+
+    const auto code = static_cast<std::uint32_t>(dictionary.size());
+    const std::string_view stored = strings.emplace_back(value);
+    dictionary.push_back(stored);
+    codes_by_string.emplace(stored, code);
+
+    return code;
+}
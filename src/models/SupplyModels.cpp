@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class SupplyModels::Impl final : public IDeserializable {
+class SupplyModels::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             fixed.reset();
             settable.reset();
             infinite.reset();
@@ -43,12 +50,12 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "fixed", fixed);
-        JsonUtils::try_get_field(json_object, "settable", settable);
-        JsonUtils::try_get_field(json_object, "infinite", infinite);
-        JsonUtils::try_get_field(json_object, "collapsing", collapsing);
-        JsonUtils::try_get_field(json_object, "annualValue", annual_value);
-        JsonUtils::try_get_field(json_object, "annualPercentage", annual_percentage);
+        JsonUtils::try_get_field(json, "fixed", fixed);
+        JsonUtils::try_get_field(json, "settable", settable);
+        JsonUtils::try_get_field(json, "infinite", infinite);
+        JsonUtils::try_get_field(json, "collapsing", collapsing);
+        JsonUtils::try_get_field(json, "annualValue", annual_value);
+        JsonUtils::try_get_field(json, "annualPercentage", annual_percentage);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_fixed() const {
@@ -97,10 +104,10 @@ private:
     std::optional<std::string> annual_percentage;
 };
 
-SupplyModels::SupplyModels() : pimpl(std::make_unique<Impl>()) {
+SupplyModels::SupplyModels() : pimpl(get_empty_impl<Impl>()) {
 }
 
-SupplyModels::SupplyModels(const SupplyModels& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+SupplyModels::SupplyModels(const SupplyModels& other) : pimpl(other.pimpl) {
 }
 
 SupplyModels::SupplyModels(SupplyModels&& other) noexcept = default;
@@ -108,6 +115,12 @@ SupplyModels::SupplyModels(SupplyModels&& other) noexcept = default;
 SupplyModels::~SupplyModels() = default;
 
 void SupplyModels::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void SupplyModels::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -136,14 +149,14 @@ const std::optional<std::string>& SupplyModels::get_annual_percentage() const {
 }
 
 bool SupplyModels::operator==(const SupplyModels& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool SupplyModels::operator!=(const SupplyModels& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 SupplyModels& SupplyModels::operator=(const SupplyModels& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
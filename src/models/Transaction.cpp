@@ -17,13 +17,17 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
+#include "InternedString.hpp"
+#include "LazyField.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Transaction::Impl : public IDeserializable {
+class Transaction::Impl : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +35,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             id.reset();
             transaction_id.reset();
             title.reset();
@@ -43,32 +52,28 @@ public:
             state.reset();
             accepted.reset();
             project_wallet.reset();
-            blockchain_data.reset();
-            project.reset();
-            asset.reset();
-            wallet.reset();
             created_at.reset();
             updated_at.reset();
 
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "id", id);
-        JsonUtils::try_get_field(json_object, "transactionId", transaction_id);
-        JsonUtils::try_get_field(json_object, "title", title);
-        JsonUtils::try_get_field(json_object, "contract", contract);
-        JsonUtils::try_get_field(json_object, "type", type);
-        JsonUtils::try_get_field(json_object, "value", value);
-        JsonUtils::try_get_field(json_object, "retryState", retry_state);
-        JsonUtils::try_get_field(json_object, "state", state);
-        JsonUtils::try_get_field(json_object, "accepted", accepted);
-        JsonUtils::try_get_field(json_object, "projectWallet", project_wallet);
-        JsonUtils::try_get_field(json_object, "blockchainData", blockchain_data);
-        JsonUtils::try_get_field(json_object, "project", project);
-        JsonUtils::try_get_field(json_object, "asset", asset);
-        JsonUtils::try_get_field(json_object, "wallet", wallet);
-        JsonUtils::try_get_field(json_object, "createdAt", created_at);
-        JsonUtils::try_get_field(json_object, "updatedAt", updated_at);
+        JsonUtils::try_get_field(json, "id", id);
+        transaction_id.try_get_field(json, "transactionId");
+        JsonUtils::try_get_field(json, "title", title);
+        contract.try_get_field(json, "contract");
+        JsonUtils::try_get_field(json, "type", type);
+        JsonUtils::try_get_field(json, "value", value);
+        JsonUtils::try_get_field(json, "retryState", retry_state);
+        JsonUtils::try_get_field(json, "state", state);
+        JsonUtils::try_get_field(json, "accepted", accepted);
+        JsonUtils::try_get_field(json, "projectWallet", project_wallet);
+        blockchain_data.read(json, "blockchainData");
+        project.read(json, "project");
+        asset.read(json, "asset");
+        wallet.read(json, "wallet");
+        JsonUtils::try_get_field(json, "createdAt", created_at);
+        JsonUtils::try_get_field(json, "updatedAt", updated_at);
     }
 
     [[nodiscard]] const std::optional<int>& get_id() const {
@@ -76,7 +81,7 @@ public:
     }
 
     [[nodiscard]] const std::optional<std::string>& get_transaction_id() const {
-        return transaction_id;
+        return transaction_id.get();
     }
 
     [[nodiscard]] const std::optional<std::string>& get_title() const {
@@ -84,7 +89,7 @@ public:
     }
 
     [[nodiscard]] const std::optional<std::string>& get_contract() const {
-        return contract;
+        return contract.get();
     }
 
     [[nodiscard]] const std::optional<TransactionType>& get_type() const {
@@ -112,19 +117,19 @@ public:
     }
 
     [[nodiscard]] const std::optional<BlockchainData>& get_blockchain_data() const {
-        return blockchain_data;
+        return blockchain_data.get();
     }
 
     [[nodiscard]] const std::optional<Project>& get_project() const {
-        return project;
+        return project.get();
     }
 
     [[nodiscard]] const std::optional<Asset>& get_asset() const {
-        return asset;
+        return asset.get();
     }
 
     [[nodiscard]] const std::optional<Wallet>& get_wallet() const {
-        return wallet;
+        return wallet.get();
     }
 
     [[nodiscard]] const std::optional<std::string>& get_created_at() const {
@@ -159,27 +164,27 @@ public:
 
 private:
     std::optional<int> id;
-    std::optional<std::string> transaction_id;
+    InternedString transaction_id;
     std::optional<std::string> title;
-    std::optional<std::string> contract;
+    InternedString contract;
     std::optional<TransactionType> type;
     std::optional<std::string> value;
     std::optional<std::string> retry_state;
     std::optional<TransactionState> state;
     std::optional<bool> accepted;
     std::optional<bool> project_wallet;
-    std::optional<BlockchainData> blockchain_data;
-    std::optional<Project> project;
-    std::optional<Asset> asset;
-    std::optional<Wallet> wallet;
+    LazyField<BlockchainData> blockchain_data;
+    LazyField<Project> project;
+    LazyField<Asset> asset;
+    LazyField<Wallet> wallet;
     std::optional<std::string> created_at;
     std::optional<std::string> updated_at;
 };
 
-Transaction::Transaction() : pimpl(std::make_unique<Impl>()) {
+Transaction::Transaction() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Transaction::Transaction(const Transaction& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Transaction::Transaction(const Transaction& other) : pimpl(other.pimpl) {
 }
 
 Transaction::Transaction(Transaction&& other) noexcept = default;
@@ -187,6 +192,12 @@ Transaction::Transaction(Transaction&& other) noexcept = default;
 Transaction::~Transaction() = default;
 
 void Transaction::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Transaction::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -255,14 +266,14 @@ const std::optional<std::string>& Transaction::get_updated_at() const {
 }
 
 bool Transaction::operator==(const Transaction& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Transaction::operator!=(const Transaction& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Transaction& Transaction::operator=(const Transaction& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
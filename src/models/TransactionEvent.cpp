@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class TransactionEvent::Impl final : public IDeserializable {
+class TransactionEvent::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             name.reset();
             inputs.reset();
             non_indexed_inputs.reset();
@@ -43,12 +50,12 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "name", name);
-        JsonUtils::try_get_field(json_object, "inputs", inputs);
-        JsonUtils::try_get_field(json_object, "nonIndexedInputs", non_indexed_inputs);
-        JsonUtils::try_get_field(json_object, "indexedInputs", indexed_inputs);
-        JsonUtils::try_get_field(json_object, "signature", signature);
-        JsonUtils::try_get_field(json_object, "encodedSignature", encoded_signature);
+        JsonUtils::try_get_field(json, "name", name);
+        JsonUtils::try_get_field(json, "inputs", inputs);
+        JsonUtils::try_get_field(json, "nonIndexedInputs", non_indexed_inputs);
+        JsonUtils::try_get_field(json, "indexedInputs", indexed_inputs);
+        JsonUtils::try_get_field(json, "signature", signature);
+        JsonUtils::try_get_field(json, "encodedSignature", encoded_signature);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_name() const {
@@ -97,10 +104,10 @@ private:
     std::optional<std::string> encoded_signature;
 };
 
-TransactionEvent::TransactionEvent() : pimpl(std::make_unique<Impl>()) {
+TransactionEvent::TransactionEvent() : pimpl(get_empty_impl<Impl>()) {
 }
 
-TransactionEvent::TransactionEvent(const TransactionEvent& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+TransactionEvent::TransactionEvent(const TransactionEvent& other) : pimpl(other.pimpl) {
 }
 
 TransactionEvent::TransactionEvent(TransactionEvent&& other) noexcept = default;
@@ -108,6 +115,12 @@ TransactionEvent::TransactionEvent(TransactionEvent&& other) noexcept = default;
 TransactionEvent::~TransactionEvent() = default;
 
 void TransactionEvent::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void TransactionEvent::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -136,14 +149,14 @@ const std::optional<std::string>& TransactionEvent::get_encoded_signature() cons
 }
 
 bool TransactionEvent::operator==(const TransactionEvent& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool TransactionEvent::operator!=(const TransactionEvent& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 TransactionEvent& TransactionEvent::operator=(const TransactionEvent& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -17,13 +17,16 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
+#include "InternedString.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class TransactionLog::Impl final : public IDeserializable {
+class TransactionLog::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +34,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             block_number.reset();
             address.reset();
             transaction_hash.reset();
@@ -43,12 +51,12 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "blockNumber", block_number);
-        JsonUtils::try_get_field(json_object, "address", address);
-        JsonUtils::try_get_field(json_object, "transactionHash", transaction_hash);
-        JsonUtils::try_get_field(json_object, "data", data);
-        JsonUtils::try_get_field(json_object, "topics", topics);
-        JsonUtils::try_get_field(json_object, "event", event);
+        JsonUtils::try_get_field(json, "blockNumber", block_number);
+        address.try_get_field(json, "address");
+        transaction_hash.try_get_field(json, "transactionHash");
+        JsonUtils::try_get_field(json, "data", data);
+        JsonUtils::try_get_field(json, "topics", topics);
+        JsonUtils::try_get_field(json, "event", event);
     }
 
     [[nodiscard]] const std::optional<int>& get_block_number() const {
@@ -56,11 +64,11 @@ public:
     }
 
     [[nodiscard]] const std::optional<std::string>& get_address() const {
-        return address;
+        return address.get();
     }
 
     [[nodiscard]] const std::optional<std::string>& get_transaction_hash() const {
-        return transaction_hash;
+        return transaction_hash.get();
     }
 
     [[nodiscard]] const std::optional<std::vector<json::JsonValue>>& get_data() const {
@@ -90,17 +98,17 @@ public:
 
 private:
     std::optional<int> block_number;
-    std::optional<std::string> address;
-    std::optional<std::string> transaction_hash;
+    InternedString address;
+    InternedString transaction_hash;
     std::optional<std::vector<json::JsonValue>> data;
     std::optional<std::vector<json::JsonValue>> topics;
     std::optional<TransactionEvent> event;
 };
 
-TransactionLog::TransactionLog() : pimpl(std::make_unique<Impl>()) {
+TransactionLog::TransactionLog() : pimpl(get_empty_impl<Impl>()) {
 }
 
-TransactionLog::TransactionLog(const TransactionLog& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+TransactionLog::TransactionLog(const TransactionLog& other) : pimpl(other.pimpl) {
 }
 
 TransactionLog::TransactionLog(TransactionLog&& other) noexcept = default;
@@ -108,6 +116,12 @@ TransactionLog::TransactionLog(TransactionLog&& other) noexcept = default;
 TransactionLog::~TransactionLog() = default;
 
 void TransactionLog::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void TransactionLog::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -136,14 +150,14 @@ const std::optional<TransactionEvent>& TransactionLog::get_event() const {
 }
 
 bool TransactionLog::operator==(const TransactionLog& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool TransactionLog::operator!=(const TransactionLog& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 TransactionLog& TransactionLog::operator=(const TransactionLog& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
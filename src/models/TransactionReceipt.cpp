@@ -17,13 +17,15 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class TransactionReceipt::Impl final : public IDeserializable {
+class TransactionReceipt::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,8 +33,13 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             block_hash.reset();
             block_number.reset();
             cumulative_gas_used.reset();
@@ -47,16 +54,16 @@ public:
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "blockHash", block_hash);
-        JsonUtils::try_get_field(json_object, "blockNumber", block_number);
-        JsonUtils::try_get_field(json_object, "cumulativeGasUsed", cumulative_gas_used);
-        JsonUtils::try_get_field(json_object, "gasUsed", gas_used);
-        JsonUtils::try_get_field(json_object, "from", from);
-        JsonUtils::try_get_field(json_object, "to", to);
-        JsonUtils::try_get_field(json_object, "transactionHash", transaction_hash);
-        JsonUtils::try_get_field(json_object, "transactionIndex", transaction_index);
-        JsonUtils::try_get_field(json_object, "status", status);
-        JsonUtils::try_get_field(json_object, "logs", logs);
+        JsonUtils::try_get_field(json, "blockHash", block_hash);
+        JsonUtils::try_get_field(json, "blockNumber", block_number);
+        JsonUtils::try_get_field(json, "cumulativeGasUsed", cumulative_gas_used);
+        JsonUtils::try_get_field(json, "gasUsed", gas_used);
+        JsonUtils::try_get_field(json, "from", from);
+        JsonUtils::try_get_field(json, "to", to);
+        JsonUtils::try_get_field(json, "transactionHash", transaction_hash);
+        JsonUtils::try_get_field(json, "transactionIndex", transaction_index);
+        JsonUtils::try_get_field(json, "status", status);
+        JsonUtils::try_get_field(json, "logs", logs);
     }
 
     [[nodiscard]] const std::optional<std::string>& get_block_hash() const {
@@ -129,10 +136,10 @@ private:
     std::optional<std::vector<TransactionLog>> logs;
 };
 
-TransactionReceipt::TransactionReceipt() : pimpl(std::make_unique<Impl>()) {
+TransactionReceipt::TransactionReceipt() : pimpl(get_empty_impl<Impl>()) {
 }
 
-TransactionReceipt::TransactionReceipt(const TransactionReceipt& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+TransactionReceipt::TransactionReceipt(const TransactionReceipt& other) : pimpl(other.pimpl) {
 }
 
 TransactionReceipt::TransactionReceipt(TransactionReceipt&& other) noexcept = default;
@@ -140,6 +147,12 @@ TransactionReceipt::TransactionReceipt(TransactionReceipt&& other) noexcept = de
 TransactionReceipt::~TransactionReceipt() = default;
 
 void TransactionReceipt::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void TransactionReceipt::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -184,14 +197,14 @@ const std::optional<std::vector<TransactionLog>>& TransactionReceipt::get_logs()
 }
 
 bool TransactionReceipt::operator==(const TransactionReceipt& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool TransactionReceipt::operator!=(const TransactionReceipt& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 TransactionReceipt& TransactionReceipt::operator=(const TransactionReceipt& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -0,0 +1,228 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "enjinsdk/models/TransactionTable.hpp"
+
+#include "ResultTableUtils.hpp"
+#include <string_view>
+
+using namespace enjin::sdk::json;
+using namespace enjin::sdk::models;
+
+class ResultTable<Transaction>::Impl final {
+public:
+    Impl() = default;
+
+    ~Impl() = default;
+
+    void append(const JsonView& item) {
+        append_field<int>(item, "id", ids);
+        append_field<std::string_view>(item, "transactionId", transaction_ids);
+        append_field<std::string_view>(item, "title", titles);
+        append_field<std::string_view>(item, "contract", contracts);
+        append_field<TransactionType>(item, "type", types);
+        append_field<std::string_view>(item, "value", values);
+        append_field<std::string_view>(item, "retryState", retry_states);
+        append_field<TransactionState>(item, "state", states);
+        append_field<bool>(item, "accepted", accepted);
+        append_field<bool>(item, "projectWallet", project_wallets);
+        append_field<std::string_view>(item, "createdAt", created_at);
+        append_field<std::string_view>(item, "updatedAt", updated_at);
+    }
+
+    void clear() {
+        ids.clear();
+        transaction_ids.clear();
+        titles.clear();
+        contracts.clear();
+        types.clear();
+        values.clear();
+        retry_states.clear();
+        states.clear();
+        accepted.clear();
+        project_wallets.clear();
+        created_at.clear();
+        updated_at.clear();
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        return ids.size();
+    }
+
+    [[nodiscard]] const Column<int>& get_ids() const {
+        return ids;
+    }
+
+    [[nodiscard]] const StringColumn& get_transaction_ids() const {
+        return transaction_ids;
+    }
+
+    [[nodiscard]] const StringColumn& get_titles() const {
+        return titles;
+    }
+
+    [[nodiscard]] const StringColumn& get_contracts() const {
+        return contracts;
+    }
+
+    [[nodiscard]] const Column<TransactionType>& get_types() const {
+        return types;
+    }
+
+    [[nodiscard]] const StringColumn& get_values() const {
+        return values;
+    }
+
+    [[nodiscard]] const StringColumn& get_retry_states() const {
+        return retry_states;
+    }
+
+    [[nodiscard]] const Column<TransactionState>& get_states() const {
+        return states;
+    }
+
+    [[nodiscard]] const Column<bool>& get_accepted() const {
+        return accepted;
+    }
+
+    [[nodiscard]] const Column<bool>& get_project_wallets() const {
+        return project_wallets;
+    }
+
+    [[nodiscard]] const StringColumn& get_created_at() const {
+        return created_at;
+    }
+
+    [[nodiscard]] const StringColumn& get_updated_at() const {
+        return updated_at;
+    }
+
+    bool operator==(const Impl& rhs) const {
+        return ids == rhs.ids
+               && transaction_ids == rhs.transaction_ids
+               && titles == rhs.titles
+               && contracts == rhs.contracts
+               && types == rhs.types
+               && values == rhs.values
+               && retry_states == rhs.retry_states
+               && states == rhs.states
+               && accepted == rhs.accepted
+               && project_wallets == rhs.project_wallets
+               && created_at == rhs.created_at
+               && updated_at == rhs.updated_at;
+    }
+
+    bool operator!=(const Impl& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    Column<int> ids;
+    StringColumn transaction_ids;
+    StringColumn titles;
+    StringColumn contracts;
+    Column<TransactionType> types;
+    StringColumn values;
+    StringColumn retry_states;
+    Column<TransactionState> states;
+    Column<bool> accepted;
+    Column<bool> project_wallets;
+    StringColumn created_at;
+    StringColumn updated_at;
+};
+
+ResultTable<Transaction>::ResultTable() : pimpl(std::make_unique<Impl>()) {
+}
+
+ResultTable<Transaction>::ResultTable(const ResultTable& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+}
+
+ResultTable<Transaction>::ResultTable(ResultTable&& other) noexcept = default;
+
+ResultTable<Transaction>::~ResultTable() = default;
+
+void ResultTable<Transaction>::append(const JsonView& item) {
+    pimpl->append(item);
+}
+
+void ResultTable<Transaction>::clear() {
+    pimpl->clear();
+}
+
+std::size_t ResultTable<Transaction>::size() const {
+    return pimpl->size();
+}
+
+const Column<int>& ResultTable<Transaction>::get_ids() const {
+    return pimpl->get_ids();
+}
+
+const StringColumn& ResultTable<Transaction>::get_transaction_ids() const {
+    return pimpl->get_transaction_ids();
+}
+
+const StringColumn& ResultTable<Transaction>::get_titles() const {
+    return pimpl->get_titles();
+}
+
+const StringColumn& ResultTable<Transaction>::get_contracts() const {
+    return pimpl->get_contracts();
+}
+
+const Column<TransactionType>& ResultTable<Transaction>::get_types() const {
+    return pimpl->get_types();
+}
+
+const StringColumn& ResultTable<Transaction>::get_values() const {
+    return pimpl->get_values();
+}
+
+const StringColumn& ResultTable<Transaction>::get_retry_states() const {
+    return pimpl->get_retry_states();
+}
+
+const Column<TransactionState>& ResultTable<Transaction>::get_states() const {
+    return pimpl->get_states();
+}
+
+const Column<bool>& ResultTable<Transaction>::get_accepted() const {
+    return pimpl->get_accepted();
+}
+
+const Column<bool>& ResultTable<Transaction>::get_project_wallets() const {
+    return pimpl->get_project_wallets();
+}
+
+const StringColumn& ResultTable<Transaction>::get_created_at() const {
+    return pimpl->get_created_at();
+}
+
+const StringColumn& ResultTable<Transaction>::get_updated_at() const {
+    return pimpl->get_updated_at();
+}
+
+bool ResultTable<Transaction>::operator==(const ResultTable& rhs) const {
+    return *pimpl == *rhs.pimpl;
+}
+
+bool ResultTable<Transaction>::operator!=(const ResultTable& rhs) const {
+    return *pimpl != *rhs.pimpl;
+}
+
+ResultTable<Transaction>& ResultTable<Transaction>::operator=(const ResultTable& rhs) {
+    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    return *this;
+}
@@ -16,6 +16,7 @@
 #include "enjinsdk/models/TransferInput.hpp"
 
 #include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include <utility>
 
 using namespace enjin::sdk::json;
@@ -30,7 +31,22 @@ public:
     ~Impl() override = default;
 
     [[nodiscard]] std::string serialize() const override {
-        return to_json().to_string();
+        JsonWriter writer;
+        serialize(writer);
+
+        return writer.to_string();
+    }
+
+    void serialize(JsonWriter& writer) const override {
+        writer.start_object();
+
+        JsonUtils::try_write_field(writer, "from", from_opt);
+        JsonUtils::try_write_field(writer, "to", to_opt);
+        JsonUtils::try_write_field(writer, "assetId", asset_id_opt);
+        JsonUtils::try_write_field(writer, "assetIndex", asset_index_opt);
+        JsonUtils::try_write_field(writer, "value", value_opt);
+
+        writer.end_object();
     }
 
     void set_from(std::string address) {
@@ -99,6 +115,10 @@ std::string TransferInput::serialize() const {
     return pimpl->serialize();
 }
 
+void TransferInput::serialize(JsonWriter& writer) const {
+    pimpl->serialize(writer);
+}
+
 TransferInput& TransferInput::set_from(std::string address) {
     pimpl->set_from(std::move(address));
     return *this;
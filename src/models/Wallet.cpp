@@ -17,13 +17,17 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "ArenaAllocated.hpp"
+#include "InternedString.hpp"
+#include "LazyField.hpp"
 
 using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::serialization;
 using namespace enjin::sdk::utils;
 
-class Wallet::Impl final : public IDeserializable {
+class Wallet::Impl final : public IDeserializable, public ArenaAllocated {
 public:
     Impl() = default;
 
@@ -31,30 +35,32 @@ public:
 
     void deserialize(const std::string& json) override {
         JsonValue json_object;
+        json_object.try_parse_as_object(json);
 
-        if (!json_object.try_parse_as_object(json)) {
+        deserialize(JsonView(json_object));
+    }
+
+    void deserialize(const JsonView& json) override {
+        if (!json.is_object()) {
             eth_address.reset();
             enj_allowance.reset();
             enj_balance.reset();
             eth_balance.reset();
-            assets_created.reset();
-            balances.reset();
-            transactions.reset();
 
             return;
         }
 
-        JsonUtils::try_get_field(json_object, "ethAddress", eth_address);
-        JsonUtils::try_get_field(json_object, "enjAllowance", enj_allowance);
-        JsonUtils::try_get_field(json_object, "enjBalance", enj_balance);
-        JsonUtils::try_get_field(json_object, "ethBalance", eth_balance);
-        JsonUtils::try_get_field(json_object, "assetsCreated", assets_created);
-        JsonUtils::try_get_field(json_object, "balances", balances);
-        JsonUtils::try_get_field(json_object, "transactions", transactions);
+        eth_address.try_get_field(json, "ethAddress");
+        JsonUtils::try_get_field(json, "enjAllowance", enj_allowance);
+        JsonUtils::try_get_field(json, "enjBalance", enj_balance);
+        JsonUtils::try_get_field(json, "ethBalance", eth_balance);
+        assets_created.read(json, "assetsCreated");
+        balances.read(json, "balances");
+        transactions.read(json, "transactions");
     }
 
     [[nodiscard]] const std::optional<std::string>& get_eth_address() const {
-        return eth_address;
+        return eth_address.get();
     }
 
     [[nodiscard]] const std::optional<float>& get_enj_allowance() const {
@@ -70,15 +76,15 @@ public:
     }
 
     [[nodiscard]] const std::optional<std::vector<Asset>>& get_assets_created() const {
-        return assets_created;
+        return assets_created.get();
     }
 
     [[nodiscard]] const std::optional<std::vector<Balance>>& get_balances() const {
-        return balances;
+        return balances.get();
     }
 
     [[nodiscard]] const std::optional<std::vector<Transaction>>& get_transactions() const {
-        return transactions;
+        return transactions.get();
     }
 
     bool operator==(const Impl& rhs) const {
@@ -96,19 +102,19 @@ public:
     }
 
 private:
-    std::optional<std::string> eth_address;
+    InternedString eth_address;
     std::optional<float> enj_allowance;
     std::optional<float> enj_balance;
     std::optional<float> eth_balance;
-    std::optional<std::vector<Asset>> assets_created;
-    std::optional<std::vector<Balance>> balances;
-    std::optional<std::vector<Transaction>> transactions;
+    LazyField<std::vector<Asset>> assets_created;
+    LazyField<std::vector<Balance>> balances;
+    LazyField<std::vector<Transaction>> transactions;
 };
 
-Wallet::Wallet() : pimpl(std::make_unique<Impl>()) {
+Wallet::Wallet() : pimpl(get_empty_impl<Impl>()) {
 }
 
-Wallet::Wallet(const Wallet& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+Wallet::Wallet(const Wallet& other) : pimpl(other.pimpl) {
 }
 
 Wallet::Wallet(Wallet&& other) noexcept = default;
@@ -116,6 +122,12 @@ Wallet::Wallet(Wallet&& other) noexcept = default;
 Wallet::~Wallet() = default;
 
 void Wallet::deserialize(const std::string& json) {
+    pimpl = make_shared_impl<Impl>();
+    pimpl->deserialize(json);
+}
+
+void Wallet::deserialize(const JsonView& json) {
+    pimpl = make_shared_impl<Impl>();
     pimpl->deserialize(json);
 }
 
@@ -148,14 +160,14 @@ const std::optional<std::vector<Transaction>>& Wallet::get_transactions() const
 }
 
 bool Wallet::operator==(const Wallet& rhs) const {
-    return *pimpl == *rhs.pimpl;
+    return pimpl == rhs.pimpl || *pimpl == *rhs.pimpl;
 }
 
 bool Wallet::operator!=(const Wallet& rhs) const {
-    return *pimpl != *rhs.pimpl;
+    return pimpl != rhs.pimpl && *pimpl != *rhs.pimpl;
 }
 
 Wallet& enjin::sdk::models::Wallet::operator=(const Wallet& rhs) {
-    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    pimpl = rhs.pimpl;
     return *this;
 }
@@ -0,0 +1,132 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "enjinsdk/models/WalletTable.hpp"
+
+#include "ResultTableUtils.hpp"
+#include <string_view>
+
+using namespace enjin::sdk::json;
+using namespace enjin::sdk::models;
+
+class ResultTable<Wallet>::Impl final {
+public:
+    Impl() = default;
+
+    ~Impl() = default;
+
+    void append(const JsonView& item) {
+        append_field<std::string_view>(item, "ethAddress", eth_addresses);
+        append_field<float>(item, "enjAllowance", enj_allowances);
+        append_field<float>(item, "enjBalance", enj_balances);
+        append_field<float>(item, "ethBalance", eth_balances);
+    }
+
+    void clear() {
+        eth_addresses.clear();
+        enj_allowances.clear();
+        enj_balances.clear();
+        eth_balances.clear();
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        return eth_addresses.size();
+    }
+
+    [[nodiscard]] const StringColumn& get_eth_addresses() const {
+        return eth_addresses;
+    }
+
+    [[nodiscard]] const Column<float>& get_enj_allowances() const {
+        return enj_allowances;
+    }
+
+    [[nodiscard]] const Column<float>& get_enj_balances() const {
+        return enj_balances;
+    }
+
+    [[nodiscard]] const Column<float>& get_eth_balances() const {
+        return eth_balances;
+    }
+
+    bool operator==(const Impl& rhs) const {
+        return eth_addresses == rhs.eth_addresses
+               && enj_allowances == rhs.enj_allowances
+               && enj_balances == rhs.enj_balances
+               && eth_balances == rhs.eth_balances;
+    }
+
+    bool operator!=(const Impl& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    StringColumn eth_addresses;
+    Column<float> enj_allowances;
+    Column<float> enj_balances;
+    Column<float> eth_balances;
+};
+
+ResultTable<Wallet>::ResultTable() : pimpl(std::make_unique<Impl>()) {
+}
+
+ResultTable<Wallet>::ResultTable(const ResultTable& other) : pimpl(std::make_unique<Impl>(*other.pimpl)) {
+}
+
+ResultTable<Wallet>::ResultTable(ResultTable&& other) noexcept = default;
+
+ResultTable<Wallet>::~ResultTable() = default;
+
+void ResultTable<Wallet>::append(const JsonView& item) {
+    pimpl->append(item);
+}
+
+void ResultTable<Wallet>::clear() {
+    pimpl->clear();
+}
+
+std::size_t ResultTable<Wallet>::size() const {
+    return pimpl->size();
+}
+
+const StringColumn& ResultTable<Wallet>::get_eth_addresses() const {
+    return pimpl->get_eth_addresses();
+}
+
+const Column<float>& ResultTable<Wallet>::get_enj_allowances() const {
+    return pimpl->get_enj_allowances();
+}
+
+const Column<float>& ResultTable<Wallet>::get_enj_balances() const {
+    return pimpl->get_enj_balances();
+}
+
+const Column<float>& ResultTable<Wallet>::get_eth_balances() const {
+    return pimpl->get_eth_balances();
+}
+
+bool ResultTable<Wallet>::operator==(const ResultTable& rhs) const {
+    return *pimpl == *rhs.pimpl;
+}
+
+bool ResultTable<Wallet>::operator!=(const ResultTable& rhs) const {
+    return *pimpl != *rhs.pimpl;
+}
+
+ResultTable<Wallet>& ResultTable<Wallet>::operator=(const ResultTable& rhs) {
+    pimpl = std::make_unique<Impl>(*rhs.pimpl);
+    return *this;
+}
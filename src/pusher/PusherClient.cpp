@@ -16,6 +16,7 @@
 #include "PusherClient.hpp"
 
 #include "FutureUtils.hpp"
+#include "JsonParser.hpp"
 #include "PusherConstants.hpp"
 #include "PusherErrorCodes.hpp"
 #include "PusherException.hpp"
@@ -261,9 +262,8 @@ void PusherClient::emit_event(const PusherEvent& event) {
 void PusherClient::websocket_message_received(const std::string& message) {
     // Processes the incoming message
     rapidjson::Document document;
-    document.Parse(message.c_str());
 
-    if (!document.IsObject()) {
+    if (!sdk::json::parse_document(document, message) || !document.IsObject()) {
         return;
     } else if (document.HasMember(DATA_KEY) && document[DATA_KEY].IsObject()) {
         sdk::utils::set_string_member(document, DATA_KEY, sdk::utils::get_object_as_string(document, DATA_KEY));
@@ -17,6 +17,7 @@
 
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
 
 using namespace enjin::pusher;
 using namespace enjin::sdk::json;
@@ -25,8 +26,13 @@ using namespace enjin::sdk::utils;
 
 void PusherEvent::deserialize(const std::string& json) {
     JsonValue json_object;
+    json_object.try_parse_as_object(json);
 
-    if (!json_object.try_parse_as_object(json)) {
+    deserialize(JsonView(json_object));
+}
+
+void PusherEvent::deserialize(const JsonView& json) {
+    if (!json.is_object()) {
         user_id.reset();
         channel_name.reset();
         event_name.reset();
@@ -35,10 +41,10 @@ void PusherEvent::deserialize(const std::string& json) {
         return;
     }
 
-    JsonUtils::try_get_field(json_object, "user_id", user_id);
-    JsonUtils::try_get_field(json_object, "channel", channel_name);
-    JsonUtils::try_get_field(json_object, "event", event_name);
-    JsonUtils::try_get_field(json_object, "data", data);
+    JsonUtils::try_get_field(json, "user_id", user_id);
+    JsonUtils::try_get_field(json, "channel", channel_name);
+    JsonUtils::try_get_field(json, "event", event_name);
+    JsonUtils::try_get_field(json, "data", data);
 }
 
 const std::optional<std::string>& PusherEvent::get_user_id() const {
@@ -15,8 +15,14 @@
 
 #include "enjinsdk/BaseSchema.hpp"
 
-#include "RapidJsonUtils.hpp"
+#include "GraphqlBatcher.hpp"
+#include "enjinsdk/JsonWriter.hpp"
+#include "enjinsdk_utils/StringUtils.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
 #include <sstream>
+#include <utility>
 
 using namespace enjin::sdk;
 using namespace enjin::sdk::graphql;
@@ -25,38 +31,142 @@ using namespace enjin::sdk::utils;
 
 BaseSchema::BaseSchema(std::unique_ptr<IHttpClient> http_client,
                        std::string schema,
-                       std::shared_ptr<LoggerProvider> logger_provider)
+                       std::shared_ptr<LoggerProvider> logger_provider,
+                       std::shared_ptr<IExecutor> executor)
         : middleware(std::make_unique<ClientMiddleware>(std::move(http_client))),
           logger_provider(std::move(logger_provider)),
-          schema(std::move(schema)) {
+          schema(std::move(schema)),
+          executor(std::move(executor)) {
+}
+
+BaseSchema::~BaseSchema() {
+    // Destroys the batcher while the members it uses are alive, so that its final batch is sent
+    set_request_batching(0, std::chrono::milliseconds(0));
+}
+
+ComposedQuery BaseSchema::compose_queries() {
+    return ComposedQuery(*this);
 }
 
 std::string BaseSchema::create_request_body(AbstractGraphqlRequest& request) const {
-    rapidjson::Document document(rapidjson::kObjectType);
+    json::JsonWriter writer;
 
-    utils::set_string_member(document,
-                             "query",
-                             middleware->get_query_registry().get_operation_for_name(request.get_namespace()));
-    utils::set_object_member_from_string(document, "variables", request.serialize());
+    writer.start_object();
+    writer.write_key("query");
+    writer.write_string(middleware->get_query_registry().get_operation_for_name(request.get_namespace()));
+    writer.write_key("variables");
+    request.serialize(writer);
+    writer.end_object();
 
-    return utils::document_to_string(document);
+    return writer.to_string();
 }
 
 HttpRequest BaseSchema::create_request(AbstractGraphqlRequest& request) const {
+    HttpRequest req = create_request(create_request_body(request));
+    req.set_idempotent(is_query(request));
+
+    return req;
+}
+
+HttpRequest BaseSchema::create_request(std::string body) const {
     HttpRequest req = middleware->create_request();
 
     req.set_method(HttpMethod::Post)
        .set_path_query_fragment(std::string("/graphql/").append(schema))
        .set_content_type(JSON)
-       .set_body(create_request_body(request));
+       .set_body(std::move(body));
 
     return req;
 }
 
+void BaseSchema::dispatch(std::function<void()> task) {
+    if (executor == nullptr) {
+        track_detached_task(std::async(std::launch::async, std::move(task)));
+    } else {
+        executor->execute(std::move(task));
+    }
+}
+
+bool BaseSchema::enqueue_batched(AbstractGraphqlRequest& request,
+                                 std::function<void(std::shared_future<HttpResponse>)> completion) {
+    std::shared_ptr<GraphqlBatcher> current;
+    {
+        std::lock_guard<std::mutex> guard(batcher_mutex);
+        current = batcher;
+    }
+
+    if (current == nullptr) {
+        return false;
+    }
+
+    current->enqueue(create_request_body(request), std::move(completion));
+
+    return true;
+}
+
+void BaseSchema::flush_request_batch() {
+    std::shared_ptr<GraphqlBatcher> current;
+    {
+        std::lock_guard<std::mutex> guard(batcher_mutex);
+        current = batcher;
+    }
+
+    if (current != nullptr) {
+        current->flush();
+    }
+}
+
+std::string BaseSchema::create_coalescing_key(AbstractGraphqlRequest& request) const {
+    if (!request_coalescing_enabled) {
+        return std::string();
+    }
+
+    // Only queries are safe to share, as each mutation must reach the platform
+    if (!is_query(request)) {
+        return std::string();
+    }
+
+    return std::string(request.get_namespace()).append(1, '\n').append(request.serialize());
+}
+
+std::size_t BaseSchema::get_coalesced_request_count() const {
+    return coalesced_request_count;
+}
+
 const std::shared_ptr<utils::LoggerProvider>& BaseSchema::get_logger_provider() const {
     return logger_provider;
 }
 
+std::pmr::memory_resource* BaseSchema::get_model_memory_resource() const {
+    std::pmr::memory_resource* resource = model_memory_resource;
+    return resource == nullptr ? std::pmr::get_default_resource() : resource;
+}
+
+bool BaseSchema::is_query(AbstractGraphqlRequest& request) const {
+    const std::string operation = enjin::utils::trim(
+            middleware->get_query_registry().get_operation_for_name(request.get_namespace()));
+
+    return operation.rfind("query", 0) == 0 || operation.rfind('{', 0) == 0;
+}
+
+bool BaseSchema::is_request_batching_enabled() const {
+    return request_batching_enabled;
+}
+
+bool BaseSchema::is_request_coalescing_enabled() const {
+    return request_coalescing_enabled;
+}
+
+void BaseSchema::log_callback_exception(const std::exception& e) {
+    if (logger_provider == nullptr) {
+        return;
+    }
+
+    std::stringstream ss;
+    ss << "An exception was thrown by a GraphQL response callback: " << e.what();
+    logger_provider->log(utils::LogLevel::Severe, ss.str());
+}
+
 void BaseSchema::log_graphql_exception(const std::exception& e) {
     if (logger_provider == nullptr) {
         return;
@@ -67,6 +177,90 @@ void BaseSchema::log_graphql_exception(const std::exception& e) {
     logger_provider->log(utils::LogLevel::Severe, ss.str());
 }
 
-http::HttpResponse BaseSchema::send_request(http::HttpRequest request) {
-    return middleware->get_client()->send_request(request).get();
+void BaseSchema::track_detached_task(std::future<void> task) {
+    std::lock_guard<std::mutex> guard(detached_tasks_mutex);
+
+    // Drops the tasks which have already completed
+    detached_tasks.erase(std::remove_if(detached_tasks.begin(),
+                                        detached_tasks.end(),
+                                        [](const std::future<void>& detached_task) {
+                                            return detached_task.wait_for(std::chrono::seconds(0))
+                                                   == std::future_status::ready;
+                                        }),
+                         detached_tasks.end());
+    detached_tasks.push_back(std::move(task));
+}
+
+http::HttpResponse BaseSchema::send_request(http::HttpRequest request, const std::string& coalescing_key) {
+    if (coalescing_key.empty()) {
+        return middleware->get_client()->send_request(std::move(request)).get();
+    }
+
+    std::promise<HttpResponse> promise;
+    std::shared_future<HttpResponse> in_flight;
+    {
+        std::lock_guard<std::mutex> guard(in_flight_queries_mutex);
+        auto iter = in_flight_queries.find(coalescing_key);
+        if (iter == in_flight_queries.end()) {
+            in_flight_queries.emplace(coalescing_key, promise.get_future().share());
+        } else {
+            in_flight = iter->second;
+        }
+    }
+
+    if (in_flight.valid()) {
+        coalesced_request_count++;
+        return in_flight.get();
+    }
+
+    // Removes the query before completing it, so that queries sent afterwards are not given a stale response
+    auto complete = [this, &coalescing_key]() {
+        std::lock_guard<std::mutex> guard(in_flight_queries_mutex);
+        in_flight_queries.erase(coalescing_key);
+    };
+
+    try {
+        HttpResponse response = middleware->get_client()->send_request(std::move(request)).get();
+        complete();
+        promise.set_value(response);
+        return response;
+    } catch (...) {
+        complete();
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+}
+
+void BaseSchema::set_model_memory_resource(std::pmr::memory_resource* resource) {
+    model_memory_resource = resource;
+}
+
+void BaseSchema::set_request_batching(std::size_t max_batch_size, std::chrono::milliseconds max_delay) {
+    std::shared_ptr<GraphqlBatcher> next;
+    if (max_batch_size > 1) {
+        next = std::make_shared<GraphqlBatcher>(
+                [this](std::string body) {
+                    return middleware->get_client()->send_request(create_request(std::move(body)));
+                },
+                [this](std::function<void()> task) {
+                    dispatch(std::move(task));
+                },
+                max_batch_size,
+                max_delay);
+    }
+
+    std::shared_ptr<GraphqlBatcher> previous;
+    {
+        std::lock_guard<std::mutex> guard(batcher_mutex);
+        previous = std::move(batcher);
+        batcher = std::move(next);
+        request_batching_enabled = batcher != nullptr;
+    }
+
+    // Sends the requests waiting in the previous batcher, unless another thread is still enqueueing to it
+    previous.reset();
+}
+
+void BaseSchema::set_request_coalescing(bool enabled) {
+    request_coalescing_enabled = enabled;
 }
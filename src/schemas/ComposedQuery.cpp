@@ -0,0 +1,95 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/ComposedQuery.hpp"
+
+#include "GraphqlQueryComposer.hpp"
+#include "enjinsdk/BaseSchema.hpp"
+#include <utility>
+
+using namespace enjin::sdk;
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::http;
+
+ComposedQuery::ComposedQuery(BaseSchema& schema)
+        : schema(&schema),
+          composer(std::make_unique<GraphqlQueryComposer>(schema.middleware->get_query_registry())) {
+}
+
+ComposedQuery::ComposedQuery(ComposedQuery&& other) noexcept
+        : schema(other.schema),
+          composer(std::move(other.composer)),
+          completions(std::move(other.completions)) {
+}
+
+ComposedQuery::~ComposedQuery() = default;
+
+void ComposedQuery::add(const AbstractGraphqlRequest& request, Completion completion) {
+    composer->add(request);
+    completions.push_back(std::move(completion));
+}
+
+void ComposedQuery::send() {
+    if (completions.empty()) {
+        return;
+    }
+
+    std::shared_ptr<GraphqlQueryComposer> sent_composer = std::move(composer);
+    auto entries = std::make_shared<std::vector<Completion>>(std::move(completions));
+    composer = std::make_unique<GraphqlQueryComposer>(schema->middleware->get_query_registry());
+    completions.clear();
+
+    // Only queries are composed, so the request may be sent again
+    HttpRequest request = schema->create_request(sent_composer->create_request_body());
+    request.set_idempotent(true);
+
+    schema->dispatch([schema = schema,
+                      sent_composer,
+                      entries,
+                      http_request = std::move(request)]() mutable {
+        std::vector<std::string> response_bodies;
+        try {
+            auto http_response = schema->middleware->get_client()->send_request(std::move(http_request)).get();
+            response_bodies = sent_composer->split_response(http_response.get_body().value());
+        } catch (...) {
+            auto exception = std::current_exception();
+            for (const auto& completion: *entries) {
+                std::promise<std::string> promise;
+                promise.set_exception(exception);
+                completion(promise.get_future().share());
+            }
+
+            return;
+        }
+
+        for (std::size_t i = 0; i < entries->size(); i++) {
+            std::promise<std::string> promise;
+            promise.set_value(std::move(response_bodies[i]));
+            entries->at(i)(promise.get_future().share());
+        }
+    });
+}
+
+std::size_t ComposedQuery::size() const {
+    return completions.size();
+}
+
+void ComposedQuery::log_exception(BaseSchema& schema, const std::exception& e) {
+    schema.log_graphql_exception(e);
+}
+
+std::pmr::memory_resource* ComposedQuery::get_model_memory_resource(BaseSchema& schema) {
+    return schema.get_model_memory_resource();
+}
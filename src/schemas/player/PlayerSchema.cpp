@@ -20,68 +20,133 @@
 namespace enjin::sdk::player {
 
 PlayerSchema::PlayerSchema(std::unique_ptr<http::IHttpClient> http_client,
-                           std::shared_ptr<utils::LoggerProvider> logger_provider)
-        : shared::SharedSchema(std::move(http_client), "player", std::move(logger_provider)) {
+                           std::shared_ptr<utils::LoggerProvider> logger_provider,
+                           std::shared_ptr<utils::IExecutor> executor)
+        : shared::SharedSchema(std::move(http_client), "player", std::move(logger_provider), std::move(executor)) {
 }
 
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::advanced_send_asset(AdvancedSendAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::advanced_send_asset(AdvancedSendAsset request,
+                                       graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::approve_enj(ApproveEnj request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::approve_enj(ApproveEnj request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::approve_enj_max(ApproveMaxEnj request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::approve_enj_max(ApproveMaxEnj request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::bridge_asset(BridgeAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::bridge_asset(BridgeAsset request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::bridge_assets(BridgeAssets request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::bridge_assets(BridgeAssets request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::bridge_claim_asset(BridgeClaimAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::bridge_claim_asset(BridgeClaimAsset request,
+                                      graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Player>> PlayerSchema::get_player(GetPlayer request) {
     return send_request_for_one<models::Player>(request);
 }
 
+void PlayerSchema::get_player(GetPlayer request, graphql::GraphqlCallback<models::Player> callback) {
+    send_request_for_one<models::Player>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Wallet>> PlayerSchema::get_wallet(GetWallet request) {
     return send_request_for_one<models::Wallet>(request);
 }
 
+void PlayerSchema::get_wallet(GetWallet request, graphql::GraphqlCallback<models::Wallet> callback) {
+    send_request_for_one<models::Wallet>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::melt_asset(MeltAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::melt_asset(MeltAsset request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::message(Message request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::message(Message request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::reset_enj_approval(ResetEnjApproval request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::reset_enj_approval(ResetEnjApproval request,
+                                      graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::send_asset(SendAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::send_asset(SendAsset request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::send_enj(SendEnj request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::send_enj(SendEnj request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> PlayerSchema::set_approval_for_all(SetApprovalForAll request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void PlayerSchema::set_approval_for_all(SetApprovalForAll request,
+                                        graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<bool>> PlayerSchema::unlink_wallet(UnlinkWallet request) {
     return send_request_for_one<bool>(request);
 }
 
+void PlayerSchema::unlink_wallet(UnlinkWallet request, graphql::GraphqlCallback<bool> callback) {
+    send_request_for_one<bool>(request, std::move(callback));
+}
+
 }
@@ -16,6 +16,7 @@
 #include "enjinsdk/player/AdvancedSendAsset.hpp"
 
 #include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include <utility>
 
 using namespace enjin::sdk::graphql;
@@ -30,7 +31,20 @@ AdvancedSendAsset::AdvancedSendAsset() : AbstractGraphqlRequest("enjin.sdk.playe
 }
 
 std::string AdvancedSendAsset::serialize() const {
-    return to_json().to_string();
+    JsonWriter writer;
+    serialize(writer);
+
+    return writer.to_string();
+}
+
+void AdvancedSendAsset::serialize(JsonWriter& writer) const {
+    writer.start_object();
+
+    TransactionFragmentArguments<AdvancedSendAsset>::serialize_fields(writer);
+    JsonUtils::try_write_field(writer, "transfers", transfers_opt);
+    JsonUtils::try_write_field(writer, "data", data_opt);
+
+    writer.end_object();
 }
 
 AdvancedSendAsset& AdvancedSendAsset::set_transfers(std::vector<TransferInput> transfers) {
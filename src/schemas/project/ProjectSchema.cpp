@@ -20,146 +20,298 @@
 namespace enjin::sdk::project {
 
 ProjectSchema::ProjectSchema(std::unique_ptr<http::IHttpClient> http_client,
-                             std::shared_ptr<utils::LoggerProvider> logger_provider)
-        : shared::SharedSchema(std::move(http_client), "project", std::move(logger_provider)) {
+                             std::shared_ptr<utils::LoggerProvider> logger_provider,
+                             std::shared_ptr<utils::IExecutor> executor)
+        : shared::SharedSchema(std::move(http_client), "project", std::move(logger_provider), std::move(executor)) {
 }
 
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::advanced_send_asset(AdvancedSendAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::advanced_send_asset(AdvancedSendAsset request,
+                                        graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::approve_enj(ApproveEnj request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::approve_enj(ApproveEnj request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::approve_enj_max(ApproveMaxEnj request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::approve_enj_max(ApproveMaxEnj request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::AccessToken>> ProjectSchema::auth_player(AuthPlayer request) {
     return send_request_for_one<models::AccessToken>(request);
 }
 
+void ProjectSchema::auth_player(AuthPlayer request, graphql::GraphqlCallback<models::AccessToken> callback) {
+    send_request_for_one<models::AccessToken>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::AccessToken>> ProjectSchema::auth_project(AuthProject request) {
     return send_request_for_one<models::AccessToken>(request);
 }
 
+void ProjectSchema::auth_project(AuthProject request, graphql::GraphqlCallback<models::AccessToken> callback) {
+    send_request_for_one<models::AccessToken>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::bridge_asset(BridgeAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::bridge_asset(BridgeAsset request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::bridge_assets(BridgeAssets request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::bridge_assets(BridgeAssets request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::bridge_claim_asset(BridgeClaimAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::bridge_claim_asset(BridgeClaimAsset request,
+                                       graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::complete_trade(CompleteTrade request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::complete_trade(CompleteTrade request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::create_asset(CreateAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::create_asset(CreateAsset request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::AccessToken>> ProjectSchema::create_player(CreatePlayer request) {
     return send_request_for_one<models::AccessToken>(request);
 }
 
+void ProjectSchema::create_player(CreatePlayer request, graphql::GraphqlCallback<models::AccessToken> callback) {
+    send_request_for_one<models::AccessToken>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::create_trade(CreateTrade request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::create_trade(CreateTrade request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>>
 ProjectSchema::decrease_max_melt_fee(DecreaseMaxMeltFee request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::decrease_max_melt_fee(DecreaseMaxMeltFee request,
+                                          graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>>
 ProjectSchema::decrease_max_transfer_fee(DecreaseMaxTransferFee request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::decrease_max_transfer_fee(DecreaseMaxTransferFee request,
+                                              graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<bool>> ProjectSchema::delete_player(DeletePlayer request) {
     return send_request_for_one<bool>(request);
 }
 
+void ProjectSchema::delete_player(DeletePlayer request, graphql::GraphqlCallback<bool> callback) {
+    send_request_for_one<bool>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Player>> ProjectSchema::get_player(GetPlayer request) {
     return send_request_for_one<models::Player>(request);
 }
 
+void ProjectSchema::get_player(GetPlayer request, graphql::GraphqlCallback<models::Player> callback) {
+    send_request_for_one<models::Player>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<std::vector<models::Player>>> ProjectSchema::get_players(GetPlayers request) {
     return send_request_for_many<models::Player>(request);
 }
 
+void ProjectSchema::get_players(GetPlayers request, graphql::GraphqlCallback<std::vector<models::Player>> callback) {
+    send_request_for_many<models::Player>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Wallet>> ProjectSchema::get_wallet(GetWallet request) {
     return send_request_for_one<models::Wallet>(request);
 }
 
+void ProjectSchema::get_wallet(GetWallet request, graphql::GraphqlCallback<models::Wallet> callback) {
+    send_request_for_one<models::Wallet>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<std::vector<models::Wallet>>> ProjectSchema::get_wallets(GetWallets request) {
     return send_request_for_many<models::Wallet>(request);
 }
 
+void ProjectSchema::get_wallets(GetWallets request, graphql::GraphqlCallback<std::vector<models::Wallet>> callback) {
+    send_request_for_many<models::Wallet>(request, std::move(callback));
+}
+
+std::future<graphql::GraphqlResponse<models::WalletTable>> ProjectSchema::get_wallets_table(GetWallets request) {
+    return send_request_for_table<models::Wallet>(request);
+}
+
+void ProjectSchema::get_wallets_table(GetWallets request, graphql::GraphqlCallback<models::WalletTable> callback) {
+    send_request_for_table<models::Wallet>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<bool>> ProjectSchema::invalidate_asset_metadata(InvalidateAssetMetadata request) {
     return send_request_for_one<bool>(request);
 }
 
+void ProjectSchema::invalidate_asset_metadata(InvalidateAssetMetadata request,
+                                              graphql::GraphqlCallback<bool> callback) {
+    send_request_for_one<bool>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::melt_asset(MeltAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::melt_asset(MeltAsset request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::message(Message request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::message(Message request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::mint_asset(MintAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::mint_asset(MintAsset request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::release_reserve(ReleaseReserve request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::release_reserve(ReleaseReserve request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::reset_enj_approval(ResetEnjApproval request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::reset_enj_approval(ResetEnjApproval request,
+                                       graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::send_asset(SendAsset request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::send_asset(SendAsset request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::send_enj(SendEnj request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::send_enj(SendEnj request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::set_approval_for_all(SetApprovalForAll request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::set_approval_for_all(SetApprovalForAll request,
+                                         graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::set_melt_fee(SetMeltFee request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::set_melt_fee(SetMeltFee request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::set_transfer_fee(SetTransferFee request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::set_transfer_fee(SetTransferFee request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::set_transferable(SetTransferable request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::set_transferable(SetTransferable request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::set_uri(SetUri request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::set_uri(SetUri request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> ProjectSchema::set_whitelisted(SetWhitelisted request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void ProjectSchema::set_whitelisted(SetWhitelisted request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<bool>> ProjectSchema::unlink_wallet(UnlinkWallet request) {
     return send_request_for_one<bool>(request);
 }
 
+void ProjectSchema::unlink_wallet(UnlinkWallet request, graphql::GraphqlCallback<bool> callback) {
+    send_request_for_one<bool>(request, std::move(callback));
+}
+
 }
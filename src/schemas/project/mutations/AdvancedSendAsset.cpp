@@ -16,6 +16,7 @@
 #include "enjinsdk/project/AdvancedSendAsset.hpp"
 
 #include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include <utility>
 
 using namespace enjin::sdk::graphql;
@@ -29,7 +30,20 @@ AdvancedSendAsset::AdvancedSendAsset() : AbstractGraphqlRequest("enjin.sdk.proje
 }
 
 std::string AdvancedSendAsset::serialize() const {
-    return to_json().to_string();
+    JsonWriter writer;
+    serialize(writer);
+
+    return writer.to_string();
+}
+
+void AdvancedSendAsset::serialize(JsonWriter& writer) const {
+    writer.start_object();
+
+    TransactionRequestArguments<AdvancedSendAsset>::serialize_fields(writer);
+    JsonUtils::try_write_field(writer, "transfers", transfers_opt);
+    JsonUtils::try_write_field(writer, "data", data_opt);
+
+    writer.end_object();
 }
 
 AdvancedSendAsset& AdvancedSendAsset::set_transfers(std::vector<TransferInput> transfers) {
@@ -16,6 +16,7 @@
 #include "enjinsdk/project/MintAsset.hpp"
 
 #include "enjinsdk/JsonUtils.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include <utility>
 
 using namespace enjin::sdk::graphql;
@@ -29,7 +30,20 @@ MintAsset::MintAsset() : AbstractGraphqlRequest("enjin.sdk.project.MintAsset"),
 }
 
 std::string MintAsset::serialize() const {
-    return to_json().to_string();
+    JsonWriter writer;
+    serialize(writer);
+
+    return writer.to_string();
+}
+
+void MintAsset::serialize(JsonWriter& writer) const {
+    writer.start_object();
+
+    TransactionRequestArguments<MintAsset>::serialize_fields(writer);
+    JsonUtils::try_write_field(writer, "assetId", asset_id_opt);
+    JsonUtils::try_write_field(writer, "mints", mints_opt);
+
+    writer.end_object();
 }
 
 MintAsset& MintAsset::set_asset_id(std::string asset_id) {
@@ -21,44 +21,100 @@ namespace enjin::sdk::shared {
 
 SharedSchema::SharedSchema(std::unique_ptr<http::IHttpClient> http_client,
                            std::string schema,
-                           std::shared_ptr<utils::LoggerProvider> logger_provider)
-        : BaseSchema(std::move(http_client), std::move(schema), std::move(logger_provider)) {
+                           std::shared_ptr<utils::LoggerProvider> logger_provider,
+                           std::shared_ptr<utils::IExecutor> executor)
+        : BaseSchema(std::move(http_client), std::move(schema), std::move(logger_provider), std::move(executor)) {
 }
 
 std::future<graphql::GraphqlResponse<bool>> SharedSchema::cancel_transaction(CancelTransaction request) {
     return send_request_for_one<bool>(request);
 }
 
+void SharedSchema::cancel_transaction(CancelTransaction request, graphql::GraphqlCallback<bool> callback) {
+    send_request_for_one<bool>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<std::vector<models::Balance>>> SharedSchema::get_balances(GetBalances request) {
     return send_request_for_many<models::Balance>(request);
 }
 
+void SharedSchema::get_balances(GetBalances request, graphql::GraphqlCallback<std::vector<models::Balance>> callback) {
+    send_request_for_many<models::Balance>(request, std::move(callback));
+}
+
+std::future<graphql::GraphqlResponse<models::BalanceTable>> SharedSchema::get_balances_table(GetBalances request) {
+    return send_request_for_table<models::Balance>(request);
+}
+
+void SharedSchema::get_balances_table(GetBalances request, graphql::GraphqlCallback<models::BalanceTable> callback) {
+    send_request_for_table<models::Balance>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::GasPrices>> SharedSchema::get_gas_prices(GetGasPrices request) {
     return send_request_for_one<models::GasPrices>(request);
 }
 
+void SharedSchema::get_gas_prices(GetGasPrices request, graphql::GraphqlCallback<models::GasPrices> callback) {
+    send_request_for_one<models::GasPrices>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Platform>> SharedSchema::get_platform(GetPlatform request) {
     return send_request_for_one<models::Platform>(request);
 }
 
+void SharedSchema::get_platform(GetPlatform request, graphql::GraphqlCallback<models::Platform> callback) {
+    send_request_for_one<models::Platform>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Project>> SharedSchema::get_project(GetProject request) {
     return send_request_for_one<models::Project>(request);
 }
 
+void SharedSchema::get_project(GetProject request, graphql::GraphqlCallback<models::Project> callback) {
+    send_request_for_one<models::Project>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Transaction>> SharedSchema::get_request(GetTransaction request) {
     return send_request_for_one<models::Transaction>(request);
 }
 
+void SharedSchema::get_request(GetTransaction request, graphql::GraphqlCallback<models::Transaction> callback) {
+    send_request_for_one<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<std::vector<models::Transaction>>> SharedSchema::get_requests(GetTransactions request) {
     return send_request_for_many<models::Transaction>(request);
 }
 
+void SharedSchema::get_requests(GetTransactions request,
+                                graphql::GraphqlCallback<std::vector<models::Transaction>> callback) {
+    send_request_for_many<models::Transaction>(request, std::move(callback));
+}
+
+std::future<graphql::GraphqlResponse<models::TransactionTable>>
+SharedSchema::get_requests_table(GetTransactions request) {
+    return send_request_for_table<models::Transaction>(request);
+}
+
+void SharedSchema::get_requests_table(GetTransactions request,
+                                      graphql::GraphqlCallback<models::TransactionTable> callback) {
+    send_request_for_table<models::Transaction>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<models::Asset>> SharedSchema::get_asset(GetAsset request) {
     return send_request_for_one<models::Asset>(request);
 }
 
+void SharedSchema::get_asset(GetAsset request, graphql::GraphqlCallback<models::Asset> callback) {
+    send_request_for_one<models::Asset>(request, std::move(callback));
+}
+
 std::future<graphql::GraphqlResponse<std::vector<models::Asset>>> SharedSchema::get_assets(GetAssets request) {
     return send_request_for_many<models::Asset>(request);
 }
 
+void SharedSchema::get_assets(GetAssets request, graphql::GraphqlCallback<std::vector<models::Asset>> callback) {
+    send_request_for_many<models::Asset>(request, std::move(callback));
+}
+
 }
@@ -0,0 +1,142 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompressionUtils.hpp"
+
+#include "enjinsdk_utils/StringUtils.hpp"
+#include "zlib.h"
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+namespace enjin::sdk::utils {
+
+namespace {
+
+// Window bits selecting the gzip wrapper for deflate and automatic gzip/zlib detection for inflate
+constexpr int GzipWindowBits = 15 + 16;
+constexpr int AutoDetectWindowBits = 15 + 32;
+constexpr int RawDeflateWindowBits = -15;
+constexpr int MemoryLevel = 8;
+constexpr std::size_t ChunkSize = 16384;
+
+std::string normalize_content_encoding(const std::string& content_encoding) {
+    return enjin::utils::to_lower(enjin::utils::trim(content_encoding));
+}
+
+bool inflate_with_window_bits(const std::string& data, int window_bits, std::size_t max_size, std::string& out) {
+    if (data.size() > std::numeric_limits<uInt>::max()) {
+        throw std::runtime_error("Compressed data is too large to be decompressed");
+    }
+
+    z_stream stream{};
+    if (inflateInit2(&stream, window_bits) != Z_OK) {
+        throw std::runtime_error("Failed to initialize decompression stream");
+    }
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+
+    std::array<char, ChunkSize> buffer{};
+    int result;
+    do {
+        stream.next_out = reinterpret_cast<Bytef*>(buffer.data());
+        stream.avail_out = static_cast<uInt>(buffer.size());
+
+        result = inflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK && result != Z_STREAM_END) {
+            break;
+        }
+
+        out.append(buffer.data(), buffer.size() - stream.avail_out);
+        if (max_size > 0 && out.size() > max_size) {
+            inflateEnd(&stream);
+            throw std::runtime_error("Decompressed data exceeds the maximum size of " + std::to_string(max_size)
+                                     + " bytes");
+        }
+    } while (result != Z_STREAM_END && (stream.avail_in > 0 || stream.avail_out == 0));
+
+    inflateEnd(&stream);
+    return result == Z_STREAM_END;
+}
+
+}
+
+std::string gzip_compress(const std::string& data) {
+    if (data.size() > std::numeric_limits<uInt>::max()) {
+        throw std::runtime_error("Data is too large to be compressed");
+    }
+
+    z_stream stream{};
+    if (deflateInit2(&stream,
+                     Z_DEFAULT_COMPRESSION,
+                     Z_DEFLATED,
+                     GzipWindowBits,
+                     MemoryLevel,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error("Failed to initialize compression stream");
+    }
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+
+    std::string out;
+    out.reserve(deflateBound(&stream, stream.avail_in));
+
+    std::array<char, ChunkSize> buffer{};
+    int result;
+    do {
+        stream.next_out = reinterpret_cast<Bytef*>(buffer.data());
+        stream.avail_out = static_cast<uInt>(buffer.size());
+
+        result = deflate(&stream, Z_FINISH);
+        if (result == Z_STREAM_ERROR) {
+            deflateEnd(&stream);
+            throw std::runtime_error("Failed to compress data");
+        }
+
+        out.append(buffer.data(), buffer.size() - stream.avail_out);
+    } while (result != Z_STREAM_END);
+
+    deflateEnd(&stream);
+    return out;
+}
+
+std::string decompress(const std::string& data, const std::string& content_encoding, std::size_t max_size) {
+    const std::string encoding = normalize_content_encoding(content_encoding);
+    if (!is_supported_content_encoding(encoding)) {
+        throw std::runtime_error("Unsupported content encoding '" + content_encoding + "'");
+    }
+
+    std::string out;
+    if (inflate_with_window_bits(data, AutoDetectWindowBits, max_size, out)) {
+        return out;
+    }
+
+    // Some servers send "deflate" content without the zlib wrapper
+    out.clear();
+    if (encoding == "deflate" && inflate_with_window_bits(data, RawDeflateWindowBits, max_size, out)) {
+        return out;
+    }
+
+    throw std::runtime_error("Failed to decompress data with content encoding '" + content_encoding + "'");
+}
+
+bool is_supported_content_encoding(const std::string& content_encoding) {
+    const std::string encoding = normalize_content_encoding(content_encoding);
+    return encoding == "gzip" || encoding == "x-gzip" || encoding == "deflate";
+}
+
+}
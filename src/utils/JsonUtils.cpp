@@ -16,6 +16,7 @@
 #include "enjinsdk/JsonUtils.hpp"
 
 using namespace enjin::sdk::json;
+using namespace enjin::sdk::models;
 using namespace enjin::sdk::utils;
 
 void JsonUtils::join_object(JsonValue& json, const JsonValue& other) {
@@ -31,3 +32,83 @@ void JsonUtils::join_object(JsonValue& json, const JsonValue& other) {
         }
     }
 }
+
+void JsonUtils::write_value(JsonWriter& writer, bool value) {
+    writer.write_bool(value);
+}
+
+void JsonUtils::write_value(JsonWriter& writer, double value) {
+    writer.write_number(value);
+}
+
+void JsonUtils::write_value(JsonWriter& writer, float value) {
+    writer.write_number(value);
+}
+
+void JsonUtils::write_value(JsonWriter& writer, int value) {
+    writer.write_number(value);
+}
+
+void JsonUtils::write_value(JsonWriter& writer, long value) {
+    writer.write_number(value);
+}
+
+void JsonUtils::write_value(JsonWriter& writer, const std::string& value) {
+    writer.write_string(value);
+}
+
+void JsonUtils::write_value(JsonWriter& writer, const JsonValue& value) {
+    writer.write_value(value);
+}
+
+void JsonUtils::write_value(JsonWriter& writer, AssetField value) {
+    writer.write_string(EnumUtils::serialize_asset_field(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, AssetIdFormat value) {
+    writer.write_string(EnumUtils::serialize_asset_id_format(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, AssetIndexFormat value) {
+    writer.write_string(EnumUtils::serialize_asset_index_format(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, AssetSupplyModel value) {
+    writer.write_string(EnumUtils::serialize_asset_supply_model(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, AssetTransferFeeType value) {
+    writer.write_string(EnumUtils::serialize_asset_transfer_fee_type(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, AssetTransferable value) {
+    writer.write_string(EnumUtils::serialize_asset_transferable(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, AssetVariantMode value) {
+    writer.write_string(EnumUtils::serialize_asset_variant_mode(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, Operator value) {
+    writer.write_string(EnumUtils::serialize_operator(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, SortDirection value) {
+    writer.write_string(EnumUtils::serialize_sort_direction(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, TransactionField value) {
+    writer.write_string(EnumUtils::serialize_transaction_field(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, TransactionState value) {
+    writer.write_string(EnumUtils::serialize_transaction_state(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, TransactionType value) {
+    writer.write_string(EnumUtils::serialize_transaction_type(value));
+}
+
+void JsonUtils::write_value(JsonWriter& writer, Whitelisted value) {
+    writer.write_string(EnumUtils::serialize_whitelisted(value));
+}
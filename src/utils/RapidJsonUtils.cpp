@@ -15,6 +15,7 @@
 
 #include "RapidJsonUtils.hpp"
 
+#include "JsonParser.hpp"
 #include <stdexcept>
 
 namespace enjin::sdk::utils {
@@ -25,9 +26,8 @@ void join_serialized_object_to_document(rapidjson::Document& document, const std
     }
 
     rapidjson::Document object_document;
-    object_document.Parse(o.c_str());
 
-    if (!object_document.IsObject()) {
+    if (!json::parse_document(object_document, o) || !object_document.IsObject()) {
         return;
     }
 
@@ -173,9 +173,8 @@ void set_object_member_from_string(rapidjson::Document& document, const std::str
     auto& allocator = document.GetAllocator();
 
     rapidjson::Document v_document(&allocator);
-    v_document.Parse(value.c_str());
 
-    if (!v_document.IsObject()) {
+    if (!json::parse_document(v_document, value) || !v_document.IsObject()) {
         return;
     }
 
@@ -0,0 +1,192 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/StringInternPool.hpp"
+
+#include "InternedString.hpp"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+using namespace enjin::sdk::json;
+using namespace enjin::sdk::utils;
+
+struct InternedString::PoolEntry {
+    std::optional<std::string> value;
+
+    /// \brief The generation of the shard holding this entry when the entry was added to it.
+    std::size_t generation;
+};
+
+namespace {
+
+using Entry = std::shared_ptr<const InternedString::PoolEntry>;
+
+/// \brief Process-wide pool of interned strings, split into shards so that threads deserializing different strings
+/// rarely contend for the same lock.
+class StringInternPool final {
+public:
+    static constexpr std::size_t ShardCount = 16;
+
+    std::atomic<bool> enabled = false;
+    std::atomic<std::size_t> max_strings = DefaultMaxInternedStrings;
+    std::atomic<std::size_t> strings = 0;
+    std::atomic<std::size_t> hits = 0;
+    std::atomic<std::size_t> misses = 0;
+
+    static StringInternPool& get_instance() {
+        static StringInternPool instance;
+        return instance;
+    }
+
+    void clear() {
+        for (Shard& shard: shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            strings.fetch_sub(shard.entries.size(), std::memory_order_relaxed);
+            shard.entries.clear();
+            shard.generation++;
+        }
+    }
+
+    /// \brief Returns the entry for the given value, adding it to the pool if it is not in it yet.
+    /// \param value The value.
+    /// \return The entry, or null if the value is not in the pool and the pool is full.
+    Entry intern(std::string_view value) {
+        Shard& shard = shards[std::hash<std::string_view>()(value) % ShardCount];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto it = shard.entries.find(value);
+        if (it != shard.entries.end()) {
+            hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second;
+        }
+
+        misses.fetch_add(1, std::memory_order_relaxed);
+        if (strings.load(std::memory_order_relaxed) >= max_strings.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+
+        Entry entry = std::make_shared<const InternedString::PoolEntry>(
+                InternedString::PoolEntry{std::string(value), shard.generation});
+        // Keyed by a view of the entry's own string, which does not move since the entry is never modified
+        shard.entries.emplace(std::string_view(entry->value.value()), entry);
+        strings.fetch_add(1, std::memory_order_relaxed);
+
+        return entry;
+    }
+
+private:
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string_view, Entry> entries;
+
+        // Incremented along with the entries being removed whenever the pool is cleared, so that the entries added to
+        // this shard for equal values are never of the same generation
+        std::size_t generation = 0;
+    };
+
+    std::array<Shard, ShardCount> shards;
+};
+
+}
+
+namespace enjin::sdk::utils {
+
+void clear_string_intern_pool() {
+    StringInternPool::get_instance().clear();
+}
+
+StringInternPoolStats get_string_intern_pool_stats() {
+    const StringInternPool& pool = StringInternPool::get_instance();
+
+    StringInternPoolStats stats;
+    stats.strings = pool.strings.load(std::memory_order_relaxed);
+    stats.hits = pool.hits.load(std::memory_order_relaxed);
+    stats.misses = pool.misses.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+bool is_string_interning_enabled() {
+    return StringInternPool::get_instance().enabled.load(std::memory_order_relaxed);
+}
+
+void set_string_interning(bool enabled, std::size_t max_strings) {
+    StringInternPool& pool = StringInternPool::get_instance();
+    pool.max_strings.store(max_strings, std::memory_order_relaxed);
+    pool.enabled.store(enabled, std::memory_order_relaxed);
+}
+
+}
+
+const std::optional<std::string>& InternedString::get() const noexcept {
+    if (shared != nullptr) {
+        return shared->value;
+    }
+
+    return owned;
+}
+
+void InternedString::reset() noexcept {
+    owned.reset();
+    shared.reset();
+}
+
+void InternedString::set(std::string_view value) {
+    reset();
+
+    StringInternPool& pool = StringInternPool::get_instance();
+    if (pool.enabled.load(std::memory_order_relaxed)) {
+        shared = pool.intern(value);
+    }
+
+    if (shared == nullptr) {
+        owned.emplace(value);
+    }
+}
+
+bool InternedString::try_get_field(const JsonView& json, const std::string& key) {
+    std::string_view new_field;
+    JsonView value;
+
+    if (json.try_get_object_field(key, value) && value.try_get_string(new_field)) {
+        set(new_field);
+        return true;
+    }
+
+    reset();
+    return false;
+}
+
+bool InternedString::operator==(const InternedString& rhs) const {
+    if (shared != nullptr && rhs.shared != nullptr) {
+        if (shared == rhs.shared) {
+            return true;
+        }
+
+        // Equal values are held by the same shard, whose entries of a single generation hold different values
+        if (shared->generation == rhs.shared->generation) {
+            return false;
+        }
+    }
+
+    return get() == rhs.get();
+}
+
+bool InternedString::operator!=(const InternedString& rhs) const {
+    return !(*this == rhs);
+}
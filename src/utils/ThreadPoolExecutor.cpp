@@ -0,0 +1,353 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/ThreadPoolExecutor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace enjin::sdk::utils;
+
+namespace {
+
+class WorkerPool;
+
+/// \brief The pool of the worker running on this thread.
+thread_local const WorkerPool* current_pool = nullptr;
+
+/// \brief The index of the worker running on this thread.
+thread_local std::size_t current_index = 0;
+
+/// \brief State shared by an executor and its workers, which keeps it alive for a worker still running after the
+/// executor has been destroyed from a task.
+class WorkerPool final {
+public:
+    WorkerPool() = delete;
+
+    WorkerPool(std::size_t worker_count, std::size_t max_queue_depth)
+            : max_queue_depth(max_queue_depth),
+              queues(resolve_worker_count(worker_count)) {
+    }
+
+    void execute(std::function<void()> task) {
+        if (!task) {
+            return;
+        } else if (stopping.load()) {
+            throw std::runtime_error("Cannot execute task after executor was shut down");
+        }
+
+        std::size_t current = pending.load(std::memory_order_relaxed);
+        do {
+            if (max_queue_depth != 0 && current >= max_queue_depth) {
+                // Queue is saturated, so the caller runs the task itself
+                run_task(task);
+                return;
+            }
+        } while (!pending.compare_exchange_weak(current, current + 1));
+
+        // Checked again once the task is counted, as workers only exit after stopping with no task pending
+        if (stopping.load()) {
+            release_pending();
+            throw std::runtime_error("Cannot execute task after executor was shut down");
+        }
+
+        // Tasks scheduled from a worker stay with that worker, otherwise they are spread across the workers
+        const std::size_t index = current_pool == this
+                                  ? current_index
+                                  : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        {
+            std::lock_guard<std::mutex> guard(queues[index].mutex);
+            queues[index].tasks.push_back(std::move(task));
+            queued++;
+        }
+
+        wake_one();
+    }
+
+    [[nodiscard]] bool is_worker_thread() const {
+        return current_pool == this;
+    }
+
+    void stop() {
+        stopping.store(true);
+        wake_all();
+    }
+
+    [[nodiscard]] bool is_shutdown() const {
+        return stopping.load();
+    }
+
+    [[nodiscard]] std::size_t get_worker_count() const {
+        return queues.size();
+    }
+
+    [[nodiscard]] std::size_t get_max_queue_depth() const {
+        return max_queue_depth;
+    }
+
+    [[nodiscard]] std::size_t get_pending_count() const {
+        return pending.load();
+    }
+
+    void run(std::size_t index) {
+        current_pool = this;
+        current_index = index;
+
+        while (true) {
+            std::function<void()> task;
+            if (try_pop(index, task) || try_steal(index, task)) {
+                release_pending();
+                run_task(task);
+                continue;
+            } else if (stopping.load() && pending.load() == 0) {
+                break;
+            }
+
+            park();
+        }
+
+        current_pool = nullptr;
+    }
+
+private:
+    struct TaskQueue {
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+    };
+
+    const std::size_t max_queue_depth;
+
+    std::vector<TaskQueue> queues;
+    std::atomic<std::size_t> next_queue = 0;
+
+    std::atomic<bool> stopping = false;
+
+    // Tasks accepted by execute() and not yet taken by a worker, including those not yet pushed to a queue
+    std::atomic<std::size_t> pending = 0;
+
+    // Tasks held by the queues, which is only changed while holding the mutex of the queue being changed
+    std::atomic<std::size_t> queued = 0;
+
+    // Workers parked on the condition variable, which the mutex and condition variable are only touched for
+    std::atomic<std::size_t> parked = 0;
+    std::condition_variable state_cv;
+
+    // Mutexes
+    std::mutex state_mutex;
+
+    bool try_pop(std::size_t index, std::function<void()>& out) {
+        TaskQueue& queue = queues[index];
+
+        std::lock_guard<std::mutex> guard(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+
+        // The owner takes its most recent task, whose data is the most likely to still be in its cache
+        out = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        queued--;
+        return true;
+    }
+
+    bool try_steal(std::size_t index, std::function<void()>& out) {
+        for (std::size_t i = 1; i < queues.size(); i++) {
+            TaskQueue& victim = queues[(index + i) % queues.size()];
+
+            std::lock_guard<std::mutex> guard(victim.mutex);
+            if (victim.tasks.empty()) {
+                continue;
+            }
+
+            // Thieves take the oldest task, away from the end the owner works on
+            out = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued--;
+            return true;
+        }
+
+        return false;
+    }
+
+    void release_pending() {
+        // Workers parked while stopping exit once the last pending task is taken
+        if (pending.fetch_sub(1) == 1 && stopping.load()) {
+            wake_all();
+        }
+    }
+
+    void park() {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        parked++;
+
+        // Registered as parked before checking for work, so that a task queued after the check is seen to need a wake
+        state_cv.wait(lock, [this]() {
+            return queued.load() > 0 || (stopping.load() && pending.load() == 0);
+        });
+
+        parked--;
+    }
+
+    void wake_one() {
+        if (parked.load() == 0) {
+            return;
+        }
+
+        // Taking the mutex orders the notification after a parking worker has either seen the new state or started
+        // waiting
+        {
+            std::lock_guard<std::mutex> guard(state_mutex);
+        }
+
+        state_cv.notify_one();
+    }
+
+    void wake_all() {
+        if (parked.load() == 0) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(state_mutex);
+        }
+
+        state_cv.notify_all();
+    }
+
+    static void run_task(std::function<void()>& task) {
+        try {
+            task();
+        } catch (...) {
+            // Tasks submitted through IExecutor::submit() deliver their exceptions through their futures
+        }
+    }
+
+    static std::size_t resolve_worker_count(std::size_t worker_count) {
+        if (worker_count != 0) {
+            return worker_count;
+        }
+
+        const unsigned int hardware_concurrency = std::thread::hardware_concurrency();
+        return hardware_concurrency == 0 ? 1 : hardware_concurrency;
+    }
+};
+
+}
+
+class ThreadPoolExecutor::Impl final {
+public:
+    Impl() = delete;
+
+    Impl(std::size_t worker_count, std::size_t max_queue_depth)
+            : pool(std::make_shared<WorkerPool>(worker_count, max_queue_depth)) {
+        workers.reserve(pool->get_worker_count());
+        for (std::size_t i = 0; i < pool->get_worker_count(); i++) {
+            // Each worker shares the pool, so a worker which destroys the executor from a task keeps it alive
+            workers.emplace_back([shared_pool = pool, i]() {
+                shared_pool->run(i);
+            });
+        }
+    }
+
+    ~Impl() {
+        shutdown();
+    }
+
+    void execute(std::function<void()> task) {
+        // Held for the call, as the task may destroy the executor before the caller has finished waking a worker
+        const std::shared_ptr<WorkerPool> shared_pool = pool;
+        shared_pool->execute(std::move(task));
+    }
+
+    [[nodiscard]] bool is_worker_thread() const {
+        return pool->is_worker_thread();
+    }
+
+    void shutdown() {
+        pool->stop();
+
+        for (auto& worker: workers) {
+            if (!worker.joinable()) {
+                continue;
+            } else if (worker.get_id() == std::this_thread::get_id()) {
+                // A worker cannot join itself and will exit once the pending tasks are done, sharing the pool until
+                // then
+                worker.detach();
+            } else {
+                worker.join();
+            }
+        }
+    }
+
+    [[nodiscard]] bool is_shutdown() const {
+        return pool->is_shutdown();
+    }
+
+    [[nodiscard]] std::size_t get_worker_count() const {
+        return pool->get_worker_count();
+    }
+
+    [[nodiscard]] std::size_t get_max_queue_depth() const {
+        return pool->get_max_queue_depth();
+    }
+
+    [[nodiscard]] std::size_t get_pending_count() const {
+        return pool->get_pending_count();
+    }
+
+private:
+    std::shared_ptr<WorkerPool> pool;
+    std::vector<std::thread> workers;
+};
+
+ThreadPoolExecutor::ThreadPoolExecutor(std::size_t worker_count, std::size_t max_queue_depth)
+        : pimpl(std::make_unique<Impl>(worker_count, max_queue_depth)) {
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor() = default;
+
+void ThreadPoolExecutor::execute(std::function<void()> task) {
+    pimpl->execute(std::move(task));
+}
+
+bool ThreadPoolExecutor::is_worker_thread() const {
+    return pimpl->is_worker_thread();
+}
+
+void ThreadPoolExecutor::shutdown() {
+    pimpl->shutdown();
+}
+
+bool ThreadPoolExecutor::is_shutdown() const {
+    return pimpl->is_shutdown();
+}
+
+std::size_t ThreadPoolExecutor::get_worker_count() const {
+    return pimpl->get_worker_count();
+}
+
+std::size_t ThreadPoolExecutor::get_max_queue_depth() const {
+    return pimpl->get_max_queue_depth();
+}
+
+std::size_t ThreadPoolExecutor::get_pending_count() const {
+    return pimpl->get_pending_count();
+}
@@ -0,0 +1,77 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL
+#define ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL 0
+#endif
+
+#if ENJINSDK_INCLUDE_HTTP2_CLIENT_IMPL
+
+#ifndef ENJINCPPSDK_MOCKHTTP2SERVER_HPP
+#define ENJINCPPSDK_MOCKHTTP2SERVER_HPP
+
+#include "enjinsdk/HttpRequest.hpp"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace enjin::test::mocks {
+
+/// \brief Mock HTTP/2 server speaking cleartext HTTP/2 with prior knowledge (h2c) for testing HTTP/2 clients.
+/// \remarks Every request received is answered with the same stubbed response.
+class MockHttp2Server {
+public:
+    /// \brief Constructs a mock server instance.
+    MockHttp2Server();
+
+    /// \brief Destructor.
+    ~MockHttp2Server();
+
+    /// \brief Starts the server.
+    void start();
+
+    /// \brief Stops the server.
+    void stop();
+
+    /// \brief Sets the response this server sends for every request.
+    /// \param status_code The status code.
+    /// \param body The body.
+    /// \param headers The headers.
+    void respond_with(int status_code, std::string body, std::map<std::string, std::string> headers = {});
+
+    /// \brief Returns the URI for this server.
+    /// \return The URI.
+    std::string uri();
+
+    /// \brief Returns the number of connections this server has accepted.
+    /// \return The number of connections.
+    [[nodiscard]] std::size_t get_connection_count() const;
+
+    /// \brief Returns the requests received by this server, with the pseudo-headers left out of their headers.
+    /// \return The requests.
+    [[nodiscard]] std::vector<sdk::http::HttpRequest> get_received_requests() const;
+
+private:
+    class Impl;
+
+    Impl* impl;
+};
+
+}
+
+#endif //ENJINCPPSDK_MOCKHTTP2SERVER_HPP
+
+#endif
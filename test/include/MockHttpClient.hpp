@@ -29,6 +29,10 @@ public:
 
     MOCK_METHOD(std::future<sdk::http::HttpResponse>, send_request, (sdk::http::HttpRequest request), (override));
 
+    MOCK_METHOD(std::optional<sdk::http::CompressionStats>, get_compression_stats, (), (const, override));
+
+    MOCK_METHOD(std::optional<sdk::http::ConnectionPoolStats>, get_connection_pool_stats, (), (const, override));
+
     MOCK_METHOD(bool, is_open, (), (const, override));
 
     MOCK_METHOD(void, set_default_request_header, (std::string key, std::string value), (override));
@@ -0,0 +1,73 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENJINSDK_INCLUDE_HTTP_CLIENT_IMPL
+#define ENJINSDK_INCLUDE_HTTP_CLIENT_IMPL 0
+#endif
+
+#if ENJINSDK_INCLUDE_HTTP_CLIENT_IMPL
+
+#ifndef ENJINCPPSDK_MOCKTLSSERVER_HPP
+#define ENJINCPPSDK_MOCKTLSSERVER_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace enjin::test::mocks {
+
+/// \brief Mock HTTPS server for testing the TLS handshakes of HTTP clients.
+/// \remarks The server presents a self-signed certificate for localhost, which is generated when the server is
+/// constructed, and answers every HTTP/1.1 request with an empty JSON object over a keep-alive connection.
+class MockTlsServer {
+public:
+    /// \brief Constructs a mock server instance.
+    MockTlsServer();
+
+    /// \brief Destructor.
+    ~MockTlsServer();
+
+    /// \brief Starts the server.
+    void start();
+
+    /// \brief Stops the server.
+    void stop();
+
+    /// \brief Returns the URI for this server.
+    /// \return The URI.
+    std::string uri();
+
+    /// \brief Returns the certificate of this server in PEM format, for clients to trust.
+    /// \return The certificate.
+    [[nodiscard]] std::string get_certificate_pem() const;
+
+    /// \brief Returns the number of connections which completed a TLS handshake with this server.
+    /// \return The number of connections.
+    [[nodiscard]] std::size_t get_connection_count() const;
+
+    /// \brief Returns the number of connections whose TLS handshake resumed a previous session.
+    /// \return The number of connections.
+    [[nodiscard]] std::size_t get_resumed_connection_count() const;
+
+private:
+    class Impl;
+
+    Impl* impl;
+};
+
+}
+
+#endif //ENJINCPPSDK_MOCKTLSSERVER_HPP
+
+#endif
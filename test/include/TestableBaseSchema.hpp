@@ -17,8 +17,11 @@
 #define ENJINSDK_TESTABLEBASESCHEMA_HPP
 
 #include "enjinsdk/BaseSchema.hpp"
+#include "enjinsdk/IExecutor.hpp"
 #include "enjinsdk/IHttpClient.hpp"
+#include <memory>
 #include <string>
+#include <utility>
 
 namespace enjin::test::utils {
 
@@ -26,7 +29,8 @@ class TestableBaseSchema : public sdk::BaseSchema {
 public:
     TestableBaseSchema() = delete;
 
-    explicit TestableBaseSchema(std::unique_ptr<sdk::http::IHttpClient> http_client);
+    explicit TestableBaseSchema(std::unique_ptr<sdk::http::IHttpClient> http_client,
+                                std::shared_ptr<sdk::utils::IExecutor> executor = nullptr);
 
     ~TestableBaseSchema() = default;
 
@@ -41,11 +45,29 @@ public:
         return BaseSchema::send_request_for_one<T>(request);
     }
 
+    template<class T>
+    void send_request_for_one(sdk::graphql::AbstractGraphqlRequest& request,
+                              sdk::graphql::GraphqlCallback<T> callback) {
+        BaseSchema::send_request_for_one<T>(request, std::move(callback));
+    }
+
     template<class T>
     std::future<sdk::graphql::GraphqlResponse<std::vector<T>>>
     send_request_for_many(sdk::graphql::AbstractGraphqlRequest& request) {
         return BaseSchema::send_request_for_many<T>(request);
     }
+
+    template<class T>
+    void send_request_for_many(sdk::graphql::AbstractGraphqlRequest& request,
+                               sdk::graphql::GraphqlCallback<std::vector<T>> callback) {
+        BaseSchema::send_request_for_many<T>(request, std::move(callback));
+    }
+
+    template<class T>
+    std::future<sdk::graphql::GraphqlResponse<sdk::models::ResultTable<T>>>
+    send_request_for_table(sdk::graphql::AbstractGraphqlRequest& request) {
+        return BaseSchema::send_request_for_table<T>(request);
+    }
 };
 
 }
@@ -29,5 +29,8 @@ std::string FakeGraphqlRequest::serialize() const {
 }
 
 JsonValue FakeGraphqlRequest::to_json() const {
-    return {};
+    JsonValue json;
+    json.try_parse_as_object(serialize_string);
+
+    return json;
 }
@@ -0,0 +1,439 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MockHttp2Server.hpp"
+
+#include "nghttp2/nghttp2.h"
+#include "enjinsdk/EnumUtils.hpp"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <mutex>
+#include <netinet/in.h>
+#include <optional>
+#include <poll.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+using namespace enjin::sdk::http;
+using namespace enjin::sdk::utils;
+using namespace enjin::test::mocks;
+
+class MockHttp2Server::Impl {
+public:
+    Impl() = default;
+
+    ~Impl() {
+        stop();
+    }
+
+    void start() {
+        stop();
+
+        std::lock_guard<std::mutex> guard(server_mutex);
+
+        listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        const int enable = 1;
+        setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t length = sizeof(address);
+        if (bind(listen_fd, reinterpret_cast<sockaddr*>(&address), length) < 0
+            || listen(listen_fd, SOMAXCONN) < 0
+            || getsockname(listen_fd, reinterpret_cast<sockaddr*>(&address), &length) < 0
+            || pipe(wake_fds) < 0) {
+            close(listen_fd);
+            throw std::runtime_error("Unable to start mock HTTP/2 server");
+        }
+
+        port = ntohs(address.sin_port);
+        running = true;
+        server_thread = std::thread([this]() {
+            run();
+        });
+    }
+
+    void stop() {
+        std::unique_lock<std::mutex> lock(server_mutex);
+        if (!running) {
+            return;
+        }
+
+        running = false;
+        port.reset();
+        const char value = 1;
+        [[maybe_unused]] const ssize_t result = write(wake_fds[1], &value, 1);
+        lock.unlock();
+
+        server_thread.join();
+
+        close(listen_fd);
+        close(wake_fds[0]);
+        close(wake_fds[1]);
+    }
+
+    void respond_with(int status_code, std::string body, std::map<std::string, std::string> headers) {
+        std::lock_guard<std::mutex> guard(response_mutex);
+        response_status_code = status_code;
+        response_body = std::move(body);
+        response_headers = std::move(headers);
+    }
+
+    std::string uri() {
+        std::lock_guard<std::mutex> guard(server_mutex);
+
+        if (!port.has_value()) {
+            throw std::runtime_error("Port number is not set");
+        }
+
+        std::stringstream ss;
+        ss << "http://localhost:" << port.value();
+        return ss.str();
+    }
+
+    [[nodiscard]] std::size_t get_connection_count() const {
+        std::lock_guard<std::mutex> guard(requests_mutex);
+        return connection_count;
+    }
+
+    [[nodiscard]] std::vector<HttpRequest> get_received_requests() const {
+        std::lock_guard<std::mutex> guard(requests_mutex);
+        return received_requests;
+    }
+
+private:
+    /// \brief Request being received on a stream.
+    struct StreamData {
+        HttpRequest request;
+        std::string body;
+        std::string response_body;
+        std::size_t response_offset = 0;
+    };
+
+    /// \brief Accepted connection with its server session.
+    struct Connection {
+        Impl* owner = nullptr;
+        int fd = -1;
+        nghttp2_session* session = nullptr;
+        std::map<int32_t, std::unique_ptr<StreamData>> streams;
+
+        ~Connection() {
+            nghttp2_session_del(session);
+            close(fd);
+        }
+    };
+
+    int listen_fd = -1;
+    int wake_fds[2] = {-1, -1};
+    bool running = false;
+    std::optional<int> port;
+    std::vector<std::unique_ptr<Connection>> connections;
+
+    int response_status_code = 200;
+    std::string response_body = "{}";
+    std::map<std::string, std::string> response_headers;
+
+    std::size_t connection_count = 0;
+    std::vector<HttpRequest> received_requests;
+
+    // Threads
+    std::thread server_thread;
+
+    // Mutexes
+    mutable std::mutex requests_mutex;
+    mutable std::mutex response_mutex;
+    mutable std::mutex server_mutex;
+
+    void run() {
+        while (true) {
+            std::vector<pollfd> fds;
+            fds.push_back({wake_fds[0], POLLIN, 0});
+            fds.push_back({listen_fd, POLLIN, 0});
+            for (auto& connection: connections) {
+                short events = POLLIN;
+                if (nghttp2_session_want_write(connection->session) != 0) {
+                    events |= POLLOUT;
+                }
+
+                fds.push_back({connection->fd, events, 0});
+            }
+
+            if (poll(fds.data(), fds.size(), -1) < 0) {
+                continue;
+            } else if (fds[0].revents & POLLIN) {
+                break;
+            }
+
+            if (fds[1].revents & POLLIN) {
+                accept_connection();
+            }
+
+            for (std::size_t i = connections.size(); i > 0; i--) {
+                const std::size_t index = i - 1;
+                const short revents = index + 2 < fds.size() ? fds[index + 2].revents : 0;
+                if (!process(*connections[index], revents)) {
+                    connections.erase(connections.begin() + static_cast<long>(index));
+                }
+            }
+        }
+
+        connections.clear();
+    }
+
+    void accept_connection() {
+        const int fd = accept(listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            return;
+        }
+
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+        auto connection = std::make_unique<Connection>();
+        connection->owner = this;
+        connection->fd = fd;
+
+        nghttp2_session_callbacks* callbacks;
+        nghttp2_session_callbacks_new(&callbacks);
+        nghttp2_session_callbacks_set_send_callback(callbacks, send_callback);
+        nghttp2_session_callbacks_set_on_begin_headers_callback(callbacks, on_begin_headers_callback);
+        nghttp2_session_callbacks_set_on_header_callback(callbacks, on_header_callback);
+        nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks, on_data_chunk_recv_callback);
+        nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks, on_frame_recv_callback);
+        nghttp2_session_callbacks_set_on_stream_close_callback(callbacks, on_stream_close_callback);
+        nghttp2_session_server_new(&connection->session, callbacks, connection.get());
+        nghttp2_session_callbacks_del(callbacks);
+
+        nghttp2_settings_entry settings[] = {{NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, 100}};
+        nghttp2_submit_settings(connection->session, NGHTTP2_FLAG_NONE, settings, 1);
+
+        {
+            std::lock_guard<std::mutex> guard(requests_mutex);
+            connection_count++;
+        }
+
+        connections.push_back(std::move(connection));
+    }
+
+    static bool process(Connection& connection, short revents) {
+        if (revents & (POLLIN | POLLHUP | POLLERR)) {
+            uint8_t buffer[16 * 1024];
+            while (true) {
+                const ssize_t received = recv(connection.fd, buffer, sizeof(buffer), 0);
+                if (received == 0) {
+                    return false;
+                } else if (received < 0) {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                        break;
+                    }
+
+                    return false;
+                } else if (nghttp2_session_mem_recv(connection.session, buffer, received) < 0) {
+                    return false;
+                }
+            }
+        }
+
+        if (nghttp2_session_send(connection.session) != 0) {
+            return false;
+        }
+
+        return nghttp2_session_want_read(connection.session) != 0
+               || nghttp2_session_want_write(connection.session) != 0;
+    }
+
+    void respond(Connection& connection, int32_t stream_id) {
+        auto iter = connection.streams.find(stream_id);
+        if (iter == connection.streams.end()) {
+            return;
+        }
+
+        StreamData& stream = *iter->second;
+        stream.request.set_body(stream.body);
+        {
+            std::lock_guard<std::mutex> guard(requests_mutex);
+            received_requests.push_back(stream.request);
+        }
+
+        std::unique_lock<std::mutex> lock(response_mutex);
+        static const std::string status_name(":status");
+        const std::string status = std::to_string(response_status_code);
+        const std::map<std::string, std::string> headers = response_headers;
+        stream.response_body = response_body;
+        lock.unlock();
+
+        std::vector<nghttp2_nv> nva;
+        nva.push_back(make_nv(status_name, status));
+        for (const auto& [name, value]: headers) {
+            nva.push_back(make_nv(name, value));
+        }
+
+        nghttp2_data_provider data_provider{};
+        data_provider.source.ptr = &stream;
+        data_provider.read_callback = read_response_callback;
+        nghttp2_submit_response(connection.session, stream_id, nva.data(), nva.size(), &data_provider);
+    }
+
+    static nghttp2_nv make_nv(const std::string& name, const std::string& value) {
+        return {
+                reinterpret_cast<uint8_t*>(const_cast<char*>(name.data())),
+                reinterpret_cast<uint8_t*>(const_cast<char*>(value.data())),
+                name.size(),
+                value.size(),
+                NGHTTP2_NV_FLAG_NONE,
+        };
+    }
+
+    static ssize_t send_callback(nghttp2_session*, const uint8_t* data, size_t length, int, void* user_data) {
+        auto* connection = static_cast<Connection*>(user_data);
+
+        const ssize_t sent = send(connection->fd, data, length, MSG_NOSIGNAL);
+        if (sent < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK ? NGHTTP2_ERR_WOULDBLOCK : NGHTTP2_ERR_CALLBACK_FAILURE;
+        }
+
+        return sent;
+    }
+
+    static ssize_t read_response_callback(nghttp2_session*,
+                                          int32_t,
+                                          uint8_t* buf,
+                                          size_t length,
+                                          uint32_t* data_flags,
+                                          nghttp2_data_source* source,
+                                          void*) {
+        auto* stream = static_cast<StreamData*>(source->ptr);
+
+        const std::size_t count = std::min(length, stream->response_body.size() - stream->response_offset);
+        std::memcpy(buf, stream->response_body.data() + stream->response_offset, count);
+        stream->response_offset += count;
+
+        if (stream->response_offset == stream->response_body.size()) {
+            *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+        }
+
+        return static_cast<ssize_t>(count);
+    }
+
+    static int on_begin_headers_callback(nghttp2_session*, const nghttp2_frame* frame, void* user_data) {
+        auto* connection = static_cast<Connection*>(user_data);
+        if (frame->hd.type == NGHTTP2_HEADERS && frame->headers.cat == NGHTTP2_HCAT_REQUEST) {
+            connection->streams.emplace(frame->hd.stream_id, std::make_unique<StreamData>());
+        }
+
+        return 0;
+    }
+
+    static int on_header_callback(nghttp2_session*,
+                                  const nghttp2_frame* frame,
+                                  const uint8_t* name,
+                                  size_t name_length,
+                                  const uint8_t* value,
+                                  size_t value_length,
+                                  uint8_t,
+                                  void* user_data) {
+        auto* connection = static_cast<Connection*>(user_data);
+
+        auto iter = connection->streams.find(frame->hd.stream_id);
+        if (iter == connection->streams.end()) {
+            return 0;
+        }
+
+        HttpRequest& request = iter->second->request;
+        std::string header_name(reinterpret_cast<const char*>(name), name_length);
+        std::string header_value(reinterpret_cast<const char*>(value), value_length);
+        if (header_name == ":method") {
+            request.set_method(EnumUtils::deserialize_http_method(header_value));
+        } else if (header_name == ":path") {
+            request.set_path_query_fragment(std::move(header_value));
+        } else if (header_name.front() != ':') {
+            request.add_header(std::move(header_name), std::move(header_value));
+        }
+
+        return 0;
+    }
+
+    static int on_data_chunk_recv_callback(nghttp2_session*,
+                                           uint8_t,
+                                           int32_t stream_id,
+                                           const uint8_t* data,
+                                           size_t length,
+                                           void* user_data) {
+        auto* connection = static_cast<Connection*>(user_data);
+
+        auto iter = connection->streams.find(stream_id);
+        if (iter != connection->streams.end()) {
+            iter->second->body.append(reinterpret_cast<const char*>(data), length);
+        }
+
+        return 0;
+    }
+
+    static int on_frame_recv_callback(nghttp2_session*, const nghttp2_frame* frame, void* user_data) {
+        auto* connection = static_cast<Connection*>(user_data);
+
+        const bool is_request_frame = frame->hd.type == NGHTTP2_DATA || frame->hd.type == NGHTTP2_HEADERS;
+        if (is_request_frame && (frame->hd.flags & NGHTTP2_FLAG_END_STREAM)) {
+            connection->owner->respond(*connection, frame->hd.stream_id);
+        }
+
+        return 0;
+    }
+
+    static int on_stream_close_callback(nghttp2_session*, int32_t stream_id, uint32_t, void* user_data) {
+        auto* connection = static_cast<Connection*>(user_data);
+        connection->streams.erase(stream_id);
+        return 0;
+    }
+};
+
+MockHttp2Server::MockHttp2Server() : impl(new Impl()) {
+}
+
+MockHttp2Server::~MockHttp2Server() {
+    delete impl;
+}
+
+void MockHttp2Server::start() {
+    impl->start();
+}
+
+void MockHttp2Server::stop() {
+    impl->stop();
+}
+
+void MockHttp2Server::respond_with(int status_code, std::string body, std::map<std::string, std::string> headers) {
+    impl->respond_with(status_code, std::move(body), std::move(headers));
+}
+
+std::string MockHttp2Server::uri() {
+    return impl->uri();
+}
+
+std::size_t MockHttp2Server::get_connection_count() const {
+    return impl->get_connection_count();
+}
+
+std::vector<HttpRequest> MockHttp2Server::get_received_requests() const {
+    return impl->get_received_requests();
+}
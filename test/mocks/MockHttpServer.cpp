@@ -390,6 +390,12 @@ private:
                 res.status = provider->get_response()->get_status_code().value();
 
                 auto& headers = provider->get_response()->get_headers();
+                for (const auto& [k, v]: headers) {
+                    if (k != ContentType) {
+                        res.set_header(k.c_str(), v);
+                    }
+                }
+
                 auto iter = headers.find(ContentType);
                 if (iter == headers.end()) {
                     res.set_content(provider->get_response()->get_body().value(), DEFAULT_CONTENT_TYPE);
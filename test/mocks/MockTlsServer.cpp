@@ -0,0 +1,353 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MockTlsServer.hpp"
+
+#include "openssl/err.h"
+#include "openssl/pem.h"
+#include "openssl/ssl.h"
+#include "openssl/x509v3.h"
+#include <arpa/inet.h>
+#include <cctype>
+#include <memory>
+#include <mutex>
+#include <netinet/in.h>
+#include <optional>
+#include <poll.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace enjin::test::mocks;
+
+class MockTlsServer::Impl {
+public:
+    Impl() {
+        create_context();
+    }
+
+    ~Impl() {
+        stop();
+        SSL_CTX_free(ctx);
+        X509_free(certificate);
+        EVP_PKEY_free(key);
+    }
+
+    void start() {
+        stop();
+
+        std::lock_guard<std::mutex> guard(server_mutex);
+
+        listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        const int enable = 1;
+        setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t length = sizeof(address);
+        if (bind(listen_fd, reinterpret_cast<sockaddr*>(&address), length) < 0
+            || listen(listen_fd, SOMAXCONN) < 0
+            || getsockname(listen_fd, reinterpret_cast<sockaddr*>(&address), &length) < 0
+            || pipe(wake_fds) < 0) {
+            close(listen_fd);
+            throw std::runtime_error("Unable to start mock TLS server");
+        }
+
+        port = ntohs(address.sin_port);
+        running = true;
+        server_thread = std::thread([this]() {
+            run();
+        });
+    }
+
+    void stop() {
+        std::unique_lock<std::mutex> lock(server_mutex);
+        if (!running) {
+            return;
+        }
+
+        running = false;
+        port.reset();
+        const char value = 1;
+        [[maybe_unused]] const ssize_t result = write(wake_fds[1], &value, 1);
+        lock.unlock();
+
+        server_thread.join();
+
+        close(listen_fd);
+        close(wake_fds[0]);
+        close(wake_fds[1]);
+    }
+
+    std::string uri() {
+        std::lock_guard<std::mutex> guard(server_mutex);
+
+        if (!port.has_value()) {
+            throw std::runtime_error("Port number is not set");
+        }
+
+        std::stringstream ss;
+        ss << "https://localhost:" << port.value();
+        return ss.str();
+    }
+
+    [[nodiscard]] std::string get_certificate_pem() const {
+        BIO* bio = BIO_new(BIO_s_mem());
+        PEM_write_bio_X509(bio, certificate);
+
+        char* data = nullptr;
+        const long length = BIO_get_mem_data(bio, &data);
+        std::string pem(data, static_cast<std::size_t>(length));
+        BIO_free(bio);
+
+        return pem;
+    }
+
+    [[nodiscard]] std::size_t get_connection_count() const {
+        std::lock_guard<std::mutex> guard(stats_mutex);
+        return connection_count;
+    }
+
+    [[nodiscard]] std::size_t get_resumed_connection_count() const {
+        std::lock_guard<std::mutex> guard(stats_mutex);
+        return resumed_connection_count;
+    }
+
+private:
+    SSL_CTX* ctx = nullptr;
+    EVP_PKEY* key = nullptr;
+    X509* certificate = nullptr;
+
+    int listen_fd = -1;
+    int wake_fds[2] = {-1, -1};
+    std::optional<int> port;
+    bool running = false;
+    std::thread server_thread;
+
+    std::size_t connection_count = 0;
+    std::size_t resumed_connection_count = 0;
+
+    // Mutexes
+    mutable std::mutex server_mutex;
+    mutable std::mutex stats_mutex;
+
+    void create_context() {
+        EVP_PKEY_CTX* key_ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+        EVP_PKEY_keygen_init(key_ctx);
+        EVP_PKEY_CTX_set_ec_paramgen_curve_nid(key_ctx, NID_X9_62_prime256v1);
+        EVP_PKEY_keygen(key_ctx, &key);
+        EVP_PKEY_CTX_free(key_ctx);
+
+        certificate = X509_new();
+        X509_set_version(certificate, 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+        X509_gmtime_adj(X509_getm_notBefore(certificate), -60);
+        X509_gmtime_adj(X509_getm_notAfter(certificate), 60 * 60 * 24);
+        X509_set_pubkey(certificate, key);
+
+        X509_NAME* name = X509_get_subject_name(certificate);
+        X509_NAME_add_entry_by_txt(name,
+                                   "CN",
+                                   MBSTRING_ASC,
+                                   reinterpret_cast<const unsigned char*>("localhost"),
+                                   -1,
+                                   -1,
+                                   0);
+        X509_set_issuer_name(certificate, name);
+
+        X509V3_CTX ext_ctx;
+        X509V3_set_ctx_nodb(&ext_ctx);
+        X509V3_set_ctx(&ext_ctx, certificate, certificate, nullptr, nullptr, 0);
+        X509_EXTENSION* alt_names = X509V3_EXT_conf_nid(nullptr,
+                                                        &ext_ctx,
+                                                        NID_subject_alt_name,
+                                                        "DNS:localhost,IP:127.0.0.1");
+        X509_add_ext(certificate, alt_names, -1);
+        X509_EXTENSION_free(alt_names);
+        X509_sign(certificate, key, EVP_sha256());
+
+        ctx = SSL_CTX_new(TLS_server_method());
+        if (ctx == nullptr
+            || SSL_CTX_use_certificate(ctx, certificate) != 1
+            || SSL_CTX_use_PrivateKey(ctx, key) != 1) {
+            throw std::runtime_error("Unable to create mock TLS server context");
+        }
+
+        // Issues as many TLS 1.3 tickets per connection as OpenSSL does by default, each of which resumes one session
+        SSL_CTX_set_num_tickets(ctx, 2);
+    }
+
+    void run() {
+        std::vector<std::thread> connection_threads;
+        std::vector<int> connection_fds;
+        std::mutex connection_mutex;
+
+        while (true) {
+            pollfd fds[2] = {{listen_fd, POLLIN, 0}, {wake_fds[0], POLLIN, 0}};
+            if (poll(fds, 2, -1) < 0 || (fds[1].revents & POLLIN)) {
+                break;
+            } else if ((fds[0].revents & POLLIN) == 0) {
+                continue;
+            }
+
+            const int fd = accept(listen_fd, nullptr, nullptr);
+            if (fd < 0) {
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> guard(connection_mutex);
+                connection_fds.push_back(fd);
+            }
+
+            connection_threads.emplace_back([this, fd]() {
+                serve(fd);
+            });
+        }
+
+        // Unblocks the connections still waiting for requests
+        {
+            std::lock_guard<std::mutex> guard(connection_mutex);
+            for (int fd: connection_fds) {
+                shutdown(fd, SHUT_RDWR);
+            }
+        }
+
+        for (auto& thread: connection_threads) {
+            thread.join();
+        }
+
+        for (int fd: connection_fds) {
+            close(fd);
+        }
+    }
+
+    void serve(int fd) {
+        std::unique_ptr<SSL, decltype(&SSL_free)> ssl(SSL_new(ctx), SSL_free);
+        SSL_set_fd(ssl.get(), fd);
+        if (SSL_accept(ssl.get()) != 1) {
+            ERR_clear_error();
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(stats_mutex);
+            connection_count++;
+            if (SSL_session_reused(ssl.get())) {
+                resumed_connection_count++;
+            }
+        }
+
+        std::string in;
+        char buffer[4096];
+        while (true) {
+            const std::size_t header_end = in.find("\r\n\r\n");
+            if (header_end == std::string::npos) {
+                const int received = SSL_read(ssl.get(), buffer, sizeof(buffer));
+                if (received <= 0) {
+                    break;
+                }
+
+                in.append(buffer, static_cast<std::size_t>(received));
+                continue;
+            }
+
+            const std::size_t body_length = get_content_length(in.substr(0, header_end));
+            if (in.size() < header_end + 4 + body_length) {
+                const int received = SSL_read(ssl.get(), buffer, sizeof(buffer));
+                if (received <= 0) {
+                    break;
+                }
+
+                in.append(buffer, static_cast<std::size_t>(received));
+                continue;
+            }
+
+            // HEAD responses carry the length of the body they leave out
+            const bool head = in.rfind("HEAD ", 0) == 0;
+            in.erase(0, header_end + 4 + body_length);
+
+            std::string response = "HTTP/1.1 200 OK\r\n"
+                                   "Content-Type: application/json\r\n"
+                                   "Content-Length: 2\r\n"
+                                   "\r\n";
+            if (!head) {
+                response += "{}";
+            }
+
+            if (SSL_write(ssl.get(), response.data(), static_cast<int>(response.size())) <= 0) {
+                break;
+            }
+        }
+
+        SSL_shutdown(ssl.get());
+        ERR_clear_error();
+    }
+
+    static std::size_t get_content_length(const std::string& headers) {
+        static constexpr char Name[] = "content-length:";
+
+        std::istringstream lines(headers);
+        std::string line;
+        while (std::getline(lines, line)) {
+            std::string lower = line;
+            for (char& c: lower) {
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+
+            if (lower.rfind(Name, 0) == 0) {
+                return std::stoul(line.substr(sizeof(Name) - 1));
+            }
+        }
+
+        return 0;
+    }
+};
+
+MockTlsServer::MockTlsServer() : impl(new Impl()) {
+}
+
+MockTlsServer::~MockTlsServer() {
+    delete impl;
+}
+
+void MockTlsServer::start() {
+    impl->start();
+}
+
+void MockTlsServer::stop() {
+    impl->stop();
+}
+
+std::string MockTlsServer::uri() {
+    return impl->uri();
+}
+
+std::string MockTlsServer::get_certificate_pem() const {
+    return impl->get_certificate_pem();
+}
+
+std::size_t MockTlsServer::get_connection_count() const {
+    return impl->get_connection_count();
+}
+
+std::size_t MockTlsServer::get_resumed_connection_count() const {
+    return impl->get_resumed_connection_count();
+}
@@ -0,0 +1,99 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "MockHttpClient.hpp"
+#include "enjinsdk/ProjectClient.hpp"
+#include <memory>
+#include <optional>
+
+using namespace enjin::sdk;
+using namespace enjin::sdk::http;
+using namespace enjin::test::mocks;
+using testing::Return;
+
+class ProjectClientTest : public testing::Test {
+public:
+    std::unique_ptr<ProjectClient> class_under_test;
+
+    NiceMockHttpClient* mock_http_client = nullptr;
+
+protected:
+    void SetUp() override {
+        testing::Test::SetUp();
+
+        auto http_client = std::make_unique<NiceMockHttpClient>();
+        mock_http_client = http_client.get();
+        class_under_test = ProjectClient::builder()
+                .http_client(std::move(http_client))
+                .build();
+    }
+};
+
+TEST_F(ProjectClientTest, GetHttpCompressionStatsReturnsStatsOfHttpClient) {
+    // Arrange - Data
+    CompressionStats expected;
+    expected.requests_compressed = 2;
+    expected.request_bytes_uncompressed = 1000;
+    expected.request_bytes_compressed = 100;
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, get_compression_stats())
+            .WillOnce(Return(expected));
+
+    // Act
+    std::optional<CompressionStats> actual = class_under_test->get_http_compression_stats();
+
+    // Assert
+    ASSERT_TRUE(actual.has_value());
+    EXPECT_EQ(expected.requests_compressed, actual->requests_compressed);
+    EXPECT_EQ(expected.request_bytes_uncompressed, actual->request_bytes_uncompressed);
+    EXPECT_EQ(expected.request_bytes_compressed, actual->request_bytes_compressed);
+}
+
+TEST_F(ProjectClientTest, GetHttpConnectionPoolStatsReturnsStatsOfHttpClient) {
+    // Arrange - Data
+    ConnectionPoolStats expected;
+    expected.max_connections = 8;
+    expected.active_connections = 2;
+    expected.idle_connections = 3;
+    expected.created_connections = 5;
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, get_connection_pool_stats())
+            .WillOnce(Return(expected));
+
+    // Act
+    std::optional<ConnectionPoolStats> actual = class_under_test->get_http_connection_pool_stats();
+
+    // Assert
+    ASSERT_TRUE(actual.has_value());
+    EXPECT_EQ(expected.max_connections, actual->max_connections);
+    EXPECT_EQ(expected.active_connections, actual->active_connections);
+    EXPECT_EQ(expected.idle_connections, actual->idle_connections);
+    EXPECT_EQ(expected.created_connections, actual->created_connections);
+}
+
+TEST_F(ProjectClientTest, GetHttpConnectionPoolStatsHttpClientDoesNotPoolConnectionsReturnsEmptyOptional) {
+    // Arrange
+    EXPECT_CALL(*mock_http_client, get_connection_pool_stats())
+            .WillOnce(Return(std::nullopt));
+
+    // Act
+    std::optional<ConnectionPoolStats> actual = class_under_test->get_http_connection_pool_stats();
+
+    // Assert
+    ASSERT_FALSE(actual.has_value());
+}
@@ -0,0 +1,140 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "enjinsdk/GraphqlAwaitable.hpp"
+
+#ifdef ENJINSDK_GRAPHQLAWAITABLE_HPP
+
+#include "HttpClient.hpp"
+#include "MockHttpServer.hpp"
+#include "enjinsdk/HttpHeaders.hpp"
+#include "enjinsdk/ProjectClient.hpp"
+#include "enjinsdk/ThreadPoolExecutor.hpp"
+#include "enjinsdk/project/GetPlayer.hpp"
+#include "gtest/gtest.h"
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace enjin::sdk;
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::http;
+using namespace enjin::sdk::models;
+using namespace enjin::sdk::project;
+using namespace enjin::test::mocks;
+
+class GraphqlAwaitableTest : public testing::Test {
+public:
+    /// \brief Coroutine return type which starts eagerly and does not need to be awaited.
+    struct DetachedTask {
+        struct promise_type {
+            DetachedTask get_return_object() {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() {
+            }
+
+            void unhandled_exception() {
+                std::terminate();
+            }
+        };
+    };
+
+    static constexpr char JSON[] = "application/json; charset=utf-8";
+
+    std::shared_ptr<enjin::sdk::utils::ThreadPoolExecutor> executor
+            = std::make_shared<enjin::sdk::utils::ThreadPoolExecutor>(1);
+
+    std::unique_ptr<ProjectClient> class_under_test;
+
+    HttpClient* http_client = nullptr;
+
+    MockHttpServer mock_server;
+
+    static DetachedTask get_player(ProjectClient& client,
+                                   GetPlayer request,
+                                   std::promise<GraphqlResponse<Player>>& promise) {
+        try {
+            promise.set_value(co_await await_operation(client, &IProjectSchema::get_player, std::move(request)));
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    }
+
+protected:
+    void SetUp() override {
+        mock_server.start();
+        auto client = std::make_unique<HttpClient>(mock_server.uri());
+        http_client = client.get();
+        class_under_test = ProjectClient::builder()
+                .http_client(std::move(client))
+                .executor(executor)
+                .build();
+    }
+
+    void TearDown() override {
+        class_under_test.reset();
+        mock_server.stop();
+    }
+};
+
+TEST_F(GraphqlAwaitableTest, AwaitOperationResponseIsSuccessfulReceivesExpected) {
+    // Arrange - Data
+    const std::string expected("xyz");
+    std::promise<GraphqlResponse<Player>> promise;
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path("/graphql/project")
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body(R"({"data":{"result":{"id":")" + expected + R"("}}})"));
+
+    // Act
+    get_player(*class_under_test, GetPlayer().set_id(expected), promise);
+
+    // Assert
+    auto response = promise.get_future().get();
+    ASSERT_TRUE(response.is_successful());
+    ASSERT_EQ(expected, response.get_result().value().get_id().value());
+}
+
+TEST_F(GraphqlAwaitableTest, AwaitOperationRequestFailsRethrowsException) {
+    // Arrange
+    std::promise<GraphqlResponse<Player>> promise;
+    http_client->stop();
+
+    // Act
+    get_player(*class_under_test, GetPlayer().set_id("xyz"), promise);
+
+    // Assert
+    ASSERT_THROW(promise.get_future().get(), std::runtime_error);
+}
+
+#endif
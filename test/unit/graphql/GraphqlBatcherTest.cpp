@@ -0,0 +1,200 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GraphqlBatcher.hpp"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::http;
+
+class GraphqlBatcherTest : public testing::Test {
+public:
+    std::mutex mutex;
+    std::vector<std::string> sent_bodies;
+    std::string response_body;
+
+    std::unique_ptr<GraphqlBatcher> create_batcher(std::size_t max_batch_size, std::chrono::milliseconds max_delay) {
+        return std::make_unique<GraphqlBatcher>(
+                [this](std::string body) {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    sent_bodies.push_back(body);
+
+                    std::promise<HttpResponse> promise;
+                    promise.set_value(HttpResponse::builder()
+                                              .code(200)
+                                              .body(response_body.empty() ? body : response_body)
+                                              .build());
+                    return promise.get_future();
+                },
+                [](std::function<void()> task) {
+                    task();
+                },
+                max_batch_size,
+                max_delay);
+    }
+
+    static GraphqlBatcher::Completion create_completion(std::promise<std::string>& promise) {
+        return [&promise](std::shared_future<HttpResponse> response) {
+            try {
+                promise.set_value(response.get().get_body().value());
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        };
+    }
+};
+
+TEST_F(GraphqlBatcherTest, CreateBatchBodyReturnsJsonArray) {
+    // Arrange
+    const std::string expected(R"([{"a":1},{"b":2}])");
+
+    // Act
+    std::string actual = GraphqlBatcher::create_batch_body({R"({"a":1})", R"({"b":2})"});
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(GraphqlBatcherTest, SplitBatchResponseArrayResponseReturnsEachElement) {
+    // Arrange
+    HttpResponse response = HttpResponse::builder()
+            .code(200)
+            .body(R"([{"data":{"result":1}},{"data":{"result":2}}])")
+            .build();
+
+    // Act
+    auto actual = GraphqlBatcher::split_batch_response(response, 2);
+
+    // Assert
+    ASSERT_EQ(2, actual.size());
+    EXPECT_EQ(R"({"data":{"result":1}})", actual[0].get_body().value());
+    EXPECT_EQ(R"({"data":{"result":2}})", actual[1].get_body().value());
+    EXPECT_EQ(200, actual[1].get_code().value());
+}
+
+TEST_F(GraphqlBatcherTest, SplitBatchResponseObjectResponseReturnsWholeResponseForEach) {
+    // Arrange
+    const std::string expected(R"({"errors":[{"message":"Batching is not supported"}]})");
+    HttpResponse response = HttpResponse::builder()
+            .code(400)
+            .body(expected)
+            .build();
+
+    // Act
+    auto actual = GraphqlBatcher::split_batch_response(response, 2);
+
+    // Assert
+    ASSERT_EQ(2, actual.size());
+    EXPECT_EQ(expected, actual[0].get_body().value());
+    EXPECT_EQ(expected, actual[1].get_body().value());
+}
+
+TEST_F(GraphqlBatcherTest, SplitBatchResponseArraySizeDiffersThrowsException) {
+    // Arrange
+    HttpResponse response = HttpResponse::builder()
+            .code(200)
+            .body(R"([{"data":{"result":1}}])")
+            .build();
+
+    // Assert
+    ASSERT_THROW(static_cast<void>(GraphqlBatcher::split_batch_response(response, 2)), std::runtime_error);
+}
+
+TEST_F(GraphqlBatcherTest, EnqueueBatchIsFullSendsBatch) {
+    // Arrange
+    auto class_under_test = create_batcher(2, std::chrono::hours(1));
+    std::promise<std::string> promise1;
+    std::promise<std::string> promise2;
+
+    // Act
+    class_under_test->enqueue(R"({"a":1})", create_completion(promise1));
+    class_under_test->enqueue(R"({"b":2})", create_completion(promise2));
+
+    // Assert
+    EXPECT_EQ(R"({"a":1})", promise1.get_future().get());
+    EXPECT_EQ(R"({"b":2})", promise2.get_future().get());
+    EXPECT_EQ(1, class_under_test->get_batch_count());
+    ASSERT_EQ(1, sent_bodies.size());
+    EXPECT_EQ(R"([{"a":1},{"b":2}])", sent_bodies[0]);
+}
+
+TEST_F(GraphqlBatcherTest, EnqueueDeadlinePassesSendsPartialBatch) {
+    // Arrange
+    auto class_under_test = create_batcher(10, std::chrono::milliseconds(20));
+    std::promise<std::string> promise1;
+    std::promise<std::string> promise2;
+
+    // Act
+    class_under_test->enqueue(R"({"a":1})", create_completion(promise1));
+    class_under_test->enqueue(R"({"b":2})", create_completion(promise2));
+
+    // Assert
+    EXPECT_EQ(R"({"a":1})", promise1.get_future().get());
+    EXPECT_EQ(R"({"b":2})", promise2.get_future().get());
+    EXPECT_EQ(1, class_under_test->get_batch_count());
+}
+
+TEST_F(GraphqlBatcherTest, EnqueueSingleRequestInBatchSendsPlainRequest) {
+    // Arrange
+    const std::string expected(R"({"a":1})");
+    auto class_under_test = create_batcher(10, std::chrono::hours(1));
+    std::promise<std::string> promise;
+
+    // Act
+    class_under_test->enqueue(expected, create_completion(promise));
+    class_under_test->flush();
+
+    // Assert
+    EXPECT_EQ(expected, promise.get_future().get());
+    ASSERT_EQ(1, sent_bodies.size());
+    EXPECT_EQ(expected, sent_bodies[0]);
+}
+
+TEST_F(GraphqlBatcherTest, DestructorSendsWaitingRequests) {
+    // Arrange
+    const std::string expected(R"({"a":1})");
+    auto class_under_test = create_batcher(10, std::chrono::hours(1));
+    std::promise<std::string> promise;
+    class_under_test->enqueue(expected, create_completion(promise));
+
+    // Act
+    class_under_test.reset();
+
+    // Assert
+    EXPECT_EQ(expected, promise.get_future().get());
+}
+
+TEST_F(GraphqlBatcherTest, EnqueueResponseArraySizeDiffersCompletesEachWithException) {
+    // Arrange
+    response_body = R"([{"data":{"result":1}}])";
+    auto class_under_test = create_batcher(2, std::chrono::hours(1));
+    std::promise<std::string> promise1;
+    std::promise<std::string> promise2;
+
+    // Act
+    class_under_test->enqueue(R"({"a":1})", create_completion(promise1));
+    class_under_test->enqueue(R"({"b":2})", create_completion(promise2));
+
+    // Assert
+    EXPECT_THROW(promise1.get_future().get(), std::runtime_error);
+    EXPECT_THROW(promise2.get_future().get(), std::runtime_error);
+}
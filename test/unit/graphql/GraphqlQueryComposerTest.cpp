@@ -0,0 +1,184 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GraphqlQueryComposer.hpp"
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::json;
+
+class GraphqlQueryComposerTest : public testing::Test {
+public:
+    class TestableGraphqlRequest : public AbstractGraphqlRequest {
+    public:
+        TestableGraphqlRequest() = delete;
+
+        TestableGraphqlRequest(const std::string& template_key, std::string variables)
+                : AbstractGraphqlRequest(template_key),
+                  variables(std::move(variables)) {
+        }
+
+        [[nodiscard]] std::string serialize() const override {
+            return variables;
+        }
+
+        [[nodiscard]] JsonValue to_json() const override {
+            return JsonValue::create_object();
+        }
+
+    private:
+        const std::string variables;
+    };
+
+    static constexpr char GET_THING_KEY[] = "test.GetThing";
+    static constexpr char GET_OTHER_KEY[] = "test.GetOther";
+    static constexpr char SET_THING_KEY[] = "test.SetThing";
+    static constexpr char NOT_REGISTERED_KEY[] = "test.NotRegistered";
+
+    GraphqlQueryRegistry registry;
+
+    GraphqlQueryComposer class_under_test = GraphqlQueryComposer(registry);
+
+protected:
+    void SetUp() override {
+        registry.register_template(GET_THING_KEY,
+                                   "query GetThing($id: String, $withName: Boolean = false) "
+                                   "{ result: GetThing( id: $id ) { ...Thing } } "
+                                   "fragment Thing on Thing { id name @include(if: $withName) }");
+        registry.register_template(GET_OTHER_KEY,
+                                   "query GetOther { result: GetOther { id } }");
+        registry.register_template(SET_THING_KEY,
+                                   "mutation SetThing($id: String) { result: SetThing( id: $id ) { id } }");
+    }
+};
+
+TEST_F(GraphqlQueryComposerTest, AddTemplateIsNotRegisteredThrowsException) {
+    // Arrange
+    TestableGraphqlRequest request(NOT_REGISTERED_KEY, "{}");
+
+    // Assert
+    ASSERT_THROW(class_under_test.add(request), std::runtime_error);
+}
+
+TEST_F(GraphqlQueryComposerTest, AddTemplateIsMutationThrowsException) {
+    // Arrange
+    TestableGraphqlRequest request(SET_THING_KEY, R"({"id":"1"})");
+
+    // Assert
+    ASSERT_THROW(class_under_test.add(request), std::runtime_error);
+}
+
+TEST_F(GraphqlQueryComposerTest, AddTemplateIsQueryIncrementsSize) {
+    // Arrange
+    TestableGraphqlRequest request(GET_OTHER_KEY, "{}");
+
+    // Act
+    class_under_test.add(request);
+
+    // Assert
+    ASSERT_EQ(1, class_under_test.size());
+}
+
+TEST_F(GraphqlQueryComposerTest, CreateRequestBodySameTemplateTwiceRenamesVariablesAndFragments) {
+    // Arrange
+    const std::string expected(
+            R"({"query":"query($id_0: String, $withName_0: Boolean = false, $id_1: String, )"
+            R"($withName_1: Boolean = false) {op0: GetThing( id: $id_0 ) { ...Thing_0 } )"
+            R"(op1: GetThing( id: $id_1 ) { ...Thing_1 }} )"
+            R"(fragment Thing_0 on Thing { id name @include(if: $withName_0) } )"
+            R"(fragment Thing_1 on Thing { id name @include(if: $withName_1) }",)"
+            R"("variables":{"id_0":"a","id_1":"b","withName_1":true}})");
+    class_under_test.add(TestableGraphqlRequest(GET_THING_KEY, R"({"id":"a"})"));
+    class_under_test.add(TestableGraphqlRequest(GET_THING_KEY, R"({"id":"b","withName":true})"));
+
+    // Act
+    std::string actual = class_under_test.create_request_body();
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(GraphqlQueryComposerTest, CreateRequestBodyVariableIsNotDeclaredOmitsVariable) {
+    // Arrange
+    const std::string expected(R"({"query":"query {op0: GetOther { id }}","variables":{}})");
+    class_under_test.add(TestableGraphqlRequest(GET_OTHER_KEY, R"({"undeclared":1})"));
+
+    // Act
+    std::string actual = class_under_test.create_request_body();
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(GraphqlQueryComposerTest, SplitResponseResponseHasDataGivesEachOperationItsResult) {
+    // Arrange
+    const std::vector<std::string> expected {
+            R"({"data":{"result":{"id":"a"}}})",
+            R"({"data":{"result":{"id":"b"}}})",
+    };
+    class_under_test.add(TestableGraphqlRequest(GET_THING_KEY, R"({"id":"a"})"));
+    class_under_test.add(TestableGraphqlRequest(GET_OTHER_KEY, "{}"));
+
+    // Act
+    auto actual = class_under_test.split_response(R"({"data":{"op0":{"id":"a"},"op1":{"id":"b"}}})");
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(GraphqlQueryComposerTest, SplitResponseErrorHasPathGivesErrorToOperationOfPath) {
+    // Arrange
+    const std::vector<std::string> expected {
+            R"({"data":{"result":{"id":"a"}}})",
+            R"({"data":{"result":null},"errors":[{"message":"e","path":["result","id"]}]})",
+    };
+    class_under_test.add(TestableGraphqlRequest(GET_THING_KEY, R"({"id":"a"})"));
+    class_under_test.add(TestableGraphqlRequest(GET_OTHER_KEY, "{}"));
+
+    // Act
+    auto actual = class_under_test.split_response(
+            R"({"data":{"op0":{"id":"a"},"op1":null},"errors":[{"message":"e","path":["op1","id"]}]})");
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(GraphqlQueryComposerTest, SplitResponseErrorHasNoPathGivesErrorToEveryOperation) {
+    // Arrange
+    const std::vector<std::string> expected {
+            R"({"data":{"result":null},"errors":[{"message":"e"}]})",
+            R"({"data":{"result":null},"errors":[{"message":"e"}]})",
+    };
+    class_under_test.add(TestableGraphqlRequest(GET_THING_KEY, R"({"id":"a"})"));
+    class_under_test.add(TestableGraphqlRequest(GET_OTHER_KEY, "{}"));
+
+    // Act
+    auto actual = class_under_test.split_response(R"({"errors":[{"message":"e"}]})");
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(GraphqlQueryComposerTest, SplitResponseResponseIsNotObjectThrowsException) {
+    // Arrange
+    class_under_test.add(TestableGraphqlRequest(GET_OTHER_KEY, "{}"));
+
+    // Assert
+    ASSERT_THROW(static_cast<void>(class_under_test.split_response("[]")), std::runtime_error);
+}
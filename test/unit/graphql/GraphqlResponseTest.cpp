@@ -16,9 +16,12 @@
 #include "DummyObject.hpp"
 #include "JsonTestSuite.hpp"
 #include "enjinsdk/GraphqlResponse.hpp"
+#include "enjinsdk/models/BalanceTable.hpp"
+#include "enjinsdk/models/Transaction.hpp"
 #include "gtest/gtest.h"
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace enjin::sdk::graphql;
@@ -62,6 +65,22 @@ TEST_F(GraphqlResponseTest, ConstructorParsesOneType) {
     ASSERT_EQ(expected, response.get_result().value());
 }
 
+TEST_F(GraphqlResponseTest, CopyConstructorOneTypeCopyHasSameResult) {
+    // Arrange
+    DummyObject expected = DummyObject::create_default_dummy_object();
+    std::stringstream s;
+    s << R"({"data":{"result":)"
+      << expected.serialize()
+      << R"(}})";
+    GraphqlResponse<DummyObject> original(s.str());
+
+    // Act
+    GraphqlResponse<DummyObject> copy(original);
+
+    // Assert
+    ASSERT_EQ(expected, copy.get_result().value());
+}
+
 TEST_F(GraphqlResponseTest, ConstructorParsesOneBoolean) {
     // Arrange
     bool expected = true;
@@ -136,6 +155,195 @@ TEST_F(GraphqlResponseTest, ConstructorParsesErrors) {
     }
 }
 
+TEST_F(GraphqlResponseTest, ConstructorParsesEscapedStrings) {
+    // Arrange
+    const std::string expected(R"(a"b\c)");
+    std::string json(R"({"errors":[{"message":"a\"b\\c"}]})");
+
+    // Act
+    GraphqlResponse<DummyObject> response(std::move(json));
+
+    // Assert
+    ASSERT_TRUE(response.get_errors().has_value());
+    ASSERT_EQ(expected, response.get_errors().value().front().get_message().value());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorDoesNotModifyBorrowedJson) {
+    // Arrange
+    const std::string expected(R"({"data":{"result":true}})");
+    const std::string json(expected);
+
+    // Act
+    GraphqlResponse<bool> response(json);
+
+    // Assert
+    ASSERT_TRUE(response.get_result().value());
+    ASSERT_EQ(expected, json);
+}
+
+TEST_F(GraphqlResponseTest, ConstructorJsonIsNotObjectResponseIsEmpty) {
+    // Arrange
+    std::string json(R"([{"data":{"result":true}}])");
+
+    // Act
+    GraphqlResponse<bool> response(std::move(json));
+
+    // Assert
+    ASSERT_TRUE(response.is_empty());
+    ASSERT_FALSE(response.has_errors());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorParsesPaginatedTypeWithCursorBeforeItems) {
+    // Arrange
+    DummyObject expected_obj = DummyObject::create_default_dummy_object();
+    PaginationCursor expected_cursor = create_default_pagination_cursor();
+    std::stringstream s;
+    s << R"({"data":{"result":{"cursor":)"
+      << POPULATED_CURSOR_JSON
+      << R"(,"items":[)"
+      << expected_obj.serialize()
+      << R"(]}}})";
+
+    // Act
+    GraphqlResponse<std::vector<DummyObject>> response(s.str());
+
+    // Assert
+    ASSERT_EQ(1, response.get_result().value().size());
+    EXPECT_EQ(expected_obj, response.get_result().value().front());
+    EXPECT_EQ(expected_cursor, response.get_cursor().value());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorParsesPaginatedTable) {
+    // Arrange
+    PaginationCursor expected_cursor = create_default_pagination_cursor();
+    std::stringstream s;
+    s << R"({"data":{"result":{"items":[{"id":"1","index":"0","value":5},{"id":"1","index":"1","value":7}],"cursor":)"
+      << POPULATED_CURSOR_JSON
+      << R"(}}})";
+
+    // Act
+    GraphqlResponse<BalanceTable> response(s.str());
+
+    // Assert
+    ASSERT_TRUE(response.get_result().has_value());
+    const BalanceTable& actual = response.get_result().value();
+    ASSERT_EQ(2, actual.size());
+    EXPECT_EQ(1, actual.get_ids().get_dictionary().size());
+    EXPECT_EQ("1", actual.get_indices().get(1).value());
+    EXPECT_EQ(12, actual.get_values().get_values()[0] + actual.get_values().get_values()[1]);
+    EXPECT_EQ(expected_cursor, response.get_cursor().value());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorTableResultObjectWithoutCursorResponseIsEmpty) {
+    // Arrange
+    const std::string json(R"({"data":{"result":{"items":[{"id":"1"}]}}})");
+
+    // Act
+    GraphqlResponse<BalanceTable> response(json);
+
+    // Assert
+    ASSERT_TRUE(response.is_empty());
+    ASSERT_FALSE(response.is_paginated());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorManyTypeSkipsOtherFieldsAndParsesErrors) {
+    // Arrange
+    DummyObject expected_obj = DummyObject::create_default_dummy_object();
+    GraphqlError expected_error = create_default_graphql_error();
+    std::stringstream s;
+    s << R"({"extensions":{"result":[1,{"items":[]}]},"data":{"other":[{"result":[]}],"result":[)"
+      << expected_obj.serialize()
+      << R"(]},"errors":[)"
+      << POPULATED_ERROR_JSON
+      << R"(]})";
+
+    // Act
+    GraphqlResponse<std::vector<DummyObject>> response(s.str());
+
+    // Assert
+    ASSERT_EQ(1, response.get_result().value().size());
+    EXPECT_EQ(expected_obj, response.get_result().value().front());
+    ASSERT_EQ(1, response.get_errors().value().size());
+    EXPECT_EQ(expected_error, response.get_errors().value().front());
+    EXPECT_FALSE(response.is_paginated());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorManyTypeResultObjectWithoutCursorResponseIsEmpty) {
+    // Arrange
+    DummyObject dummy_object = DummyObject::create_default_dummy_object();
+    std::stringstream s;
+    s << R"({"data":{"result":{"items":[)"
+      << dummy_object.serialize()
+      << R"(]}}})";
+
+    // Act
+    GraphqlResponse<std::vector<DummyObject>> response(s.str());
+
+    // Assert
+    ASSERT_TRUE(response.is_empty());
+    ASSERT_FALSE(response.is_paginated());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorManyTypeInvalidJsonResponseIsEmpty) {
+    // Arrange
+    DummyObject dummy_object = DummyObject::create_default_dummy_object();
+    std::stringstream s;
+    s << R"({"errors":[)"
+      << POPULATED_ERROR_JSON
+      << R"(],"data":{"result":[)"
+      << dummy_object.serialize()
+      << R"(,)";
+
+    // Act
+    GraphqlResponse<std::vector<DummyObject>> response(s.str());
+
+    // Assert
+    ASSERT_TRUE(response.is_empty());
+    ASSERT_FALSE(response.get_errors().has_value());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorManyTypeNestedModelsAreDecodedAfterResponseIsDestroyed) {
+    // Arrange
+    std::vector<Transaction> transactions;
+    {
+        std::string json(R"({"data":{"result":[{"id":1,"project":{"name":"a"},"wallet":{"ethAddress":"0x1",)"
+                         R"("transactions":[{"id":2,"asset":{"id":"b"}},null]}},{"id":3,"wallet":null}]}})");
+        GraphqlResponse<std::vector<Transaction>> response(std::move(json));
+        transactions = response.get_result().value();
+    }
+
+    // Act
+    const std::optional<Wallet>& wallet = transactions.front().get_wallet();
+
+    // Assert
+    ASSERT_EQ(2, transactions.size());
+    ASSERT_TRUE(wallet.has_value());
+    EXPECT_EQ("0x1", wallet->get_eth_address().value());
+    ASSERT_EQ(2, wallet->get_transactions().value().size());
+    EXPECT_EQ(2, wallet->get_transactions()->front().get_id().value());
+    EXPECT_EQ("b", wallet->get_transactions()->front().get_asset().value().get_id().value());
+    EXPECT_FALSE(wallet->get_transactions()->back().get_id().has_value());
+    EXPECT_EQ("a", transactions.front().get_project().value().get_name().value());
+    EXPECT_FALSE(transactions.back().get_wallet().has_value());
+    EXPECT_FALSE(transactions.back().get_project().has_value());
+}
+
+TEST_F(GraphqlResponseTest, ConstructorManyTypeItemsEqualItemsDeserializedFromTheirJson) {
+    // Arrange
+    const std::string item_json(R"({"id":1,"blockchainData":{"nonce":"1","receipt":{"logs":[{"address":"0x1"}]}},)"
+                                R"("asset":{"id":"a","variants":[{"id":2}]},"wallet":{"ethAddress":"0x1",)"
+                                R"("balances":[{"value":1}],"assetsCreated":[{"id":"b"}]}})");
+    Transaction expected;
+    expected.deserialize(item_json);
+
+    // Act
+    GraphqlResponse<std::vector<Transaction>> response(R"({"data":{"result":[)" + item_json + R"(]}})");
+
+    // Assert
+    ASSERT_EQ(1, response.get_result().value().size());
+    ASSERT_EQ(expected, response.get_result()->front());
+}
+
 TEST_F(GraphqlResponseTest, HasErrorsReturnsTrue) {
     // Arrange
     GraphqlError error = create_default_graphql_error();
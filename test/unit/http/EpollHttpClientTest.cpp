@@ -0,0 +1,472 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "MockHttpServer.hpp"
+#include "MockTlsServer.hpp"
+#include "VerificationTestSuite.hpp"
+#include "enjinsdk/EpollHttpClient.hpp"
+#include "enjinsdk/HttpHeaders.hpp"
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <netinet/in.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace enjin::sdk::http;
+using namespace enjin::test::mocks;
+using namespace enjin::test::suites;
+
+namespace {
+
+/// \brief Server which hands each connection it accepts to a script, for tests where the server must misbehave at the
+/// level of the connection.
+class ScriptedSocketServer {
+public:
+    /// \brief Script run for an accepted connection, which is shut down once the script returns.
+    using Script = std::function<void(int fd, int connection_index)>;
+
+    explicit ScriptedSocketServer(Script script) : script(std::move(script)) {
+        listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(listen_fd, 8);
+
+        socklen_t length = sizeof(address);
+        getsockname(listen_fd, reinterpret_cast<sockaddr*>(&address), &length);
+        port = ntohs(address.sin_port);
+
+        accept_thread = std::thread([this]() {
+            std::vector<std::thread> handlers;
+            for (int i = 0;; i++) {
+                const int fd = accept(listen_fd, nullptr, nullptr);
+                if (fd < 0) {
+                    break;
+                }
+
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    accepted_fds.push_back(fd);
+                }
+
+                handlers.emplace_back([this, fd, i]() {
+                    ScriptedSocketServer::script(fd, i);
+                    shutdown(fd, SHUT_RDWR);
+                });
+            }
+
+            for (auto& handler: handlers) {
+                handler.join();
+            }
+        });
+    }
+
+    ~ScriptedSocketServer() {
+        shutdown(listen_fd, SHUT_RDWR);
+        {
+            // Unblocks scripts still reading from their connections
+            std::lock_guard<std::mutex> guard(mutex);
+            for (int fd: accepted_fds) {
+                shutdown(fd, SHUT_RDWR);
+            }
+        }
+
+        accept_thread.join();
+        for (int fd: accepted_fds) {
+            close(fd);
+        }
+        close(listen_fd);
+    }
+
+    [[nodiscard]] std::string uri() const {
+        return "http://127.0.0.1:" + std::to_string(port);
+    }
+
+    [[nodiscard]] int get_accepted_count() {
+        std::lock_guard<std::mutex> guard(mutex);
+        return static_cast<int>(accepted_fds.size());
+    }
+
+    /// \brief Reads a request with a Content-Length header from the connection.
+    /// \param fd The connection.
+    /// \return Whether a whole request was read before the connection closed.
+    static bool read_request(int fd) {
+        std::string in;
+        char buffer[1024];
+        while (true) {
+            const std::size_t header_end = in.find("\r\n\r\n");
+            if (header_end != std::string::npos) {
+                const std::size_t length_pos = in.find("Content-Length: ");
+                const std::size_t length = length_pos < header_end
+                                           ? std::stoul(in.substr(length_pos + 16))
+                                           : 0;
+                if (in.size() >= header_end + 4 + length) {
+                    return true;
+                }
+            }
+
+            const ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                return false;
+            }
+
+            in.append(buffer, static_cast<std::size_t>(received));
+        }
+    }
+
+    /// \brief Writes a successful keep-alive response to the connection.
+    /// \param fd The connection.
+    static void write_response(int fd) {
+        const std::string response = "HTTP/1.1 200 OK\r\n"
+                                     "Content-Type: application/json\r\n"
+                                     "Content-Length: 2\r\n"
+                                     "\r\n"
+                                     "{}";
+        send(fd, response.data(), response.size(), MSG_NOSIGNAL);
+    }
+
+private:
+    Script script;
+    int listen_fd;
+    int port;
+    std::mutex mutex;
+    std::vector<int> accepted_fds;
+    std::thread accept_thread;
+};
+
+/// \brief Script which responds to the first request of the first connection and closes the connection once it reads
+/// the second request, as a server closing an idle keep-alive connection would, and responds to every request of later
+/// connections.
+void close_after_reuse(int fd, int connection_index) {
+    if (connection_index == 0) {
+        if (ScriptedSocketServer::read_request(fd)) {
+            ScriptedSocketServer::write_response(fd);
+        }
+
+        ScriptedSocketServer::read_request(fd);
+        return;
+    }
+
+    while (ScriptedSocketServer::read_request(fd)) {
+        ScriptedSocketServer::write_response(fd);
+    }
+}
+
+}
+
+class EpollHttpClientTest : public VerificationTestSuite,
+                            public testing::Test {
+public:
+    static constexpr char JSON[] = "application/json; charset=utf-8";
+
+    std::unique_ptr<EpollHttpClient> class_under_test;
+
+    MockHttpServer mock_server;
+
+    static HttpRequest create_dummy_request() {
+        return HttpRequest().set_method(HttpMethod::Post)
+                            .set_path_query_fragment("/")
+                            .set_content_type(JSON)
+                            .set_body("{}");
+    }
+
+protected:
+    void SetUp() override {
+        mock_server.start();
+        class_under_test = std::make_unique<EpollHttpClient>(mock_server.uri());
+
+        mock_server.given(Request::create()
+                                  .with_path("/")
+                                  .with_body("{}")
+                                  .using_post())
+                   .respond_with(Response::create()
+                                         .with_success()
+                                         .with_header(ContentType, JSON)
+                                         .with_body("{}"));
+    }
+
+    void TearDown() override {
+        class_under_test->stop();
+        mock_server.stop();
+    }
+};
+
+class EpollHttpClientTlsTest : public testing::Test {
+public:
+    std::unique_ptr<EpollHttpClient> class_under_test;
+
+    MockTlsServer mock_server;
+
+    std::filesystem::path certificate_path;
+
+protected:
+    void SetUp() override {
+        mock_server.start();
+
+        // Trusts the self-signed certificate of the server through the default verify paths of OpenSSL
+        certificate_path = std::filesystem::temp_directory_path() / "enjinsdk-epoll-mock-tls-server.pem";
+        std::ofstream(certificate_path) << mock_server.get_certificate_pem();
+        setenv("SSL_CERT_FILE", certificate_path.c_str(), 1);
+    }
+
+    void TearDown() override {
+        if (class_under_test != nullptr) {
+            class_under_test->stop();
+        }
+
+        mock_server.stop();
+        unsetenv("SSL_CERT_FILE");
+        std::filesystem::remove(certificate_path);
+    }
+};
+
+TEST_F(EpollHttpClientTest, ConstructorBaseUriIsNotHttpOrHttpsThrowsException) {
+    // Assert
+    ASSERT_THROW(EpollHttpClient("ftp://localhost"), std::runtime_error);
+}
+
+#if !ENJINSDK_INCLUDE_EPOLL_TLS
+TEST_F(EpollHttpClientTest, ConstructorBaseUriIsHttpsWithoutTlsSupportThrowsException) {
+    // Assert
+    ASSERT_THROW(EpollHttpClient("https://localhost"), std::runtime_error);
+}
+#endif
+
+TEST_F(EpollHttpClientTest, SendRequestReceivesSuccessfulResponseAndReturnsExpected) {
+    // Arrange
+    const int expected_code = 200;
+    const std::string expected_body = "{}";
+    const std::string expected_content_type = JSON;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+
+    // Act
+    HttpResponse response = class_under_test->send_request(dummy_request).get();
+
+    // Assert
+    EXPECT_EQ(expected_code, response.get_code().value());
+    EXPECT_EQ(expected_body, response.get_body().value());
+    EXPECT_EQ(expected_content_type, response.get_header_value(ContentType).value());
+}
+
+TEST_F(EpollHttpClientTest, SendRequestClientIsNotStartedThrowsException) {
+    // Arrange
+    const HttpRequest dummy_request = create_dummy_request();
+
+    // Assert
+    ASSERT_THROW(class_under_test->send_request(dummy_request).get(), std::runtime_error);
+}
+
+TEST_F(EpollHttpClientTest, SendRequestRequestIsInvalidThrowsException) {
+    // Arrange
+    const HttpRequest dummy_request = HttpRequest().set_method(HttpMethod::Post)
+                                                   .set_path_query_fragment("/");
+    class_under_test->start();
+
+    // Assert
+    ASSERT_THROW(class_under_test->send_request(dummy_request).get(), std::runtime_error);
+}
+
+TEST_F(EpollHttpClientTest, SendRequestManyConcurrentRequestsAllReceiveResponses) {
+    // Arrange - Data
+    const int request_count = 500;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<EpollHttpClient>(mock_server.uri(), 8);
+    class_under_test->start();
+    std::vector<std::future<HttpResponse>> futures;
+
+    // Act
+    for (int i = 0; i < request_count; i++) {
+        futures.push_back(class_under_test->send_request(dummy_request));
+    }
+
+    // Assert
+    for (auto& future: futures) {
+        HttpResponse response = future.get();
+        EXPECT_TRUE(response.is_success());
+        EXPECT_EQ("{}", response.get_body().value());
+    }
+    EXPECT_EQ(0, class_under_test->get_in_flight_count());
+}
+
+TEST_F(EpollHttpClientTest, SetDefaultRequestHeaderSentRequestHasHeader) {
+    // Arrange - Data
+    const std::string expected_header_key("Test-Header");
+    const std::string expected_header_value("Test Value");
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+    class_under_test->set_default_request_header(expected_header_key, expected_header_value);
+
+    // Arrange - Expectations
+    mock_server.next_message([this, expected_header_key, expected_header_value](const HttpRequest& req) {
+        increment_call_counter();
+
+        auto actual = req.get_header_value(expected_header_key);
+        EXPECT_TRUE(actual.has_value());
+        EXPECT_EQ(expected_header_value, actual.value());
+    });
+    set_expected_call_count(1);
+
+    // Act
+    class_under_test->send_request(dummy_request).get();
+
+    // Verify
+    verify_call_count(1);
+
+    // Assert (see: Arrange - Expectations)
+}
+
+TEST_F(EpollHttpClientTest, StopClientIsNotOpen) {
+    // Arrange
+    class_under_test->start();
+
+    // Act
+    class_under_test->stop();
+
+    // Assert
+    ASSERT_FALSE(class_under_test->is_open());
+}
+
+TEST_F(EpollHttpClientTest, SendRequestServerDoesNotRespondThrowsExceptionAfterReadTimeout) {
+    // Arrange
+    std::promise<void> finished;
+    std::shared_future<void> finished_future = finished.get_future().share();
+    ScriptedSocketServer server([finished_future](int fd, int) {
+        ScriptedSocketServer::read_request(fd);
+        finished_future.wait();
+    });
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<EpollHttpClient>(server.uri());
+    class_under_test->set_timeouts(std::chrono::seconds(1), std::chrono::milliseconds(100), std::chrono::seconds(1));
+    class_under_test->start();
+
+    // Act
+    std::future<HttpResponse> future = class_under_test->send_request(dummy_request);
+    const std::future_status status = future.wait_for(std::chrono::seconds(5));
+    finished.set_value();
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, status);
+    ASSERT_THROW(future.get(), std::runtime_error);
+}
+
+TEST_F(EpollHttpClientTest, SendRequestServerDoesNotRespondOnReusedConnectionThrowsExceptionAfterReadTimeout) {
+    // Arrange
+    std::promise<void> finished;
+    std::shared_future<void> finished_future = finished.get_future().share();
+    ScriptedSocketServer server([finished_future](int fd, int) {
+        if (ScriptedSocketServer::read_request(fd)) {
+            ScriptedSocketServer::write_response(fd);
+        }
+
+        ScriptedSocketServer::read_request(fd);
+        finished_future.wait();
+    });
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<EpollHttpClient>(server.uri());
+    class_under_test->set_timeouts(std::chrono::seconds(1), std::chrono::milliseconds(100), std::chrono::seconds(1));
+    class_under_test->start();
+    class_under_test->send_request(dummy_request).get();
+
+    // Act
+    std::future<HttpResponse> future = class_under_test->send_request(dummy_request);
+    const std::future_status status = future.wait_for(std::chrono::seconds(5));
+    finished.set_value();
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, status);
+    ASSERT_THROW(future.get(), std::runtime_error);
+    EXPECT_EQ(1, server.get_accepted_count());
+}
+
+TEST_F(EpollHttpClientTest, SendRequestConnectionClosedAfterReuseRequestIsNotIdempotentThrowsException) {
+    // Arrange
+    ScriptedSocketServer server(close_after_reuse);
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<EpollHttpClient>(server.uri());
+    class_under_test->start();
+    class_under_test->send_request(dummy_request).get();
+
+    // Act
+    std::future<HttpResponse> future = class_under_test->send_request(dummy_request);
+
+    // Assert
+    ASSERT_THROW(future.get(), std::runtime_error);
+    EXPECT_EQ(1, server.get_accepted_count());
+}
+
+TEST_F(EpollHttpClientTest, SendRequestConnectionClosedAfterReuseRequestIsIdempotentSendsRequestAgain) {
+    // Arrange
+    ScriptedSocketServer server(close_after_reuse);
+    HttpRequest dummy_request = create_dummy_request();
+    dummy_request.set_idempotent(true);
+    class_under_test = std::make_unique<EpollHttpClient>(server.uri());
+    class_under_test->start();
+    class_under_test->send_request(dummy_request).get();
+
+    // Act
+    HttpResponse response = class_under_test->send_request(dummy_request).get();
+
+    // Assert
+    EXPECT_TRUE(response.is_success());
+    EXPECT_EQ(2, server.get_accepted_count());
+}
+
+#if ENJINSDK_INCLUDE_EPOLL_TLS
+TEST_F(EpollHttpClientTlsTest, SendRequestBaseUriIsHttpsReceivesSuccessfulResponsesOverOneConnection) {
+    // Arrange
+    const std::size_t expected_connections = 1;
+    const HttpRequest dummy_request = EpollHttpClientTest::create_dummy_request();
+    class_under_test = std::make_unique<EpollHttpClient>(mock_server.uri());
+    class_under_test->start();
+
+    // Act
+    HttpResponse first_response = class_under_test->send_request(dummy_request).get();
+    HttpResponse second_response = class_under_test->send_request(dummy_request).get();
+
+    // Assert
+    EXPECT_TRUE(first_response.is_success());
+    EXPECT_TRUE(second_response.is_success());
+    EXPECT_EQ("{}", second_response.get_body().value());
+    EXPECT_EQ(expected_connections, mock_server.get_connection_count());
+}
+
+TEST_F(EpollHttpClientTlsTest, SendRequestServerCertificateIsNotTrustedThrowsException) {
+    // Arrange
+    unsetenv("SSL_CERT_FILE");
+    const HttpRequest dummy_request = EpollHttpClientTest::create_dummy_request();
+    class_under_test = std::make_unique<EpollHttpClient>(mock_server.uri());
+    class_under_test->start();
+
+    // Act
+    std::future<HttpResponse> future = class_under_test->send_request(dummy_request);
+
+    // Assert
+    ASSERT_THROW(future.get(), std::runtime_error);
+}
+#endif
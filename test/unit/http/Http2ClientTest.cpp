@@ -0,0 +1,254 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "MockHttp2Server.hpp"
+#include "enjinsdk/Http2Client.hpp"
+#include "enjinsdk/HttpHeaders.hpp"
+#include <arpa/inet.h>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <netinet/in.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace enjin::sdk::http;
+using namespace enjin::test::mocks;
+
+namespace {
+
+/// \brief Server whose connections are completed by the kernel but which never reads from or writes to them, for tests
+/// of timeouts.
+class SilentServer {
+public:
+    SilentServer() {
+        listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(listen_fd, 8);
+
+        socklen_t length = sizeof(address);
+        getsockname(listen_fd, reinterpret_cast<sockaddr*>(&address), &length);
+        port = ntohs(address.sin_port);
+    }
+
+    ~SilentServer() {
+        close(listen_fd);
+    }
+
+    [[nodiscard]] std::string uri(const std::string& scheme) const {
+        return scheme + "://127.0.0.1:" + std::to_string(port);
+    }
+
+private:
+    int listen_fd;
+    int port;
+};
+
+}
+
+class Http2ClientTest : public testing::Test {
+public:
+    static constexpr char JSON[] = "application/json; charset=utf-8";
+
+    std::unique_ptr<Http2Client> class_under_test;
+
+    MockHttp2Server mock_server;
+
+    static HttpRequest create_dummy_request() {
+        return HttpRequest().set_method(HttpMethod::Post)
+                            .set_path_query_fragment("/graphql/project")
+                            .set_content_type(JSON)
+                            .set_body("{}");
+    }
+
+protected:
+    void SetUp() override {
+        mock_server.start();
+        mock_server.respond_with(200, "{}", {{"content-type", JSON}});
+        class_under_test = std::make_unique<Http2Client>(mock_server.uri());
+    }
+
+    void TearDown() override {
+        class_under_test->stop();
+        mock_server.stop();
+    }
+};
+
+TEST_F(Http2ClientTest, ConstructorBaseUriHasUnsupportedSchemeThrowsException) {
+    // Assert
+    ASSERT_THROW(Http2Client("ws://localhost"), std::runtime_error);
+}
+
+TEST_F(Http2ClientTest, SendRequestReceivesSuccessfulResponseAndReturnsExpected) {
+    // Arrange
+    const int expected_code = 200;
+    const std::string expected_body = "{}";
+    const std::string expected_content_type = JSON;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+
+    // Act
+    HttpResponse response = class_under_test->send_request(dummy_request).get();
+
+    // Assert
+    EXPECT_EQ(expected_code, response.get_code().value());
+    EXPECT_EQ(expected_body, response.get_body().value());
+    EXPECT_EQ(expected_content_type, response.get_header_value("content-type").value());
+}
+
+TEST_F(Http2ClientTest, SendRequestServerReceivesExpectedRequest) {
+    // Arrange
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+
+    // Act
+    class_under_test->send_request(dummy_request).get();
+
+    // Assert
+    std::vector<HttpRequest> requests = mock_server.get_received_requests();
+    ASSERT_EQ(1, requests.size());
+    EXPECT_EQ(HttpMethod::Post, requests[0].get_method().value());
+    EXPECT_EQ(dummy_request.get_path_query_fragment(), requests[0].get_path_query_fragment());
+    EXPECT_EQ(dummy_request.get_body(), requests[0].get_body());
+    EXPECT_EQ(JSON, requests[0].get_header_value("content-type").value());
+}
+
+TEST_F(Http2ClientTest, SendRequestClientIsNotStartedThrowsException) {
+    // Arrange
+    const HttpRequest dummy_request = create_dummy_request();
+
+    // Assert
+    ASSERT_THROW(class_under_test->send_request(dummy_request).get(), std::runtime_error);
+}
+
+TEST_F(Http2ClientTest, SendRequestManyConcurrentRequestsAreMultiplexedOverOneConnection) {
+    // Arrange
+    const int request_count = 500;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+    std::vector<std::future<HttpResponse>> futures;
+
+    // Act
+    for (int i = 0; i < request_count; i++) {
+        futures.push_back(class_under_test->send_request(dummy_request));
+    }
+
+    // Assert
+    for (auto& future: futures) {
+        EXPECT_TRUE(future.get().is_success());
+    }
+    EXPECT_EQ(1, mock_server.get_connection_count());
+    EXPECT_EQ(1, class_under_test->get_connection_count());
+    EXPECT_EQ(0, class_under_test->get_in_flight_count());
+}
+
+TEST_F(Http2ClientTest, SetDefaultRequestHeaderSentRequestHasHeader) {
+    // Arrange
+    const std::string expected_header_value("Bearer token");
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+    class_under_test->set_default_request_header(Authorization, expected_header_value);
+
+    // Act
+    class_under_test->send_request(dummy_request).get();
+
+    // Assert
+    std::vector<HttpRequest> requests = mock_server.get_received_requests();
+    ASSERT_EQ(1, requests.size());
+    EXPECT_EQ(expected_header_value, requests[0].get_header_value("authorization").value());
+}
+
+TEST_F(Http2ClientTest, SendRequestServerIsStoppedThrowsException) {
+    // Arrange
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+    class_under_test->send_request(dummy_request).get();
+    mock_server.stop();
+
+    // Assert
+    ASSERT_THROW(class_under_test->send_request(dummy_request).get(), std::runtime_error);
+}
+
+TEST_F(Http2ClientTest, SendRequestServerDoesNotRespondThrowsExceptionAfterReadTimeout) {
+    // Arrange
+    SilentServer server;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<Http2Client>(server.uri("http"));
+    class_under_test->set_timeouts(std::chrono::seconds(5), std::chrono::milliseconds(100), std::chrono::seconds(5));
+    class_under_test->start();
+
+    // Act
+    std::future<HttpResponse> future = class_under_test->send_request(dummy_request);
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(2)));
+    ASSERT_THROW(future.get(), std::runtime_error);
+    EXPECT_EQ(0, class_under_test->get_in_flight_count());
+}
+
+TEST_F(Http2ClientTest, SendRequestServerDoesNotRespondThrowsExceptionAfterRequestTimeout) {
+    // Arrange
+    SilentServer server;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<Http2Client>(server.uri("http"));
+    class_under_test->set_timeouts(std::chrono::seconds(5), std::chrono::seconds(5), std::chrono::milliseconds(100));
+    class_under_test->start();
+
+    // Act
+    std::future<HttpResponse> future = class_under_test->send_request(dummy_request);
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(2)));
+    ASSERT_THROW(future.get(), std::runtime_error);
+}
+
+TEST_F(Http2ClientTest, SendRequestServerDoesNotCompleteTlsHandshakeThrowsExceptionAfterConnectTimeout) {
+    // Arrange
+    SilentServer server;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<Http2Client>(server.uri("https"));
+    class_under_test->set_timeouts(std::chrono::milliseconds(100), std::chrono::seconds(5), std::chrono::seconds(5));
+    class_under_test->start();
+
+    // Act
+    std::future<HttpResponse> future = class_under_test->send_request(dummy_request);
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(2)));
+    ASSERT_THROW(future.get(), std::runtime_error);
+}
+
+TEST_F(Http2ClientTest, StopWhileTlsHandshakeIsInProgressFailsRequestWithoutWaitingForTimeout) {
+    // Arrange
+    SilentServer server;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<Http2Client>(server.uri("https"));
+    class_under_test->start();
+    std::future<HttpResponse> future = class_under_test->send_request(dummy_request);
+
+    // Act
+    class_under_test->stop();
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
+    ASSERT_THROW(future.get(), std::runtime_error);
+}
@@ -15,13 +15,22 @@
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "CompressionUtils.hpp"
 #include "HttpClient.hpp"
 #include "MockHttpServer.hpp"
 #include "MockLogger.hpp"
+#include "MockTlsServer.hpp"
 #include "VerificationTestSuite.hpp"
 #include "enjinsdk/HttpHeaders.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace enjin::sdk::http;
 using namespace enjin::sdk::utils;
@@ -42,6 +51,18 @@ public:
                             .set_content_type(JSON)
                             .set_body("{}");
     }
+
+    /// \brief Waits for the pool of the client to hold the number of idle connections, as pre-warmed connections are
+    /// opened in the background.
+    static ConnectionPoolStats wait_for_idle_connections(const HttpClient& client, std::size_t count) {
+        ConnectionPoolStats stats = client.get_connection_pool_stats().value();
+        for (int i = 0; i < 500 && stats.idle_connections < count; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            stats = client.get_connection_pool_stats().value();
+        }
+
+        return stats;
+    }
 };
 
 class HttpClientTest : public HttpClientSuite,
@@ -62,6 +83,36 @@ protected:
     }
 };
 
+class HttpClientTlsTest : public HttpClientSuite,
+                          public testing::Test {
+public:
+    std::unique_ptr<HttpClient> class_under_test;
+
+    MockTlsServer mock_server;
+
+    std::filesystem::path certificate_path;
+
+protected:
+    void SetUp() override {
+        mock_server.start();
+
+        // Trusts the self-signed certificate of the server through the default verify paths of OpenSSL
+        certificate_path = std::filesystem::temp_directory_path() / "enjinsdk-mock-tls-server.pem";
+        std::ofstream(certificate_path) << mock_server.get_certificate_pem();
+        setenv("SSL_CERT_FILE", certificate_path.c_str(), 1);
+    }
+
+    void TearDown() override {
+        if (class_under_test != nullptr) {
+            class_under_test->stop();
+        }
+
+        mock_server.stop();
+        unsetenv("SSL_CERT_FILE");
+        std::filesystem::remove(certificate_path);
+    }
+};
+
 class HttpClientLoggingTest : public HttpClientSuite,
                               public testing::TestWithParam<HttpLogLevel> {
 public:
@@ -144,6 +195,327 @@ TEST_F(HttpClientTest, SetDefaultRequestHeaderSentRequestHasHeader) {
     // Assert (see: Arrange - Expectations)
 }
 
+TEST_F(HttpClientTest, SendRequestClientIsNotStartedThrowsException) {
+    // Arrange
+    const HttpRequest dummy_request = create_dummy_request();
+
+    // Assert
+    ASSERT_THROW(class_under_test->send_request(dummy_request).get(), std::runtime_error);
+}
+
+TEST_F(HttpClientTest, SendRequestConcurrentRequestsDoNotExceedMaxConnections) {
+    // Arrange - Data
+    const std::size_t max_connections = 2;
+    const int request_count = 16;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<HttpClient>(mock_server.uri(), max_connections);
+    class_under_test->start();
+    std::vector<std::future<HttpResponse>> futures;
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path("/")
+                              .with_body("{}")
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body("{}"));
+
+    // Act
+    for (int i = 0; i < request_count; i++) {
+        futures.push_back(class_under_test->send_request(dummy_request));
+    }
+
+    for (auto& future: futures) {
+        EXPECT_TRUE(future.get().is_success());
+    }
+
+    // Assert
+    ConnectionPoolStats stats = class_under_test->get_connection_pool_stats().value();
+    EXPECT_EQ(max_connections, stats.max_connections);
+    EXPECT_LE(stats.created_connections, max_connections);
+    EXPECT_EQ(0, stats.active_connections);
+    EXPECT_EQ(0, stats.waiting_requests);
+    EXPECT_EQ(stats.created_connections, stats.idle_connections);
+}
+
+TEST_F(HttpClientTest, SendRequestConnectionIsIdlePastTimeoutConnectionIsEvicted) {
+    // Arrange - Data
+    const std::chrono::milliseconds idle_timeout(1);
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test = std::make_unique<HttpClient>(mock_server.uri(), 1, idle_timeout);
+    class_under_test->start();
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path("/")
+                              .with_body("{}")
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body("{}"));
+
+    // Act
+    class_under_test->send_request(dummy_request).get();
+    std::this_thread::sleep_for(idle_timeout * 10);
+    class_under_test->send_request(dummy_request).get();
+
+    // Assert
+    ConnectionPoolStats stats = class_under_test->get_connection_pool_stats().value();
+    EXPECT_EQ(2, stats.created_connections);
+    EXPECT_GE(stats.evicted_connections, 1);
+}
+
+TEST_F(HttpClientTest, StartPrewarmedConnectionsAreSetOpensConnectionsToPool) {
+    // Arrange - Data
+    const std::size_t expected_connections = 2;
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->set_prewarmed_connections(expected_connections);
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path("/")
+                              .with_body("{}")
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body("{}"));
+
+    // Act
+    class_under_test->start();
+    ConnectionPoolStats stats_after_start = wait_for_idle_connections(*class_under_test, expected_connections);
+    class_under_test->send_request(dummy_request).get();
+    ConnectionPoolStats stats_after_request = class_under_test->get_connection_pool_stats().value();
+
+    // Assert
+    EXPECT_EQ(expected_connections, stats_after_start.created_connections);
+    EXPECT_EQ(expected_connections, stats_after_start.idle_connections);
+    EXPECT_EQ(expected_connections, stats_after_request.created_connections);
+}
+
+TEST_F(HttpClientTest, StartPrewarmedConnectionsExceedMaxConnectionsOpensMaxConnections) {
+    // Arrange
+    const std::size_t max_connections = 2;
+    class_under_test = std::make_unique<HttpClient>(mock_server.uri(), max_connections);
+    class_under_test->set_prewarmed_connections(max_connections + 2);
+
+    // Act
+    class_under_test->start();
+    ConnectionPoolStats stats = wait_for_idle_connections(*class_under_test, max_connections);
+
+    // Assert
+    EXPECT_EQ(max_connections, stats.created_connections);
+    EXPECT_EQ(max_connections, stats.idle_connections);
+}
+
+TEST_F(HttpClientTest, StopWhilePrewarmingConnectionsLeavesNoConnectionsInPool) {
+    // Arrange
+    class_under_test->set_prewarmed_connections(4);
+    class_under_test->start();
+
+    // Act
+    class_under_test->stop();
+
+    // Assert
+    ConnectionPoolStats stats = class_under_test->get_connection_pool_stats().value();
+    EXPECT_EQ(0, stats.active_connections);
+    EXPECT_EQ(0, stats.idle_connections);
+    EXPECT_EQ(stats.created_connections, stats.evicted_connections);
+}
+
+TEST_F(HttpClientTlsTest, StartPrewarmedConnectionsResumeTlsSessionOfFirstConnection) {
+    // Arrange
+    const std::size_t connections = 3;
+    class_under_test = std::make_unique<HttpClient>(mock_server.uri(), connections);
+    class_under_test->set_prewarmed_connections(connections);
+
+    // Act
+    class_under_test->start();
+    wait_for_idle_connections(*class_under_test, connections);
+
+    // Assert
+    EXPECT_EQ(connections, mock_server.get_connection_count());
+    EXPECT_EQ(connections - 1, mock_server.get_resumed_connection_count());
+}
+
+TEST_F(HttpClientTest, StopEvictsIdleConnections) {
+    // Arrange - Data
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path("/")
+                              .with_body("{}")
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body("{}"));
+    class_under_test->send_request(dummy_request).get();
+
+    // Act
+    class_under_test->stop();
+
+    // Assert
+    ConnectionPoolStats stats = class_under_test->get_connection_pool_stats().value();
+    EXPECT_FALSE(class_under_test->is_open());
+    EXPECT_EQ(0, stats.idle_connections);
+    EXPECT_EQ(stats.created_connections, stats.evicted_connections);
+}
+
+TEST_F(HttpClientTest, SendRequestCompressionEnabledBodyReachesThresholdSendsCompressedBody) {
+    // Arrange - Data
+    const std::string expected_body = "{\"data\":\"" + std::string(256, 'a') + "\"}";
+    const std::string expected_encoding("gzip");
+    const std::string compressed_body = gzip_compress(expected_body);
+    const HttpRequest dummy_request = create_dummy_request().set_body(expected_body);
+    class_under_test->set_request_compression(true, expected_body.size());
+    class_under_test->start();
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path("/")
+                              .with_body(compressed_body)
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body("{}"));
+
+    // Arrange - Expectations
+    mock_server.next_message([this, expected_body, expected_encoding](const HttpRequest& req) {
+        increment_call_counter();
+
+        auto actual_encoding = req.get_header_value(ContentEncoding);
+        EXPECT_TRUE(actual_encoding.has_value());
+        EXPECT_EQ(expected_encoding, actual_encoding.value());
+        EXPECT_EQ(expected_body, decompress(req.get_body().value(), expected_encoding));
+    });
+    set_expected_call_count(1);
+
+    // Act
+    class_under_test->send_request(dummy_request).get();
+
+    // Verify
+    verify_call_count(1);
+
+    // Assert
+    CompressionStats stats = class_under_test->get_compression_stats().value();
+    EXPECT_EQ(1, stats.requests_compressed);
+    EXPECT_EQ(expected_body.size(), stats.request_bytes_uncompressed);
+    EXPECT_EQ(compressed_body.size(), stats.request_bytes_compressed);
+}
+
+TEST_F(HttpClientTest, SendRequestCompressionEnabledBodyIsBelowThresholdSendsUncompressedBody) {
+    // Arrange - Data
+    const std::string expected_body = "{\"data\":\"" + std::string(256, 'a') + "\"}";
+    const HttpRequest dummy_request = create_dummy_request().set_body(expected_body);
+    class_under_test->set_request_compression(true, expected_body.size() + 1);
+    class_under_test->start();
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path("/")
+                              .with_body(expected_body)
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body("{}"));
+
+    // Arrange - Expectations
+    mock_server.next_message([this, expected_body](const HttpRequest& req) {
+        increment_call_counter();
+
+        EXPECT_FALSE(req.get_header_value(ContentEncoding).has_value());
+        EXPECT_EQ(expected_body, req.get_body().value());
+    });
+    set_expected_call_count(1);
+
+    // Act
+    class_under_test->send_request(dummy_request).get();
+
+    // Verify
+    verify_call_count(1);
+
+    // Assert
+    CompressionStats stats = class_under_test->get_compression_stats().value();
+    EXPECT_EQ(0, stats.requests_compressed);
+}
+
+TEST_F(HttpClientTest, SendRequestResponseIsGzipEncodedReturnsDecompressedBody) {
+    // Arrange - Data
+    const std::string expected_body = "{\"data\":\"" + std::string(256, 'a') + "\"}";
+    const std::string compressed_body = gzip_compress(expected_body);
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path("/")
+                              .with_body("{}")
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_header(ContentEncoding, "gzip")
+                                     .with_body(compressed_body));
+
+    // Arrange - Expectations
+    mock_server.next_message([this](const HttpRequest& req) {
+        increment_call_counter();
+
+        auto actual = req.get_header_value(AcceptEncoding);
+        EXPECT_TRUE(actual.has_value());
+        EXPECT_EQ("gzip, deflate", actual.value());
+    });
+    set_expected_call_count(1);
+
+    // Act
+    HttpResponse response = class_under_test->send_request(dummy_request).get();
+
+    // Verify
+    verify_call_count(1);
+
+    // Assert
+    CompressionStats stats = class_under_test->get_compression_stats().value();
+    EXPECT_EQ(expected_body, response.get_body().value());
+    EXPECT_FALSE(response.get_header_value(ContentEncoding).has_value());
+    EXPECT_EQ(1, stats.responses_decompressed);
+    EXPECT_EQ(compressed_body.size(), stats.response_bytes_compressed);
+    EXPECT_EQ(expected_body.size(), stats.response_bytes_uncompressed);
+}
+
+TEST_F(HttpClientTest, SetDefaultRequestHeaderAcceptEncodingIsIdentitySentRequestIsNotSentDefaultAcceptEncoding) {
+    // Arrange - Data
+    const std::string expected("identity");
+    const HttpRequest dummy_request = create_dummy_request();
+    class_under_test->start();
+    class_under_test->set_default_request_header(AcceptEncoding, expected);
+
+    // Arrange - Expectations
+    mock_server.next_message([this, expected](const HttpRequest& req) {
+        increment_call_counter();
+
+        auto actual = req.get_header_value(AcceptEncoding);
+        EXPECT_TRUE(actual.has_value());
+        EXPECT_EQ(expected, actual.value());
+    });
+    set_expected_call_count(1);
+
+    // Act
+    class_under_test->send_request(dummy_request).get();
+
+    // Verify
+    verify_call_count(1);
+
+    // Assert (see: Arrange - Expectations)
+}
+
 TEST_F(HttpClientTest, SetLoggerHttpLogLevelIsNoneExpectNoLogs) {
     // Arrange - Data
     const HttpLogLevel log_level = HttpLogLevel::None;
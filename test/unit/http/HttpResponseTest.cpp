@@ -17,6 +17,8 @@
 #include "JsonTestSuite.hpp"
 #include "gtest/gtest.h"
 #include "enjinsdk/HttpResponse.hpp"
+#include <optional>
+#include <string>
 
 using namespace enjin::sdk::http;
 using namespace enjin::test::suites;
@@ -136,6 +138,21 @@ TEST_F(HttpResponseTest, IsEmptyBodyIsPopulatedJsonObjectReturnsFalse) {
     ASSERT_FALSE(actual);
 }
 
+TEST_F(HttpResponseTest, TakeBodyReturnsBodyAndLeavesResponseWithoutBody) {
+    // Arrange
+    const std::string expected(R"({"key":"value"})");
+    HttpResponse response = HttpResponse::builder()
+            .body(expected)
+            .build();
+
+    // Act
+    std::optional<std::string> actual = response.take_body();
+
+    // Assert
+    ASSERT_EQ(expected, actual.value());
+    ASSERT_FALSE(response.get_body().has_value());
+}
+
 INSTANTIATE_TEST_SUITE_P(IsSuccess,
                          HttpResponseStatusCodeFailed100To199Test,
                          testing::Range(100, 200));
@@ -0,0 +1,189 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DummyObject.hpp"
+#include "gtest/gtest.h"
+#include "JsonParser.hpp"
+#include "enjinsdk/GraphqlResponse.hpp"
+#include "enjinsdk/JsonParseLimits.hpp"
+#include "enjinsdk/JsonValue.hpp"
+#include "rapidjson/document.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::json;
+using namespace enjin::test::utils;
+
+class JsonParseLimitsTest : public testing::Test {
+public:
+    JsonParseLimits limits;
+    JsonParseRejectionStats stats_before;
+
+    static std::string create_nested_arrays(std::size_t depth) {
+        return std::string(depth, '[') + std::string(depth, ']');
+    }
+
+protected:
+    void SetUp() override {
+        stats_before = get_json_parse_rejection_stats();
+    }
+
+    void TearDown() override {
+        set_json_parse_limits(JsonParseLimits());
+    }
+};
+
+TEST_F(JsonParseLimitsTest, ParseDocumentTextExceedsMaxBytesReturnsFalseAndCountsRejection) {
+    // Arrange
+    const std::string raw(R"({"key":"value"})");
+    limits.max_bytes = raw.size() - 1;
+    set_json_parse_limits(limits);
+    rapidjson::Document document;
+
+    // Act
+    bool is_parsed = parse_document(document, raw);
+
+    // Assert
+    ASSERT_FALSE(is_parsed);
+    ASSERT_TRUE(document.IsNull());
+    ASSERT_EQ(stats_before.too_many_bytes + 1, get_json_parse_rejection_stats().too_many_bytes);
+}
+
+TEST_F(JsonParseLimitsTest, ParseDocumentTextExceedsMaxDepthReturnsFalseAndCountsRejection) {
+    // Arrange
+    limits.max_depth = 4;
+    set_json_parse_limits(limits);
+    rapidjson::Document document;
+
+    // Act
+    bool is_parsed = parse_document(document, create_nested_arrays(5));
+
+    // Assert
+    ASSERT_FALSE(is_parsed);
+    ASSERT_EQ(stats_before.too_deep + 1, get_json_parse_rejection_stats().too_deep);
+}
+
+TEST_F(JsonParseLimitsTest, ParseDocumentTextAtMaxDepthReturnsTrue) {
+    // Arrange
+    limits.max_depth = 4;
+    set_json_parse_limits(limits);
+    rapidjson::Document document;
+
+    // Act
+    bool is_parsed = parse_document(document, create_nested_arrays(4));
+
+    // Assert
+    ASSERT_TRUE(is_parsed);
+    ASSERT_TRUE(document.IsArray());
+}
+
+TEST_F(JsonParseLimitsTest, ParseDocumentInSituKeyExceedsMaxStringLengthReturnsFalseAndCountsRejection) {
+    // Arrange
+    std::string raw(R"({"long key":true})");
+    limits.max_string_length = 4;
+    set_json_parse_limits(limits);
+    rapidjson::Document document;
+
+    // Act
+    bool is_parsed = parse_document_in_situ(document, raw);
+
+    // Assert
+    ASSERT_FALSE(is_parsed);
+    ASSERT_EQ(stats_before.string_too_long + 1, get_json_parse_rejection_stats().string_too_long);
+}
+
+TEST_F(JsonParseLimitsTest, ParseDocumentTextExceedsMaxNodesReturnsFalseAndCountsRejection) {
+    // Arrange
+    limits.max_nodes = 3;
+    set_json_parse_limits(limits);
+    rapidjson::Document document;
+
+    // Act
+    bool is_parsed = parse_document(document, "[1,2,3]");
+
+    // Assert
+    ASSERT_FALSE(is_parsed);
+    ASSERT_EQ(stats_before.too_many_nodes + 1, get_json_parse_rejection_stats().too_many_nodes);
+}
+
+TEST_F(JsonParseLimitsTest, ParseDocumentLimitsAreZeroReturnsTrue) {
+    // Arrange
+    limits.max_bytes = 0;
+    limits.max_depth = 0;
+    limits.max_string_length = 0;
+    limits.max_nodes = 0;
+    set_json_parse_limits(limits);
+    rapidjson::Document document;
+
+    // Act
+    bool is_parsed = parse_document(document, R"({"key":[["value"]]})");
+
+    // Assert
+    ASSERT_TRUE(is_parsed);
+}
+
+TEST_F(JsonParseLimitsTest, TryParseAsObjectTextExceedsLimitLeavesValueUnchanged) {
+    // Arrange
+    JsonValue value;
+    value.try_parse_as_object(R"({"key":"value"})");
+    const std::string expected = value.to_string();
+    limits.max_nodes = 2;
+    set_json_parse_limits(limits);
+
+    // Act
+    bool is_parsed = value.try_parse_as_object(R"({"a":1,"b":2})");
+
+    // Assert
+    ASSERT_FALSE(is_parsed);
+    ASSERT_EQ(expected, value.to_string());
+}
+
+TEST_F(JsonParseLimitsTest, GraphqlResponseManyTypeExceedsLimitResponseIsEmpty) {
+    // Arrange
+    DummyObject dummy_object = DummyObject::create_default_dummy_object();
+    std::stringstream s;
+    s << R"({"data":{"result":[)"
+      << dummy_object.serialize()
+      << R"(]}})";
+    limits.max_depth = 2;
+    set_json_parse_limits(limits);
+
+    // Act
+    GraphqlResponse<std::vector<DummyObject>> response(s.str());
+
+    // Assert
+    ASSERT_TRUE(response.is_empty());
+    ASSERT_EQ(stats_before.too_deep + 1, get_json_parse_rejection_stats().too_deep);
+}
+
+TEST_F(JsonParseLimitsTest, GetJsonParseLimitsReturnsLimitsSet) {
+    // Arrange
+    limits.max_bytes = 1;
+    limits.max_depth = 2;
+    limits.max_string_length = 3;
+    limits.max_nodes = 4;
+
+    // Act
+    set_json_parse_limits(limits);
+
+    // Assert
+    const JsonParseLimits actual = get_json_parse_limits();
+    ASSERT_EQ(limits.max_bytes, actual.max_bytes);
+    ASSERT_EQ(limits.max_depth, actual.max_depth);
+    ASSERT_EQ(limits.max_string_length, actual.max_string_length);
+    ASSERT_EQ(limits.max_nodes, actual.max_nodes);
+}
@@ -0,0 +1,182 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "JsonParser.hpp"
+#include "JsonSource.hpp"
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include <memory>
+#include <string>
+
+using namespace enjin::sdk::json;
+
+class JsonParserValidJsonTest : public testing::TestWithParam<const char*> {
+public:
+    static std::string to_string(const rapidjson::Document& document) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+
+        return {buffer.GetString(), buffer.GetSize()};
+    }
+};
+
+class JsonParserInvalidJsonTest : public testing::TestWithParam<const char*> {
+};
+
+class JsonParserSpanTest : public testing::Test {
+public:
+    static std::string get_text(const JsonSourceRecorder& recorder, const JsonSpan& span) {
+        return recorder.get_text()->substr(span.offset, span.length);
+    }
+};
+
+TEST_P(JsonParserValidJsonTest, ParseDocumentTextIsValidJsonReturnsTrue) {
+    // Arrange
+    const std::string raw(GetParam());
+    rapidjson::Document document;
+
+    // Act
+    bool is_parsed = parse_document(document, raw);
+
+    // Assert
+    ASSERT_TRUE(is_parsed);
+}
+
+TEST_P(JsonParserValidJsonTest, ParseDocumentInSituParsesSameDocumentAsParseDocument) {
+    // Arrange
+    std::string raw(GetParam());
+    rapidjson::Document expected;
+    rapidjson::Document actual;
+    ASSERT_TRUE(parse_document(expected, raw));
+
+    // Act
+    bool is_parsed = parse_document_in_situ(actual, raw);
+
+    // Assert
+    ASSERT_TRUE(is_parsed);
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(to_string(expected), to_string(actual));
+}
+
+TEST_P(JsonParserValidJsonTest, ParseDocumentSpanParsesSameDocumentAsParseDocument) {
+    // Arrange
+    const std::string raw(GetParam());
+    const auto text = std::make_shared<const std::string>("[" + raw + ",0]");
+    JsonSourceRecorder recorder(text, 0);
+    rapidjson::Document expected;
+    rapidjson::Document actual;
+    ASSERT_TRUE(parse_document(expected, raw));
+
+    // Act
+    bool is_parsed = parse_document_span(actual, recorder, {1, raw.size()});
+
+    // Assert
+    ASSERT_TRUE(is_parsed);
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(to_string(expected), to_string(actual));
+}
+
+TEST_P(JsonParserInvalidJsonTest, ParseDocumentTextIsInvalidJsonReturnsFalseAndLeavesDocumentNull) {
+    // Arrange
+    const std::string raw(GetParam());
+    rapidjson::Document actual;
+
+    // Act
+    bool is_parsed = parse_document(actual, raw);
+
+    // Assert
+    ASSERT_FALSE(is_parsed);
+    ASSERT_TRUE(actual.IsNull());
+}
+
+TEST_P(JsonParserInvalidJsonTest, ParseDocumentInSituTextIsInvalidJsonReturnsFalseAndLeavesDocumentNull) {
+    // Arrange
+    std::string raw(GetParam());
+    rapidjson::Document actual;
+
+    // Act
+    bool is_parsed = parse_document_in_situ(actual, raw);
+
+    // Assert
+    ASSERT_FALSE(is_parsed);
+    ASSERT_TRUE(actual.IsNull());
+}
+
+TEST_F(JsonParserSpanTest, ParseDocumentSpanRecordsSpansOfObjectAndArrayMembersOfObjectsAtDepth) {
+    // Arrange
+    const auto text = std::make_shared<const std::string>(
+            R"({"items":[{"a":1,"b":{"c":[2]},"d":[3,{"e":4}],"f":"g"},null,{"h":{}}]})");
+    JsonSourceRecorder recorder(text, 1);
+    JsonSpan b;
+    JsonSpan c;
+    JsonSpan d;
+    JsonSpan h;
+    rapidjson::Document document;
+
+    // Act
+    bool is_parsed = parse_document_span(document, recorder, {9, text->size() - 10});
+
+    // Assert
+    ASSERT_TRUE(is_parsed);
+    ASSERT_EQ(2, recorder.get_source_count());
+    ASSERT_TRUE(recorder.get_source(0).try_get_member("b", b));
+    ASSERT_TRUE(recorder.get_source(0).try_get_member("d", d));
+    EXPECT_FALSE(recorder.get_source(0).try_get_member("a", c));
+    EXPECT_FALSE(recorder.get_source(0).try_get_member("c", c));
+    EXPECT_FALSE(recorder.get_source(0).try_get_member("f", c));
+    ASSERT_TRUE(recorder.get_source(1).try_get_member("h", h));
+    EXPECT_EQ(R"({"c":[2]})", get_text(recorder, b));
+    EXPECT_EQ(R"([3,{"e":4}])", get_text(recorder, d));
+    EXPECT_EQ(R"({})", get_text(recorder, h));
+    EXPECT_EQ(text, recorder.get_source(0).get_text());
+}
+
+INSTANTIATE_TEST_SUITE_P(Samples,
+                         JsonParserValidJsonTest,
+                         testing::Values(R"({"key":"value"})",
+                                         R"({"new":1})",
+                                         R"([1])",
+                                         R"(true)",
+                                         R"(false)",
+                                         R"(null)",
+                                         R"(1)",
+                                         R"(-1)",
+                                         R"(1.0)",
+                                         R"(1.5e3)",
+                                         R"(2147483648)",
+                                         R"(-9223372036854775808)",
+                                         R"(18446744073709551615)",
+                                         R"("xyz")",
+                                         R"("esc\"aped\\/\b\f\n\r\t")",
+                                         R"("é😀")",
+                                         R"({})",
+                                         R"([])",
+                                         R"( { "a" : [ 1 , { } , [ ] ] , "b" : { "c" : null } } )",
+                                         R"({"data":{"result":{"items":[{"id":1},{"id":2}],"cursor":{"total":2}}}})",
+                                         R"({"errors":[{"message":"xyz","code":1,"locations":[{"line":1}]}]})"));
+
+INSTANTIATE_TEST_SUITE_P(Samples,
+                         JsonParserInvalidJsonTest,
+                         testing::Values(R"()",
+                                         R"({{})",
+                                         R"([1,])",
+                                         R"({"key":})",
+                                         R"({"key" "value"})",
+                                         R"(tru)",
+                                         R"("unterminated)",
+                                         R"({} {})"));
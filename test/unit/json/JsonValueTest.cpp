@@ -17,6 +17,7 @@
 #include "enjinsdk/JsonValue.hpp"
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace enjin::sdk::json;
@@ -491,6 +492,37 @@ TEST_F(JsonValueTest, TryParseAsObjectWithValidJsonReturnsTrue) {
     EXPECT_EQ(expected, actual) << "Value does not equal expected";
 }
 
+TEST_F(JsonValueTest, TryParseAsObjectValueIsObjectReplacesExistingFields) {
+    // Arrange
+    const std::string raw = R"({"new":1})";
+    JsonValue actual = create_object_value();
+
+    // Assumptions
+    ASSERT_FALSE(actual.has_object_field("new")) << "Assume value does not have the new field before parse";
+
+    // Act
+    const bool result = actual.try_parse_as_object(raw);
+
+    // Assert
+    EXPECT_TRUE(result) << "Try-parse returned false result";
+    EXPECT_TRUE(actual.has_object_field("new")) << "Value does not have the parsed field";
+    EXPECT_EQ(1, actual.get_object_field_keys().size()) << "Value kept fields from before the parse";
+}
+
+TEST_F(JsonValueTest, TryParseAsObjectWithMalformedJsonLeavesValueUnchanged) {
+    // Arrange
+    const std::string raw = R"({{})";
+    const JsonValue expected = create_object_value();
+    JsonValue actual = create_object_value();
+
+    // Act
+    const bool result = actual.try_parse_as_object(raw);
+
+    // Assert
+    EXPECT_FALSE(result) << "Try-parse returned true result";
+    EXPECT_EQ(expected, actual) << "Value was changed by the failed parse";
+}
+
 TEST_F(JsonValueTest, TryParseAsObjectWithNonObjectJsonReturnsFalse) {
     // Arrange
     const std::string raw = R"(1)";
@@ -882,3 +914,97 @@ TEST_F(JsonValueTest, EqualityValuesAreObjectsBothSidesHaveSameFieldsReturnsTrue
     // Assert
     ASSERT_TRUE(actual);
 }
+
+TEST_F(JsonValueTest, CopyConstructorModifyingCopyDoesNotModifyOriginal) {
+    // Arrange
+    const JsonValue original = create_object_value();
+    const std::string expected = original.to_string();
+    JsonValue copy(original);
+
+    // Act
+    copy.try_set_object_field("other", create_int_value());
+
+    // Assert
+    ASSERT_EQ(expected, original.to_string());
+    ASSERT_TRUE(copy.has_object_field("other"));
+}
+
+TEST_F(JsonValueTest, AssignmentModifyingOriginalDoesNotModifyCopy) {
+    // Arrange
+    JsonValue original = JsonValue::create_array();
+    original.try_set_array_element(create_int_value());
+    const std::string expected = original.to_string();
+    JsonValue copy;
+    copy = original;
+
+    // Act
+    original.try_clear_array();
+
+    // Assert
+    ASSERT_EQ(expected, copy.to_string());
+    ASSERT_EQ("[]", original.to_string());
+}
+
+TEST_F(JsonValueTest, CopyConstructorOnStringValuesCopiesHaveSameStrings) {
+    // Arrange
+    const std::string expected_short("a");
+    const std::string expected_long(256, 'b');
+    JsonValue short_value = JsonValue::create_string();
+    JsonValue long_value = JsonValue::create_string();
+    short_value.try_set_string(expected_short);
+    long_value.try_set_string(expected_long);
+    std::string actual_short;
+    std::string actual_long;
+
+    // Act
+    JsonValue short_copy(short_value);
+    JsonValue long_copy(long_value);
+
+    // Assert
+    ASSERT_TRUE(short_copy.try_get_string(actual_short));
+    ASSERT_TRUE(long_copy.try_get_string(actual_long));
+    ASSERT_EQ(expected_short, actual_short);
+    ASSERT_EQ(expected_long, actual_long);
+}
+
+TEST_F(JsonValueTest, TrySetStringGivenLongThenShortStringOutParamEqualsLastString) {
+    // Arrange
+    const std::string expected("c");
+    JsonValue value = JsonValue::create_string();
+    value.try_set_string(std::string(256, 'd'));
+    std::string actual;
+
+    // Act
+    value.try_set_string(expected);
+
+    // Assert
+    ASSERT_TRUE(value.try_get_string(actual));
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(JsonValueTest, TryGetObjectFieldOutParamIsSameValueReturnsTrueAndValueEqualsField) {
+    // Arrange
+    const std::string expected("value");
+    JsonValue value = create_object_value();
+    std::string actual;
+
+    // Act
+    bool is_field_got = value.try_get_object_field("key", value);
+
+    // Assert
+    ASSERT_TRUE(is_field_got);
+    ASSERT_TRUE(value.try_get_string(actual));
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(JsonValueTest, MoveConstructorMovedValueKeepsNode) {
+    // Arrange
+    const std::string expected("1");
+    JsonValue original = create_int_value();
+
+    // Act
+    JsonValue moved(std::move(original));
+
+    // Assert
+    ASSERT_EQ(expected, moved.to_string());
+}
@@ -0,0 +1,159 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace enjin::sdk::json;
+
+class JsonViewTest : public testing::Test {
+public:
+    static constexpr char RAW_OBJECT[] = R"({"key":"value","number":1,"array":[1,2,3],"object":{"nested":true}})";
+
+    JsonValue json_value;
+
+protected:
+    void SetUp() override {
+        json_value.try_parse_as_object(RAW_OBJECT);
+    }
+};
+
+TEST_F(JsonViewTest, DefaultConstructorViewIsNull) {
+    // Arrange
+    JsonView class_under_test;
+
+    // Assert
+    ASSERT_TRUE(class_under_test.is_null());
+}
+
+TEST_F(JsonViewTest, ToStringViewOfValueReturnsSameAsValue) {
+    // Arrange
+    const std::string expected = json_value.to_string();
+    JsonView class_under_test(json_value);
+
+    // Act
+    std::string actual = class_under_test.to_string();
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(JsonViewTest, TryGetObjectFieldFieldIsSetViewsField) {
+    // Arrange
+    const std::string_view expected("value");
+    JsonView class_under_test(json_value);
+    JsonView field;
+    std::string_view actual;
+
+    // Act
+    bool is_field_get = class_under_test.try_get_object_field("key", field);
+
+    // Assert
+    ASSERT_TRUE(is_field_get);
+    ASSERT_TRUE(field.try_get_string(actual));
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(JsonViewTest, TryGetObjectFieldFieldIsNotSetViewsNull) {
+    // Arrange
+    JsonView class_under_test(json_value);
+    JsonView field(json_value);
+
+    // Act
+    bool is_field_get = class_under_test.try_get_object_field("missing", field);
+
+    // Assert
+    ASSERT_TRUE(is_field_get);
+    ASSERT_TRUE(field.is_null());
+}
+
+TEST_F(JsonViewTest, TryGetObjectFieldViewIsNotObjectReturnsFalse) {
+    // Arrange
+    JsonView array;
+    json_value.try_get_object_field("array", array);
+    JsonView field;
+
+    // Act
+    bool is_field_get = array.try_get_object_field("key", field);
+
+    // Assert
+    ASSERT_FALSE(is_field_get);
+}
+
+TEST_F(JsonViewTest, GetArrayElementsViewIsArrayIteratesElementsInOrder) {
+    // Arrange
+    const std::vector<int> expected {1, 2, 3};
+    JsonView class_under_test;
+    json_value.try_get_object_field("array", class_under_test);
+    std::vector<int> actual;
+
+    // Act
+    for (const JsonView element: class_under_test.get_array_elements()) {
+        int number;
+        if (element.try_get_number(number)) {
+            actual.push_back(number);
+        }
+    }
+
+    // Assert
+    ASSERT_EQ(expected.size(), class_under_test.size());
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(JsonViewTest, GetArrayElementsViewIsNotArrayRangeIsEmpty) {
+    // Arrange
+    JsonView class_under_test(json_value);
+
+    // Act
+    auto range = class_under_test.get_array_elements();
+
+    // Assert
+    ASSERT_EQ(range.begin(), range.end());
+}
+
+TEST_F(JsonViewTest, GetObjectMembersViewIsObjectIteratesMembersInOrder) {
+    // Arrange
+    const std::vector<std::string> expected {"key", "number", "array", "object"};
+    JsonView class_under_test(json_value);
+    std::vector<std::string> actual;
+
+    // Act
+    for (const JsonMember member: class_under_test.get_object_members()) {
+        actual.emplace_back(member.key);
+    }
+
+    // Assert
+    ASSERT_EQ(expected.size(), class_under_test.size());
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(JsonViewTest, ToValueViewOfFieldReturnsIndependentCopy) {
+    // Arrange
+    JsonView field;
+    json_value.try_get_object_field("object", field);
+    const std::string expected = field.to_string();
+
+    // Act
+    JsonValue actual = field.to_value();
+    json_value.try_remove_object_field("object");
+
+    // Assert
+    ASSERT_TRUE(actual.is_object());
+    ASSERT_EQ(expected, actual.to_string());
+}
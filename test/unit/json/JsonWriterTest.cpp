@@ -0,0 +1,126 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonWriter.hpp"
+#include <string>
+
+using namespace enjin::sdk::json;
+
+class JsonWriterTest : public testing::Test {
+public:
+    JsonWriter class_under_test;
+};
+
+class JsonWriterReuseTest : public testing::Test {
+};
+
+TEST_F(JsonWriterTest, ToStringNothingWrittenReturnsEmptyString) {
+    // Act
+    std::string actual = class_under_test.to_string();
+
+    // Assert
+    ASSERT_TRUE(actual.empty());
+}
+
+TEST_F(JsonWriterTest, ToStringObjectWrittenReturnsExpected) {
+    // Arrange
+    const std::string expected(R"({"bool":true,"int":1,"long":2,"null":null,"string":"\"a\"","array":[1,2]})");
+
+    // Act
+    class_under_test.start_object();
+    class_under_test.write_key("bool");
+    class_under_test.write_bool(true);
+    class_under_test.write_key("int");
+    class_under_test.write_number(1);
+    class_under_test.write_key("long");
+    class_under_test.write_number(2L);
+    class_under_test.write_key("null");
+    class_under_test.write_null();
+    class_under_test.write_key("string");
+    class_under_test.write_string("\"a\"");
+    class_under_test.write_key("array");
+    class_under_test.start_array();
+    class_under_test.write_number(1);
+    class_under_test.write_number(2);
+    class_under_test.end_array();
+    class_under_test.end_object();
+
+    // Assert
+    ASSERT_TRUE(class_under_test.is_complete());
+    ASSERT_EQ(expected, class_under_test.to_string());
+}
+
+TEST_F(JsonWriterTest, IsCompleteObjectNotEndedReturnsFalse) {
+    // Arrange
+    class_under_test.start_object();
+
+    // Act
+    bool actual = class_under_test.is_complete();
+
+    // Assert
+    ASSERT_FALSE(actual);
+}
+
+TEST_F(JsonWriterTest, WriteValueWritesSameAsValueToString) {
+    // Arrange
+    JsonValue value;
+    value.try_parse_as_object(R"({"key":"value","nested":{"array":[1,true,null]}})");
+    const std::string expected = value.to_string();
+
+    // Act
+    class_under_test.write_value(value);
+
+    // Assert
+    ASSERT_EQ(expected, class_under_test.to_string());
+}
+
+TEST_F(JsonWriterTest, ToStringOtherWriterOnSameThreadDoesNotShareOutput) {
+    // Arrange
+    const std::string expected("[1]");
+    const std::string expected_other("[2]");
+    JsonWriter other;
+
+    // Act
+    class_under_test.start_array();
+    other.start_array();
+    class_under_test.write_number(1);
+    other.write_number(2);
+    class_under_test.end_array();
+    other.end_array();
+
+    // Assert
+    ASSERT_EQ(expected, class_under_test.to_string());
+    ASSERT_EQ(expected_other, other.to_string());
+}
+
+TEST_F(JsonWriterReuseTest, ToStringPreviousWriterOnSameThreadDoesNotLeaveOutput) {
+    // Arrange
+    const std::string expected("{}");
+    {
+        JsonWriter previous;
+        previous.start_array();
+        previous.end_array();
+    }
+    JsonWriter class_under_test;
+
+    // Act
+    class_under_test.start_object();
+    class_under_test.end_object();
+
+    // Assert
+    ASSERT_EQ(expected, class_under_test.to_string());
+}
@@ -139,3 +139,57 @@ TEST_F(AssetTest, EqualityRightSideIsPopulatedReturnsFalse) {
     // Assert
     ASSERT_FALSE(actual);
 }
+
+TEST_F(AssetTest, DeserializeCopyDoesNotModifyOriginal) {
+    // Arrange
+    const std::string expected("1");
+    class_under_test.deserialize(POPULATED_JSON_OBJECT);
+    Asset copy(class_under_test);
+
+    // Act
+    copy.deserialize(EmptyJsonObject);
+
+    // Assert
+    ASSERT_EQ(expected, class_under_test.get_id().value());
+    ASSERT_EQ(3, class_under_test.get_variants()->size());
+    ASSERT_FALSE(copy.get_id().has_value());
+}
+
+TEST_F(AssetTest, DeserializeAssignedCopyDoesNotModifyOriginal) {
+    // Arrange
+    const std::string expected("1");
+    class_under_test.deserialize(POPULATED_JSON_OBJECT);
+    Asset copy;
+    copy = class_under_test;
+
+    // Act
+    copy.deserialize(EmptyJsonObject);
+
+    // Assert
+    ASSERT_EQ(expected, class_under_test.get_id().value());
+    ASSERT_FALSE(copy.get_id().has_value());
+}
+
+TEST_F(AssetTest, CopySharesNestedModelsOfOriginal) {
+    // Arrange
+    class_under_test.deserialize(POPULATED_JSON_OBJECT);
+
+    // Act
+    Asset copy(class_under_test);
+
+    // Assert
+    ASSERT_EQ(&class_under_test.get_variants().value(), &copy.get_variants().value());
+    ASSERT_EQ(class_under_test, copy);
+}
+
+TEST_F(AssetTest, DeserializeDefaultConstructedDoesNotModifyOtherDefaultConstructed) {
+    // Arrange
+    Asset other;
+
+    // Act
+    class_under_test.deserialize(POPULATED_JSON_OBJECT);
+
+    // Assert
+    ASSERT_TRUE(class_under_test.get_id().has_value());
+    ASSERT_FALSE(other.get_id().has_value());
+}
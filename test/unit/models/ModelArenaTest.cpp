@@ -0,0 +1,239 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "CountingMemoryResource.hpp"
+#include "enjinsdk/GraphqlResponse.hpp"
+#include "enjinsdk/models/Asset.hpp"
+#include "enjinsdk/models/ModelArena.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::models;
+using namespace enjin::test::utils;
+
+class ModelArenaTest : public testing::Test {
+public:
+    CountingMemoryResource upstream;
+
+    constexpr static char POPULATED_JSON_OBJECT[] =
+            R"({"id":"1","name":"1","stateData":{"creator":"1"},"variants":[{},{},{}]})";
+};
+
+TEST_F(ModelArenaTest, ModelDeserializedInScopeIsAllocatedFromArena) {
+    // Arrange
+    ModelArena arena(0, &upstream);
+    ModelArenaScope scope(arena);
+
+    // Act
+    Asset asset;
+    asset.deserialize(POPULATED_JSON_OBJECT);
+
+    // Assert
+    ASSERT_GT(upstream.allocations, 0);
+}
+
+TEST_F(ModelArenaTest, ModelDeserializedAfterScopeIsClosedIsNotAllocatedFromArena) {
+    // Arrange
+    ModelArena arena(0, &upstream);
+    {
+        ModelArenaScope scope(arena);
+    }
+
+    // Act
+    Asset asset;
+    asset.deserialize(POPULATED_JSON_OBJECT);
+
+    // Assert
+    ASSERT_EQ(0, upstream.allocations);
+}
+
+TEST_F(ModelArenaTest, ModelOutlivesArenaKeepsArenaUntilDestroyed) {
+    // Arrange
+    const std::string expected("1");
+    std::optional<Asset> asset;
+    {
+        ModelArena arena(0, &upstream);
+        ModelArenaScope scope(arena);
+        asset.emplace();
+        asset->deserialize(POPULATED_JSON_OBJECT);
+    }
+
+    // Act
+    const std::string actual = asset->get_state_data()->get_creator().value();
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(3, asset->get_variants()->size());
+    ASSERT_GT(upstream.outstanding_bytes, 0);
+    asset.reset();
+    ASSERT_EQ(0, upstream.outstanding_bytes);
+}
+
+TEST_F(ModelArenaTest, CopyMadeOutsideScopeKeepsArenaUntilDestroyed) {
+    // Arrange
+    std::optional<Asset> asset;
+    {
+        ModelArena arena(0, &upstream);
+        ModelArenaScope scope(arena);
+        asset.emplace();
+        asset->deserialize(POPULATED_JSON_OBJECT);
+    }
+    std::optional<Asset> copy(asset.value());
+
+    // Act
+    asset.reset();
+
+    // Assert
+    ASSERT_GT(upstream.outstanding_bytes, 0);
+    ASSERT_EQ("1", copy->get_state_data()->get_creator().value());
+    copy.reset();
+    ASSERT_EQ(0, upstream.outstanding_bytes);
+}
+
+TEST_F(ModelArenaTest, CopyDeserializedOutsideScopeIsNotAllocatedFromArena) {
+    // Arrange
+    std::optional<Asset> asset;
+    {
+        ModelArena arena(0, &upstream);
+        ModelArenaScope scope(arena);
+        asset.emplace();
+        asset->deserialize(POPULATED_JSON_OBJECT);
+    }
+    Asset copy(asset.value());
+
+    // Act
+    copy.deserialize(POPULATED_JSON_OBJECT);
+    asset.reset();
+
+    // Assert
+    ASSERT_EQ(0, upstream.outstanding_bytes);
+    ASSERT_EQ("1", copy.get_state_data()->get_creator().value());
+}
+
+TEST_F(ModelArenaTest, NestedScopeRestoresPreviousArenaWhenClosed) {
+    // Arrange
+    CountingMemoryResource inner_upstream;
+    ModelArena arena(0, &upstream);
+    ModelArena inner_arena(0, &inner_upstream);
+    ModelArenaScope scope(arena);
+    {
+        ModelArenaScope inner_scope(inner_arena);
+        Asset inner_asset;
+        inner_asset.deserialize(POPULATED_JSON_OBJECT);
+    }
+    const std::size_t expected = inner_upstream.allocations;
+
+    // Act
+    Asset asset;
+    asset.deserialize(POPULATED_JSON_OBJECT);
+
+    // Assert
+    ASSERT_GT(expected, 0);
+    ASSERT_EQ(expected, inner_upstream.allocations);
+    ASSERT_GT(upstream.allocations, 0);
+}
+
+TEST_F(ModelArenaTest, ResultOfListResponseOutlivesResponse) {
+    // Arrange
+    const std::string json(R"({"data":{"result":[{"id":"1","stateData":{"creator":"2"}},{"id":"3"}]}})");
+    std::vector<Asset> assets;
+    {
+        GraphqlResponse<std::vector<Asset>> response(json);
+        assets = response.get_result().value();
+    }
+
+    // Act
+    const std::string actual = assets[0].get_state_data()->get_creator().value();
+
+    // Assert
+    ASSERT_EQ("2", actual);
+    ASSERT_EQ("3", assets[1].get_id().value());
+}
+
+TEST_F(ModelArenaTest, PagedScopeRetainedItemKeepsOnlyItsArena) {
+    // Arrange
+    std::vector<Asset> assets;
+    {
+        PagedModelArenaScope scope(2, &upstream);
+        for (int i = 0; i < 8; i++) {
+            scope.begin_item();
+            Asset asset;
+            asset.deserialize(POPULATED_JSON_OBJECT);
+            assets.push_back(std::move(asset));
+        }
+    }
+    const std::size_t all_bytes = upstream.outstanding_bytes;
+
+    // Act
+    assets.resize(1);
+
+    // Assert
+    ASSERT_GT(upstream.outstanding_bytes, 0);
+    ASSERT_LT(upstream.outstanding_bytes * 2, all_bytes);
+}
+
+TEST_F(ModelArenaTest, PagedScopeModelDeserializedBeforeFirstItemIsNotAllocatedFromArena) {
+    // Arrange
+    PagedModelArenaScope scope(2, &upstream);
+
+    // Act
+    Asset asset;
+    asset.deserialize(POPULATED_JSON_OBJECT);
+
+    // Assert
+    ASSERT_EQ(0, upstream.allocations);
+}
+
+TEST_F(ModelArenaTest, RetainedItemOfListResponseDoesNotKeepBodySizedBlock) {
+    // Arrange
+    const std::string name(1000, 'a');
+    std::string json(R"({"data":{"result":[)");
+    for (int i = 0; i < 64; i++) {
+        json += (i == 0 ? "" : ",");
+        json += R"({"id":")" + std::to_string(i) + R"(","name":")" + name + R"(","stateData":{"creator":"1"}})";
+    }
+    json += "]}}";
+    std::optional<GraphqlResponse<std::vector<Asset>>> response(std::in_place, json, &upstream);
+    const std::size_t page_bytes = upstream.outstanding_bytes;
+    const Asset retained = response->get_result()->front();
+
+    // Act
+    response.reset();
+
+    // Assert
+    ASSERT_EQ("0", retained.get_id().value());
+    ASSERT_GT(upstream.outstanding_bytes, 0);
+    ASSERT_LT(upstream.outstanding_bytes * 2, page_bytes);
+    ASSERT_LT(upstream.outstanding_bytes * 4, json.size());
+}
+
+TEST_F(ModelArenaTest, ListResponseWithUpstreamAllocatesModelsFromUpstreamUntilResultIsDestroyed) {
+    // Arrange
+    const std::string json(R"({"data":{"result":[{"id":"1","stateData":{"creator":"2"}},{"id":"3"}]}})");
+    std::optional<GraphqlResponse<std::vector<Asset>>> response(std::in_place, json, &upstream);
+    const std::size_t allocations = upstream.allocations;
+
+    // Act
+    response.reset();
+
+    // Assert
+    ASSERT_GT(allocations, 0);
+    ASSERT_EQ(0, upstream.outstanding_bytes);
+}
@@ -0,0 +1,169 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
+#include "enjinsdk/models/ResultTable.hpp"
+#include "enjinsdk/models/TransactionTable.hpp"
+#include "enjinsdk/models/WalletTable.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+using namespace enjin::sdk::json;
+using namespace enjin::sdk::models;
+
+class ResultTableTest : public testing::Test {
+public:
+    static JsonValue parse(const std::string& json) {
+        JsonValue value;
+        value.try_parse_as_object(json);
+        return value;
+    }
+};
+
+TEST_F(ResultTableTest, PresenceBitmapRowsSpanningWordsAreRecorded) {
+    // Arrange
+    constexpr std::size_t rows = 130;
+    PresenceBitmap class_under_test;
+
+    // Act
+    for (std::size_t row = 0; row < rows; row++) {
+        class_under_test.push_back(row % 3 == 0);
+    }
+
+    // Assert
+    ASSERT_EQ(rows, class_under_test.size());
+    ASSERT_EQ(3, class_under_test.get_words().size());
+    ASSERT_EQ(44, class_under_test.count());
+    for (std::size_t row = 0; row < rows; row++) {
+        ASSERT_EQ(row % 3 == 0, class_under_test.test(row));
+    }
+}
+
+TEST_F(ResultTableTest, ColumnRowWithoutValueHoldsDefaultValue) {
+    // Arrange
+    Column<int> class_under_test;
+
+    // Act
+    class_under_test.push_back(4);
+    class_under_test.push_back(std::nullopt);
+
+    // Assert
+    ASSERT_EQ(4, class_under_test.get(0).value());
+    ASSERT_FALSE(class_under_test.get(1).has_value());
+    ASSERT_EQ(0, class_under_test.get_values()[1]);
+}
+
+TEST_F(ResultTableTest, StringColumnEqualValuesShareCode) {
+    // Arrange
+    StringColumn class_under_test;
+
+    // Act
+    class_under_test.push_back(std::string_view("a"));
+    class_under_test.push_back(std::string_view("b"));
+    class_under_test.push_back(std::nullopt);
+    class_under_test.push_back(std::string_view("a"));
+
+    // Assert
+    ASSERT_EQ(2, class_under_test.get_dictionary().size());
+    ASSERT_EQ(class_under_test.get_codes()[0], class_under_test.get_codes()[3]);
+    ASSERT_NE(class_under_test.get_codes()[0], class_under_test.get_codes()[1]);
+    ASSERT_EQ("b", class_under_test.get(1).value());
+    ASSERT_FALSE(class_under_test.get(2).has_value());
+}
+
+TEST_F(ResultTableTest, StringColumnCopyOutlivesOriginal) {
+    // Arrange
+    const std::string expected("0x0000000000000000000000000000000000000001");
+    std::optional<StringColumn> original(std::in_place);
+    original->push_back(std::string_view(expected));
+
+    // Act
+    StringColumn copy(original.value());
+    original.reset();
+    copy.push_back(std::string_view(expected));
+
+    // Assert
+    ASSERT_EQ(1, copy.get_dictionary().size());
+    ASSERT_EQ(expected, copy.get(0).value());
+    ASSERT_EQ(expected, copy.get(1).value());
+}
+
+TEST_F(ResultTableTest, AppendWalletsHaveExpectedColumns) {
+    // Arrange
+    const JsonValue first = parse(R"({"ethAddress":"0x1","enjBalance":1.5,"ethBalance":2.5})");
+    const JsonValue second = parse(R"({"ethAddress":"0x2","enjAllowance":3.5})");
+    WalletTable class_under_test;
+
+    // Act
+    class_under_test.append(JsonView(first));
+    class_under_test.append(JsonView(second));
+
+    // Assert
+    ASSERT_EQ(2, class_under_test.size());
+    EXPECT_EQ("0x2", class_under_test.get_eth_addresses().get(1).value());
+    EXPECT_FALSE(class_under_test.get_enj_allowances().get(0).has_value());
+    EXPECT_EQ(3.5f, class_under_test.get_enj_allowances().get(1).value());
+    EXPECT_EQ(1.5f, class_under_test.get_enj_balances().get(0).value());
+    EXPECT_EQ(1, class_under_test.get_eth_balances().get_presence().count());
+}
+
+TEST_F(ResultTableTest, AppendTransactionsHaveExpectedColumns) {
+    // Arrange
+    const JsonValue item = parse(R"({"id":1,"type":"APPROVE","state":"PENDING","accepted":true,"wallet":{}})");
+    TransactionTable class_under_test;
+
+    // Act
+    class_under_test.append(JsonView(item));
+
+    // Assert
+    ASSERT_EQ(1, class_under_test.size());
+    EXPECT_EQ(1, class_under_test.get_ids().get(0).value());
+    EXPECT_EQ(TransactionType::Approve, class_under_test.get_types().get(0).value());
+    EXPECT_EQ(TransactionState::Pending, class_under_test.get_states().get(0).value());
+    EXPECT_TRUE(class_under_test.get_accepted().get(0).value());
+    EXPECT_FALSE(class_under_test.get_project_wallets().get(0).has_value());
+    EXPECT_FALSE(class_under_test.get_transaction_ids().get(0).has_value());
+}
+
+TEST_F(ResultTableTest, AppendNonObjectAppendsRowWithoutValues) {
+    // Arrange
+    TransactionTable class_under_test;
+
+    // Act
+    class_under_test.append(JsonView());
+
+    // Assert
+    ASSERT_EQ(1, class_under_test.size());
+    ASSERT_EQ(0, class_under_test.get_ids().get_presence().count());
+}
+
+TEST_F(ResultTableTest, CopyOperatorCopyEqualsOriginal) {
+    // Arrange
+    const JsonValue item = parse(R"({"id":1,"title":"a","contract":"0x1"})");
+    TransactionTable original;
+    TransactionTable copy;
+    original.append(JsonView(item));
+
+    // Act
+    copy = original;
+
+    // Assert
+    ASSERT_EQ(original, copy);
+}
@@ -15,9 +15,17 @@
 
 #include "gtest/gtest.h"
 #include "JsonTestSuite.hpp"
+#include "enjinsdk/GraphqlResponse.hpp"
+#include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonView.hpp"
 #include "enjinsdk/models/Transaction.hpp"
+#include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
+using namespace enjin::sdk::graphql;
+using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::test::suites;
 
@@ -118,6 +126,32 @@ TEST_F(TransactionTest, DeserializePopulatedJsonObjectFieldsHaveExpectedValues)
     EXPECT_EQ(expected_string, class_under_test.get_updated_at().value());
 }
 
+TEST_F(TransactionTest, DeserializeViewOfPopulatedJsonObjectEqualsDeserializedString) {
+    // Arrange
+    Transaction expected;
+    expected.deserialize(POPULATED_JSON_OBJECT);
+    JsonValue json;
+    json.try_parse_as_object(POPULATED_JSON_OBJECT);
+
+    // Act
+    class_under_test.deserialize(JsonView(json));
+
+    // Assert
+    ASSERT_EQ(expected, class_under_test);
+}
+
+TEST_F(TransactionTest, DeserializeViewOfNonObjectFieldsDoNotHaveValues) {
+    // Arrange
+    class_under_test.deserialize(POPULATED_JSON_OBJECT);
+    const JsonView json;
+
+    // Act
+    class_under_test.deserialize(json);
+
+    // Assert
+    ASSERT_EQ(Transaction(), class_under_test);
+}
+
 TEST_F(TransactionTest, EqualityNeitherSideIsPopulatedReturnsTrue) {
     // Arrange
     Transaction lhs;
@@ -182,3 +216,61 @@ TEST_F(TransactionTest, CopyOperatorCopyEqualsOriginal) {
     // Assert
     ASSERT_EQ(original, copy);
 }
+
+TEST_F(TransactionTest, GetWalletValueDeserializedFromIsDestroyedReturnsDecodedWallet) {
+    // Arrange
+    const std::string expected("0x1");
+    {
+        JsonValue json;
+        json.try_parse_as_object(R"({"id":1,"wallet":{"ethAddress":"0x1"}})");
+        class_under_test.deserialize(JsonView(json));
+    }
+
+    // Act
+    const std::optional<Wallet>& actual = class_under_test.get_wallet();
+
+    // Assert
+    ASSERT_TRUE(actual.has_value());
+    ASSERT_EQ(expected, actual.value().get_eth_address().value());
+}
+
+TEST_F(TransactionTest, CopyConstructorWithNestedModelsCopyEqualsOriginal) {
+    // Arrange
+    Transaction original;
+    original.deserialize(R"({"id":1,"wallet":{"ethAddress":"0x1"},"project":{"name":"1"}})");
+
+    // Act
+    Transaction copy(original);
+
+    // Assert
+    ASSERT_EQ(original.get_wallet(), copy.get_wallet());
+    ASSERT_EQ(original.get_project(), copy.get_project());
+    ASSERT_EQ(original, copy);
+}
+
+TEST_F(TransactionTest, GetWalletOfListItemFromSeveralThreadsReturnsSameWallet) {
+    // Arrange
+    constexpr int thread_count = 8;
+    const GraphqlResponse<std::vector<Transaction>> response(
+            std::string(R"({"data":{"result":[{"id":1,"wallet":{"ethAddress":"0x1","balances":[{"value":1}]}}]}})"));
+    const Transaction& transaction = response.get_result().value().front();
+    std::vector<const std::string*> actual(thread_count);
+    std::vector<std::thread> threads;
+
+    // Act
+    for (int i = 0; i < thread_count; i++) {
+        threads.emplace_back([&transaction, &actual, i]() {
+            actual[i] = &transaction.get_wallet().value().get_eth_address().value();
+        });
+    }
+
+    for (std::thread& thread: threads) {
+        thread.join();
+    }
+
+    // Assert
+    for (const std::string* eth_address: actual) {
+        ASSERT_EQ(actual[0], eth_address);
+        ASSERT_EQ("0x1", *eth_address);
+    }
+}
@@ -20,10 +20,16 @@
 #include "MockHttpServer.hpp"
 #include "TestableBaseSchema.hpp"
 #include "enjinsdk/HttpHeaders.hpp"
+#include "enjinsdk/ThreadPoolExecutor.hpp"
+#include <chrono>
+#include <future>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace enjin::sdk;
+using namespace enjin::sdk::graphql;
 using namespace enjin::sdk::http;
 using namespace enjin::test::mocks;
 using namespace enjin::test::utils;
@@ -35,11 +41,11 @@ public:
     static constexpr char DEFAULT_PATH_QUERY_FRAGMENT[] = "/graphql/test";
     static constexpr char JSON[] = "application/json; charset=utf-8";
 
-    TestableBaseSchema create_testable_base_schema() {
+    TestableBaseSchema create_testable_base_schema(std::shared_ptr<enjin::sdk::utils::IExecutor> executor = nullptr) {
         auto client = std::make_unique<HttpClient>(mock_server.uri());
         client->start();
 
-        return TestableBaseSchema(std::move(client));
+        return TestableBaseSchema(std::move(client), std::move(executor));
     }
 
 protected:
@@ -149,3 +155,190 @@ TEST_F(BaseSchemaHttpTest, SendRequestForManyServerRespondsWithErrorReponseIsNot
     // Assert
     ASSERT_FALSE(response.is_successful());
 }
+
+TEST_F(BaseSchemaHttpTest, SendRequestForOneWithCallbackCallbackReceivesExpected) {
+    // Arrange - Data
+    DummyObject expected = DummyObject::create_default_dummy_object();
+    TestableBaseSchema schema = create_testable_base_schema();
+    FakeGraphqlRequest fake_request(expected.serialize());
+    std::promise<GraphqlResponse<DummyObject>> promise;
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path(DEFAULT_PATH_QUERY_FRAGMENT)
+                              .with_body(schema.create_request_body(fake_request))
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, {JSON})
+                                     .with_body(R"({"data":{"result":)" + expected.serialize() + "}}"));
+
+    // Act
+    schema.send_request_for_one<DummyObject>(fake_request, [&promise](std::future<GraphqlResponse<DummyObject>> fut) {
+        promise.set_value(fut.get());
+    });
+
+    // Assert
+    auto response = promise.get_future().get();
+    ASSERT_EQ(expected, response.get_result().value());
+}
+
+TEST_F(BaseSchemaHttpTest, SendRequestForOneWithCallbackCallbackRunsOnExecutor) {
+    // Arrange - Data
+    DummyObject expected = DummyObject::create_default_dummy_object();
+    auto executor = std::make_shared<enjin::sdk::utils::ThreadPoolExecutor>(1);
+    TestableBaseSchema schema = create_testable_base_schema(executor);
+    FakeGraphqlRequest fake_request(expected.serialize());
+    std::promise<bool> promise;
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path(DEFAULT_PATH_QUERY_FRAGMENT)
+                              .with_body(schema.create_request_body(fake_request))
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, {JSON})
+                                     .with_body(R"({"data":{"result":)" + expected.serialize() + "}}"));
+
+    // Act
+    schema.send_request_for_one<DummyObject>(fake_request,
+                                             [&promise, executor](std::future<GraphqlResponse<DummyObject>> fut) {
+                                                 fut.get();
+                                                 promise.set_value(executor->is_worker_thread());
+                                             });
+
+    // Assert
+    ASSERT_TRUE(promise.get_future().get());
+}
+
+TEST_F(BaseSchemaHttpTest, SendRequestForManyWithCallbackCallbackReceivesExpected) {
+    // Arrange - Data
+    DummyObject expected = DummyObject::create_default_dummy_object();
+    TestableBaseSchema schema = create_testable_base_schema();
+    FakeGraphqlRequest fake_request(expected.serialize());
+    std::promise<GraphqlResponse<std::vector<DummyObject>>> promise;
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path(DEFAULT_PATH_QUERY_FRAGMENT)
+                              .with_body(schema.create_request_body(fake_request))
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body(R"({"data":{"result":[)" +
+                                                expected.serialize() +
+                                                "," +
+                                                expected.serialize() +
+                                                "]}}"));
+
+    // Act
+    schema.send_request_for_many<DummyObject>(fake_request,
+                                              [&promise](std::future<GraphqlResponse<std::vector<DummyObject>>> fut) {
+                                                  promise.set_value(fut.get());
+                                              });
+
+    // Assert
+    auto response = promise.get_future().get();
+    ASSERT_EQ(2, response.get_result().value().size());
+    for (const auto& actual: response.get_result().value()) {
+        EXPECT_EQ(expected, actual);
+    }
+}
+
+TEST_F(BaseSchemaHttpTest, SendRequestForOneWithCallbackRequestFailsCallbackFutureThrowsException) {
+    // Arrange
+    DummyObject dummy_object = DummyObject::create_default_dummy_object();
+    TestableBaseSchema schema = create_testable_base_schema();
+    FakeGraphqlRequest fake_request(dummy_object.serialize());
+    std::promise<void> promise;
+    schema.get_middleware()->get_client()->stop();
+
+    // Act
+    schema.send_request_for_one<DummyObject>(fake_request, [&promise](std::future<GraphqlResponse<DummyObject>> fut) {
+        try {
+            fut.get();
+            promise.set_value();
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    });
+
+    // Assert
+    ASSERT_THROW(promise.get_future().get(), std::runtime_error);
+}
+
+TEST_F(BaseSchemaHttpTest, SendRequestsWithBatchingEnabledServerReceivesArrayAndEachReceivesExpected) {
+    // Arrange - Data
+    DummyObject expected = DummyObject::create_default_dummy_object();
+    TestableBaseSchema schema = create_testable_base_schema();
+    FakeGraphqlRequest fake_request_for_one(R"({"one":1})");
+    FakeGraphqlRequest fake_request_for_many(R"({"many":2})");
+    const std::string batch_body = "["
+                                   + schema.create_request_body(fake_request_for_one)
+                                   + ","
+                                   + schema.create_request_body(fake_request_for_many)
+                                   + "]";
+    schema.set_request_batching(2, std::chrono::hours(1));
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path(DEFAULT_PATH_QUERY_FRAGMENT)
+                              .with_body(batch_body)
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body(R"([{"data":{"result":)"
+                                                + expected.serialize()
+                                                + R"(}},{"data":{"result":[)"
+                                                + expected.serialize()
+                                                + "]}}]"));
+
+    // Act
+    auto future_for_one = schema.send_request_for_one<DummyObject>(fake_request_for_one);
+    auto future_for_many = schema.send_request_for_many<DummyObject>(fake_request_for_many);
+
+    // Assert
+    auto response_for_one = future_for_one.get();
+    auto response_for_many = future_for_many.get();
+    ASSERT_EQ(expected, response_for_one.get_result().value());
+    ASSERT_EQ(1, response_for_many.get_result().value().size());
+    ASSERT_EQ(expected, response_for_many.get_result().value()[0]);
+    ASSERT_EQ(1, mock_server.find_received_requests(Request::create().with_body(batch_body)).size());
+}
+
+TEST_F(BaseSchemaHttpTest, SendRequestsWithBatchingEnabledDeadlinePassesSendsPartialBatch) {
+    // Arrange - Data
+    DummyObject expected = DummyObject::create_default_dummy_object();
+    TestableBaseSchema schema = create_testable_base_schema();
+    FakeGraphqlRequest fake_request(expected.serialize());
+    const std::string request_body = schema.create_request_body(fake_request);
+    std::promise<GraphqlResponse<DummyObject>> promise;
+    schema.set_request_batching(10, std::chrono::milliseconds(20));
+
+    // Arrange - Stubbing
+    mock_server.given(Request::create()
+                              .with_path(DEFAULT_PATH_QUERY_FRAGMENT)
+                              .with_body("[" + request_body + "," + request_body + "]")
+                              .using_post())
+               .respond_with(Response::create()
+                                     .with_success()
+                                     .with_header(ContentType, JSON)
+                                     .with_body(R"([{"data":{"result":)"
+                                                + expected.serialize()
+                                                + R"(}},{"data":{"result":)"
+                                                + expected.serialize()
+                                                + "}}]"));
+
+    // Act
+    auto future = schema.send_request_for_one<DummyObject>(fake_request);
+    schema.send_request_for_one<DummyObject>(fake_request, [&promise](std::future<GraphqlResponse<DummyObject>> fut) {
+        promise.set_value(fut.get());
+    });
+
+    // Assert
+    ASSERT_EQ(expected, future.get().get_result().value());
+    ASSERT_EQ(expected, promise.get_future().get().get_result().value());
+}
@@ -14,13 +14,30 @@
  */
 
 #include "gtest/gtest.h"
+#include "CountingMemoryResource.hpp"
 #include "FakeGraphqlRequest.hpp"
 #include "MockHttpClient.hpp"
 #include "TestableBaseSchema.hpp"
+#include "enjinsdk/models/Balance.hpp"
+#include "enjinsdk/models/BalanceTable.hpp"
+#include "enjinsdk/models/Player.hpp"
+#include "enjinsdk/project/CreatePlayer.hpp"
+#include "enjinsdk/project/GetPlayer.hpp"
+#include "enjinsdk/project/GetPlayers.hpp"
+#include "enjinsdk/shared/GetBalances.hpp"
+#include <chrono>
+#include <future>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <thread>
 
 using namespace enjin::sdk;
+using namespace enjin::sdk::graphql;
 using namespace enjin::sdk::http;
+using namespace enjin::sdk::models;
+using namespace enjin::sdk::project;
+using namespace enjin::sdk::shared;
 using namespace enjin::test::mocks;
 using namespace enjin::test::utils;
 
@@ -28,11 +45,28 @@ class BaseSchemaTest : public testing::Test {
 public:
     std::unique_ptr<TestableBaseSchema> class_under_test;
 
+    MockHttpClient* mock_http_client = nullptr;
+
+    static HttpResponse create_player_response(const std::string& id) {
+        return HttpResponse::builder()
+                .code(200)
+                .body(R"({"data":{"result":{"id":")" + id + R"("}}})")
+                .build();
+    }
+
+    static std::future<HttpResponse> create_ready_response(const std::string& id) {
+        std::promise<HttpResponse> promise;
+        promise.set_value(create_player_response(id));
+        return promise.get_future();
+    }
+
 protected:
     void SetUp() override {
         testing::Test::SetUp();
 
-        class_under_test = std::make_unique<TestableBaseSchema>(std::make_unique<MockHttpClient>());
+        auto http_client = std::make_unique<MockHttpClient>();
+        mock_http_client = http_client.get();
+        class_under_test = std::make_unique<TestableBaseSchema>(std::move(http_client));
     }
 };
 
@@ -47,3 +81,220 @@ TEST_F(BaseSchemaTest, CreateRequestBody) {
     // Asert
     ASSERT_EQ(expected, actual);
 }
+
+TEST_F(BaseSchemaTest, CreateRequestRequestIsQueryRequestIsIdempotent) {
+    // Arrange
+    GetPlayer request;
+    request.set_id("xyz");
+
+    // Act
+    const HttpRequest actual = class_under_test->create_request(request);
+
+    // Assert
+    ASSERT_TRUE(actual.is_idempotent());
+}
+
+TEST_F(BaseSchemaTest, CreateRequestRequestIsMutationRequestIsNotIdempotent) {
+    // Arrange
+    CreatePlayer request;
+    request.set_id("xyz");
+
+    // Act
+    const HttpRequest actual = class_under_test->create_request(request);
+
+    // Assert
+    ASSERT_FALSE(actual.is_idempotent());
+}
+
+TEST_F(BaseSchemaTest, SendRequestForOneIdenticalQueriesInFlightWithCoalescingEnabledSendsOneRequest) {
+    // Arrange - Data
+    const std::string expected("xyz");
+    GetPlayer request;
+    request.set_id(expected);
+    std::promise<void> request_sent;
+    std::promise<HttpResponse> response;
+    class_under_test->set_request_coalescing(true);
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, send_request(testing::_))
+            .Times(1)
+            .WillOnce([&request_sent, &response](const HttpRequest&) {
+                request_sent.set_value();
+                return response.get_future();
+            });
+
+    // Act
+    auto future1 = class_under_test->send_request_for_one<Player>(request);
+    auto future2 = class_under_test->send_request_for_one<Player>(request);
+    request_sent.get_future().wait();
+    for (int i = 0; i < 100 && class_under_test->get_coalesced_request_count() == 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    response.set_value(create_player_response(expected));
+
+    // Assert
+    EXPECT_EQ(1, class_under_test->get_coalesced_request_count());
+    EXPECT_EQ(expected, future1.get().get_result().value().get_id().value());
+    EXPECT_EQ(expected, future2.get().get_result().value().get_id().value());
+}
+
+TEST_F(BaseSchemaTest, SendRequestForOneIdenticalQueriesWithCoalescingDisabledSendsEachRequest) {
+    // Arrange
+    GetPlayer request;
+    request.set_id("xyz");
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, send_request(testing::_))
+            .Times(2)
+            .WillRepeatedly([](const HttpRequest&) {
+                return create_ready_response("xyz");
+            });
+
+    // Act
+    class_under_test->send_request_for_one<Player>(request).get();
+    class_under_test->send_request_for_one<Player>(request).get();
+
+    // Assert
+    EXPECT_EQ(0, class_under_test->get_coalesced_request_count());
+}
+
+TEST_F(BaseSchemaTest, SendRequestForOneIdenticalMutationsWithCoalescingEnabledSendsEachRequest) {
+    // Arrange
+    CreatePlayer request;
+    request.set_id("xyz");
+    class_under_test->set_request_coalescing(true);
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, send_request(testing::_))
+            .Times(2)
+            .WillRepeatedly([](const HttpRequest&) {
+                return create_ready_response("xyz");
+            });
+
+    // Act
+    auto future1 = class_under_test->send_request_for_one<Player>(request);
+    auto future2 = class_under_test->send_request_for_one<Player>(request);
+    future1.get();
+    future2.get();
+
+    // Assert
+    EXPECT_EQ(0, class_under_test->get_coalesced_request_count());
+}
+
+TEST_F(BaseSchemaTest, ComposeQueriesTwoQueriesSendsOneRequestAndCompletesEachFuture) {
+    // Arrange - Data
+    std::string sent_body;
+    auto composed_query = class_under_test->compose_queries();
+    auto future1 = composed_query.add_for_one<Player>(GetPlayer().set_id("abc"));
+    auto future2 = composed_query.add_for_one<Player>(GetPlayer().set_id("xyz"));
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, send_request(testing::_))
+            .Times(1)
+            .WillOnce([&sent_body](const HttpRequest& request) {
+                sent_body = request.get_body().value();
+
+                std::promise<HttpResponse> promise;
+                promise.set_value(HttpResponse::builder()
+                                          .code(200)
+                                          .body(R"({"data":{"op0":{"id":"abc"},"op1":{"id":"xyz"}}})")
+                                          .build());
+                return promise.get_future();
+            });
+
+    // Act
+    composed_query.send();
+
+    // Assert
+    EXPECT_EQ("abc", future1.get().get_result().value().get_id().value());
+    EXPECT_EQ("xyz", future2.get().get_result().value().get_id().value());
+    EXPECT_NE(std::string::npos, sent_body.find("op1: GetPlayer"));
+    EXPECT_EQ(0, composed_query.size());
+}
+
+TEST_F(BaseSchemaTest, ComposeQueriesRequestFailsEachFutureThrowsException) {
+    // Arrange - Data
+    auto composed_query = class_under_test->compose_queries();
+    auto future1 = composed_query.add_for_one<Player>(GetPlayer().set_id("abc"));
+    auto future2 = composed_query.add_for_one<Player>(GetPlayer().set_id("xyz"));
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, send_request(testing::_))
+            .Times(1)
+            .WillOnce([](const HttpRequest&) -> std::future<HttpResponse> {
+                throw std::runtime_error("Failed to send");
+            });
+
+    // Act
+    composed_query.send();
+
+    // Assert
+    EXPECT_THROW(future1.get(), std::runtime_error);
+    EXPECT_THROW(future2.get(), std::runtime_error);
+}
+
+TEST_F(BaseSchemaTest, ComposeQueriesRequestIsMutationThrowsException) {
+    // Arrange
+    auto composed_query = class_under_test->compose_queries();
+    CreatePlayer request;
+    request.set_id("xyz");
+
+    // Assert
+    ASSERT_THROW(composed_query.add_for_one<Player>(request), std::runtime_error);
+}
+
+TEST_F(BaseSchemaTest, SendRequestForTableServerRespondsWithErrorsResponseHasErrors) {
+    // Arrange - Data
+    const std::string expected("xyz");
+    GetBalances request;
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, send_request(testing::_))
+            .Times(1)
+            .WillOnce([&expected](const HttpRequest&) {
+                std::promise<HttpResponse> promise;
+                promise.set_value(HttpResponse::builder()
+                                          .code(200)
+                                          .body(R"({"data":{"result":[{"id":"1"}]},"errors":[{"message":")"
+                                                + expected + R"("}]})")
+                                          .build());
+                return promise.get_future();
+            });
+
+    // Act
+    auto response = class_under_test->send_request_for_table<Balance>(request).get();
+
+    // Assert
+    ASSERT_TRUE(response.has_errors());
+    EXPECT_EQ(expected, response.get_errors().value()[0].get_message().value());
+    EXPECT_EQ(1, response.get_result().value().size());
+}
+
+TEST_F(BaseSchemaTest, SendRequestForManyWithModelMemoryResourceAllocatesModelsFromResource) {
+    // Arrange - Data
+    CountingMemoryResource resource;
+    GetPlayers request;
+    class_under_test->set_model_memory_resource(&resource);
+
+    // Arrange - Expectations
+    EXPECT_CALL(*mock_http_client, send_request(testing::_))
+            .Times(1)
+            .WillOnce([](const HttpRequest&) {
+                std::promise<HttpResponse> promise;
+                promise.set_value(HttpResponse::builder()
+                                          .code(200)
+                                          .body(R"({"data":{"result":[{"id":"1"},{"id":"2"}]}})")
+                                          .build());
+                return promise.get_future();
+            });
+
+    // Act
+    std::optional<GraphqlResponse<std::vector<Player>>> response(
+            class_under_test->send_request_for_many<Player>(request).get());
+
+    // Assert
+    ASSERT_EQ(2, response->get_result().value().size());
+    EXPECT_GT(resource.allocations, 0);
+    response.reset();
+    EXPECT_EQ(0, resource.outstanding_bytes);
+}
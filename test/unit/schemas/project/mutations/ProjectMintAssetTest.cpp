@@ -15,11 +15,14 @@
 
 #include "JsonTestSuite.hpp"
 #include "ProjectTransactionRequestArgumentsTestSuite.hpp"
+#include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include "enjinsdk/project/MintAsset.hpp"
 #include "gtest/gtest.h"
 #include <string>
 #include <vector>
 
+using namespace enjin::sdk::json;
 using namespace enjin::sdk::models;
 using namespace enjin::sdk::project;
 using namespace enjin::test::suites;
@@ -66,6 +69,22 @@ TEST_F(ProjectMintAssetTest, SerializeSetFieldsReturnsExpectedJsonObject) {
     ASSERT_EQ(expected, actual);
 }
 
+TEST_F(ProjectMintAssetTest, SerializeToWriterSetFieldsWritesSameValueAsToJson) {
+    // Arrange
+    MintAsset request = create_default_request();
+    request.set_mints({MintInput().set_to("1").set_value("1")});
+    const JsonValue expected = request.to_json();
+    JsonWriter writer;
+    JsonValue actual;
+
+    // Act
+    request.serialize(writer);
+
+    // Assert
+    ASSERT_TRUE(actual.try_parse_as_object(writer.to_string()));
+    ASSERT_EQ(expected, actual);
+}
+
 TEST_F(ProjectMintAssetTest, EqualityNeitherSideIsPopulatedReturnsTrue) {
     // Arrange
     MintAsset lhs;
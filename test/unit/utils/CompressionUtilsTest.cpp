@@ -0,0 +1,150 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "CompressionUtils.hpp"
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+using namespace enjin::sdk::utils;
+
+class CompressionUtilsTest : public testing::Test {
+public:
+    static constexpr char DATA[] = "hello";
+
+    static std::string create_zlib_data() {
+        const unsigned char bytes[] = {0x78, 0x9c, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x07, 0x00, 0x06, 0x2c, 0x02, 0x15};
+        return std::string(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+    }
+
+    static std::string create_raw_deflate_data() {
+        const unsigned char bytes[] = {0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x07, 0x00};
+        return std::string(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+    }
+};
+
+TEST_F(CompressionUtilsTest, GzipCompressThenDecompressReturnsOriginalData) {
+    // Arrange
+    const std::string expected(4096, 'a');
+
+    // Act
+    std::string compressed = gzip_compress(expected);
+    std::string actual = decompress(compressed, "gzip");
+
+    // Assert
+    EXPECT_LT(compressed.size(), expected.size());
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(CompressionUtilsTest, GzipCompressEmptyDataThenDecompressReturnsEmptyData) {
+    // Arrange
+    const std::string expected;
+
+    // Act
+    std::string actual = decompress(gzip_compress(expected), "gzip");
+
+    // Assert
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(CompressionUtilsTest, DecompressEncodingIsMixedCaseReturnsOriginalData) {
+    // Arrange
+    const std::string expected(DATA);
+
+    // Act
+    std::string actual = decompress(gzip_compress(expected), " X-GZip ");
+
+    // Assert
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(CompressionUtilsTest, DecompressDeflateInZlibFormatReturnsOriginalData) {
+    // Arrange
+    const std::string expected(DATA);
+
+    // Act
+    std::string actual = decompress(create_zlib_data(), "deflate");
+
+    // Assert
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(CompressionUtilsTest, DecompressDeflateInRawFormatReturnsOriginalData) {
+    // Arrange
+    const std::string expected(DATA);
+
+    // Act
+    std::string actual = decompress(create_raw_deflate_data(), "deflate");
+
+    // Assert
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(CompressionUtilsTest, DecompressDataIsCorruptThrowsException) {
+    // Arrange
+    const std::string data("not compressed");
+
+    // Assert
+    EXPECT_THROW(decompress(data, "gzip"), std::runtime_error);
+}
+
+TEST_F(CompressionUtilsTest, DecompressDataIsTruncatedThrowsException) {
+    // Arrange
+    const std::string compressed = gzip_compress(std::string(4096, 'a'));
+    const std::string data = compressed.substr(0, compressed.size() / 2);
+
+    // Assert
+    EXPECT_THROW(decompress(data, "gzip"), std::runtime_error);
+}
+
+TEST_F(CompressionUtilsTest, DecompressDataExceedsMaxSizeThrowsException) {
+    // Arrange
+    const std::size_t max_size = 1024 * 1024;
+    const std::string data = gzip_compress(std::string(max_size * 16, '0'));
+
+    // Assert
+    ASSERT_LT(data.size(), max_size / 16);
+    EXPECT_THROW(decompress(data, "gzip", max_size), std::runtime_error);
+}
+
+TEST_F(CompressionUtilsTest, DecompressDataIsWithinMaxSizeReturnsOriginalData) {
+    // Arrange
+    const std::string expected(4096, '0');
+    const std::string data = gzip_compress(expected);
+
+    // Act
+    std::string actual = decompress(data, "gzip", expected.size());
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(CompressionUtilsTest, DecompressEncodingIsUnsupportedThrowsException) {
+    // Arrange
+    const std::string data = gzip_compress(DATA);
+
+    // Assert
+    EXPECT_THROW(decompress(data, "br"), std::runtime_error);
+}
+
+TEST_F(CompressionUtilsTest, IsSupportedContentEncodingReturnsExpected) {
+    // Assert
+    EXPECT_TRUE(is_supported_content_encoding("gzip"));
+    EXPECT_TRUE(is_supported_content_encoding("x-gzip"));
+    EXPECT_TRUE(is_supported_content_encoding("deflate"));
+    EXPECT_FALSE(is_supported_content_encoding("identity"));
+    EXPECT_FALSE(is_supported_content_encoding("br"));
+}
@@ -17,6 +17,7 @@
 #include "DummyObject.hpp"
 #include "enjinsdk/JsonUtils.hpp"
 #include "enjinsdk/JsonValue.hpp"
+#include "enjinsdk/JsonWriter.hpp"
 #include <optional>
 #include <string>
 #include <vector>
@@ -161,4 +162,38 @@ TEST_F(JsonUtilsTest, TrySetFieldObjectHasFieldAfterAct) {
     // Assert
     EXPECT_TRUE(result) << "Try-set returned false result";
     ASSERT_TRUE(json_value.has_object_field(expected_key)) << "Object value does not have expected field";
-}
\ No newline at end of file
+}
+TEST_F(JsonUtilsTest, TryWriteFieldArrayOfObjectsWritesExpectedField) {
+    // Arrange
+    const std::string expected = R"({"key":[{"id":1},{"id":1}]})";
+    const std::optional<std::vector<DummyObject>> in_field({
+            DummyObject::create_default_dummy_object(),
+            DummyObject::create_default_dummy_object(),
+    });
+    JsonWriter writer;
+    writer.start_object();
+
+    // Act
+    const bool result = JsonUtils::try_write_field(writer, "key", in_field);
+
+    // Assert
+    writer.end_object();
+    EXPECT_TRUE(result) << "Try-write returned false result";
+    ASSERT_EQ(expected, writer.to_string());
+}
+
+TEST_F(JsonUtilsTest, TryWriteFieldEmptyFieldReturnsFalseAndDoesNotWriteField) {
+    // Arrange
+    const std::string expected = "{}";
+    const std::optional<std::string> in_field;
+    JsonWriter writer;
+    writer.start_object();
+
+    // Act
+    const bool result = JsonUtils::try_write_field(writer, "key", in_field);
+
+    // Assert
+    writer.end_object();
+    EXPECT_FALSE(result) << "Try-write returned true result";
+    ASSERT_EQ(expected, writer.to_string());
+}
@@ -0,0 +1,169 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "enjinsdk/StringInternPool.hpp"
+#include "enjinsdk/models/Balance.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace enjin::sdk::models;
+using namespace enjin::sdk::utils;
+
+class StringInternPoolTest : public testing::Test {
+public:
+    constexpr static char BALANCE_JSON[] = R"({"id":"0x1000000000000001","index":"0","value":1})";
+
+    static Balance create_balance(const std::string& json) {
+        Balance balance;
+        balance.deserialize(json);
+        return balance;
+    }
+
+protected:
+    void SetUp() override {
+        clear_string_intern_pool();
+        set_string_interning(true);
+    }
+
+    void TearDown() override {
+        set_string_interning(false);
+        clear_string_intern_pool();
+    }
+};
+
+TEST_F(StringInternPoolTest, DeserializeInterningEnabledModelsShareString) {
+    // Arrange
+    const StringInternPoolStats stats_before = get_string_intern_pool_stats();
+
+    // Act
+    Balance first = create_balance(BALANCE_JSON);
+    Balance second = create_balance(BALANCE_JSON);
+
+    // Assert
+    const StringInternPoolStats stats_after = get_string_intern_pool_stats();
+    ASSERT_EQ(&first.get_id().value(), &second.get_id().value());
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(2, stats_after.strings);
+    ASSERT_EQ(stats_before.hits + 2, stats_after.hits);
+}
+
+TEST_F(StringInternPoolTest, DeserializeInterningDisabledModelsDoNotShareString) {
+    // Arrange
+    set_string_interning(false);
+
+    // Act
+    Balance first = create_balance(BALANCE_JSON);
+    Balance second = create_balance(BALANCE_JSON);
+
+    // Assert
+    ASSERT_NE(&first.get_id().value(), &second.get_id().value());
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(0, get_string_intern_pool_stats().strings);
+}
+
+TEST_F(StringInternPoolTest, EqualityModelsInternedEitherSideOfClearReturnsTrue) {
+    // Arrange
+    Balance lhs = create_balance(BALANCE_JSON);
+    clear_string_intern_pool();
+    Balance rhs = create_balance(BALANCE_JSON);
+
+    // Act
+    bool actual = lhs == rhs;
+
+    // Assert
+    ASSERT_NE(&lhs.get_id().value(), &rhs.get_id().value());
+    ASSERT_TRUE(actual);
+}
+
+TEST_F(StringInternPoolTest, EqualityModelsWithDifferentInternedStringsReturnsFalse) {
+    // Arrange
+    Balance lhs = create_balance(BALANCE_JSON);
+    Balance rhs = create_balance(R"({"id":"0x1000000000000002","index":"0","value":1})");
+
+    // Act
+    bool actual = lhs == rhs;
+
+    // Assert
+    ASSERT_FALSE(actual);
+}
+
+TEST_F(StringInternPoolTest, DeserializePoolIsFullModelHoldsOwnString) {
+    // Arrange
+    const std::string expected("0x1000000000000001");
+    set_string_interning(true, 0);
+
+    // Act
+    Balance balance = create_balance(BALANCE_JSON);
+
+    // Assert
+    ASSERT_EQ(expected, balance.get_id().value());
+    ASSERT_EQ(0, get_string_intern_pool_stats().strings);
+}
+
+TEST_F(StringInternPoolTest, CopyOfModelOutlivesClearedPool) {
+    // Arrange
+    const std::string expected("0x1000000000000001");
+    Balance copy;
+
+    // Act
+    {
+        Balance original = create_balance(BALANCE_JSON);
+        copy = original;
+    }
+    clear_string_intern_pool();
+
+    // Assert
+    ASSERT_EQ(expected, copy.get_id().value());
+}
+
+TEST_F(StringInternPoolTest, EqualityModelsInternedWhilePoolIsClearedConcurrentlyReturnsTrue) {
+    // Arrange
+    constexpr int thread_count = 4;
+    constexpr int iterations = 2000;
+    std::atomic<bool> done = false;
+    std::atomic<int> mismatches = 0;
+    std::vector<std::thread> threads;
+
+    // Act
+    std::thread clearer([&done]() {
+        while (!done.load()) {
+            clear_string_intern_pool();
+        }
+    });
+    for (int i = 0; i < thread_count; i++) {
+        threads.emplace_back([&mismatches]() {
+            Balance previous = create_balance(BALANCE_JSON);
+            for (int j = 0; j < iterations; j++) {
+                Balance current = create_balance(BALANCE_JSON);
+                if (current != previous) {
+                    mismatches++;
+                }
+
+                previous = current;
+            }
+        });
+    }
+    for (std::thread& thread: threads) {
+        thread.join();
+    }
+    done = true;
+    clearer.join();
+
+    // Assert
+    ASSERT_EQ(0, mismatches.load());
+}
@@ -0,0 +1,209 @@
+/* Copyright 2021 Enjin Pte. Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "enjinsdk/ThreadPoolExecutor.hpp"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace enjin::sdk::utils;
+
+class ThreadPoolExecutorTest : public testing::Test {
+public:
+    static constexpr std::size_t WorkerCount = 4;
+    static constexpr std::size_t MaxQueueDepth = 16;
+
+    ThreadPoolExecutor class_under_test = ThreadPoolExecutor(WorkerCount, MaxQueueDepth);
+};
+
+TEST_F(ThreadPoolExecutorTest, ConstructorWorkerCountIsZeroUsesAtLeastOneWorker) {
+    // Arrange
+    ThreadPoolExecutor executor(0);
+
+    // Act
+    std::size_t actual = executor.get_worker_count();
+
+    // Assert
+    ASSERT_GE(actual, 1);
+}
+
+TEST_F(ThreadPoolExecutorTest, SubmitTaskReturnsFutureWithExpectedResult) {
+    // Arrange
+    const int expected = 42;
+
+    // Act
+    std::future<int> future = class_under_test.submit([expected]() {
+        return expected;
+    });
+
+    // Assert
+    ASSERT_EQ(expected, future.get());
+}
+
+TEST_F(ThreadPoolExecutorTest, SubmitTaskThrowsFutureRethrowsException) {
+    // Act
+    std::future<void> future = class_under_test.submit([]() {
+        throw std::runtime_error("Test exception");
+    });
+
+    // Assert
+    ASSERT_THROW(future.get(), std::runtime_error);
+}
+
+TEST_F(ThreadPoolExecutorTest, SubmitManyTasksAllTasksAreRun) {
+    // Arrange
+    const int expected = 1000;
+    std::atomic<int> counter = 0;
+    std::vector<std::future<void>> futures;
+
+    // Act
+    for (int i = 0; i < expected; i++) {
+        futures.push_back(class_under_test.submit([&counter]() {
+            counter++;
+        }));
+    }
+
+    for (auto& future: futures) {
+        future.get();
+    }
+
+    // Assert
+    ASSERT_EQ(expected, counter.load());
+}
+
+TEST_F(ThreadPoolExecutorTest, IsWorkerThreadCalledFromTaskReturnsTrue) {
+    // Act
+    bool actual = class_under_test.submit([this]() {
+        return class_under_test.is_worker_thread();
+    }).get();
+
+    // Assert
+    ASSERT_TRUE(actual);
+}
+
+TEST_F(ThreadPoolExecutorTest, IsWorkerThreadCalledFromOutsideReturnsFalse) {
+    // Act
+    bool actual = class_under_test.is_worker_thread();
+
+    // Assert
+    ASSERT_FALSE(actual);
+}
+
+TEST_F(ThreadPoolExecutorTest, ExecuteFromWorkerThreadRunsMostRecentTaskFirst) {
+    // Arrange
+    const std::vector<int> expected{2, 1};
+    ThreadPoolExecutor executor(1);
+    std::vector<int> actual;
+    std::promise<void> done;
+
+    // Act
+    executor.execute([&executor, &actual, &done]() {
+        executor.execute([&actual, &done]() {
+            actual.push_back(1);
+            done.set_value();
+        });
+        executor.execute([&actual]() {
+            actual.push_back(2);
+        });
+    });
+    done.get_future().wait();
+
+    // Assert
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(ThreadPoolExecutorTest, ExecuteQueueIsSaturatedCallerRunsTask) {
+    // Arrange - Data
+    ThreadPoolExecutor executor(1, 1);
+    std::promise<void> blocker;
+    std::shared_future<void> blocker_future = blocker.get_future().share();
+    const std::thread::id caller_id = std::this_thread::get_id();
+
+    // Arrange - Saturate the single worker and the single queue slot
+    executor.execute([blocker_future]() {
+        blocker_future.wait();
+    });
+    while (executor.get_pending_count() != 0) {
+        std::this_thread::yield();
+    }
+    executor.execute([blocker_future]() {
+        blocker_future.wait();
+    });
+
+    // Act
+    std::thread::id actual_id;
+    executor.execute([&actual_id]() {
+        actual_id = std::this_thread::get_id();
+    });
+    blocker.set_value();
+
+    // Assert
+    ASSERT_EQ(caller_id, actual_id);
+}
+
+TEST_F(ThreadPoolExecutorTest, ShutdownRunsPendingTasksBeforeReturning) {
+    // Arrange
+    const int expected = 100;
+    std::atomic<int> counter = 0;
+    for (int i = 0; i < expected; i++) {
+        class_under_test.execute([&counter]() {
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+            counter++;
+        });
+    }
+
+    // Act
+    class_under_test.shutdown();
+
+    // Assert
+    EXPECT_TRUE(class_under_test.is_shutdown());
+    EXPECT_EQ(expected, counter.load());
+}
+
+TEST_F(ThreadPoolExecutorTest, ExecuteAfterShutdownThrowsException) {
+    // Arrange
+    class_under_test.shutdown();
+
+    // Assert
+    ASSERT_THROW(class_under_test.execute([]() {}), std::runtime_error);
+}
+
+TEST_F(ThreadPoolExecutorTest, DestroyFromTaskRunsPendingTasksAfterDestruction) {
+    // Arrange
+    auto executor = std::make_unique<ThreadPoolExecutor>(1);
+    std::promise<void> destroyed;
+    std::promise<void> pending_run;
+    std::future<void> destroyed_future = destroyed.get_future();
+    std::future<void> pending_future = pending_run.get_future();
+
+    // Act
+    executor->execute([&executor, &destroyed, &pending_run]() {
+        executor->execute([&pending_run]() {
+            pending_run.set_value();
+        });
+        executor.reset();
+        destroyed.set_value();
+    });
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, destroyed_future.wait_for(std::chrono::seconds(5)));
+    ASSERT_EQ(std::future_status::ready, pending_future.wait_for(std::chrono::seconds(5)));
+    ASSERT_EQ(nullptr, executor);
+}
@@ -19,8 +19,9 @@
 
 namespace enjin::test::utils {
 
-TestableBaseSchema::TestableBaseSchema(std::unique_ptr<sdk::http::IHttpClient> http_client)
-        : BaseSchema(std::move(http_client), "test", nullptr) {
+TestableBaseSchema::TestableBaseSchema(std::unique_ptr<sdk::http::IHttpClient> http_client,
+                                       std::shared_ptr<sdk::utils::IExecutor> executor)
+        : BaseSchema(std::move(http_client), "test", nullptr, std::move(executor)) {
 }
 
 const std::unique_ptr<sdk::ClientMiddleware>& TestableBaseSchema::get_middleware() {